@@ -0,0 +1,63 @@
+/**
+ * Tests that mongod and mongos start up, rotate their log file and shut down when the log file is
+ * written by the asynchronous log writer, whose thread starts after the process allows
+ * multithreading and has started its signal processing thread.
+ *
+ * @tags: [requires_sharding]
+ */
+(function() {
+"use strict";
+
+const asyncLogParameters = {
+    logAsyncWriteQueueSize: 1024,
+    logAsyncWriteOverflowPolicy: "block",
+};
+
+function assertLogContains(logPath, expected) {
+    assert(cat(logPath).includes(expected), `'${expected}' not found in ${logPath}`);
+}
+
+function getRotatedLogPath(logPath) {
+    const rotated = listFiles(MongoRunner.dataPath)
+                        .map(file => file.name)
+                        .filter(name => name.startsWith(logPath + "."));
+    assert.eq(1, rotated.length, tojson(rotated));
+    return rotated[0];
+}
+
+function testRotateAndShutdown(conn, logPath, stopFn) {
+    assert.commandWorked(conn.adminCommand({logRotate: 1}));
+    assert.commandWorked(conn.adminCommand({logMessage: "after async log rotation"}));
+    stopFn();
+
+    // Lines logged before the rotation went to the rotated file, and the lines still queued at
+    // shutdown were written out before the process exited.
+    assertLogContains(getRotatedLogPath(logPath), '"id":23016,' /* Waiting for connections */);
+    assertLogContains(logPath, "after async log rotation");
+}
+
+{
+    const logPath = MongoRunner.dataPath + "log_async_writes_mongod.log";
+    const conn = MongoRunner.runMongod({logpath: logPath, setParameter: asyncLogParameters});
+    assert.neq(null, conn, "mongod failed to start with asynchronous log writes");
+    assert.eq(asyncLogParameters.logAsyncWriteQueueSize,
+              assert
+                  .commandWorked(conn.adminCommand({getParameter: 1, logAsyncWriteQueueSize: 1}))
+                  .logAsyncWriteQueueSize);
+
+    testRotateAndShutdown(conn, logPath, () => MongoRunner.stopMongod(conn));
+    assertLogContains(logPath, '"id":20565,' /* Now exiting */);
+}
+
+{
+    const logPath = MongoRunner.dataPath + "log_async_writes_mongos.log";
+    const st = new ShardingTest({
+        shards: 1,
+        mongos: 1,
+        other: {mongosOptions: {logpath: logPath, setParameter: asyncLogParameters}}
+    });
+    assert.neq(null, st.s, "mongos failed to start with asynchronous log writes");
+
+    testRotateAndShutdown(st.s, logPath, () => st.stop());
+}
+})();
@@ -0,0 +1,103 @@
+/**
+ * Tests that the profile writer, which inserts profiler entries on a background thread when
+ * profilingAsyncWriteBufferSizeBytes is set, writes the buffered entries of all databases in one
+ * batch, drops new entries while its buffer is full, and writes out the buffered entries at
+ * shutdown.
+ *
+ * @tags: [requires_persistence]
+ */
+(function() {
+"use strict";
+
+const kBufferSizeBytes = 16 * 1024;
+
+let conn = MongoRunner.runMongod(
+    {setParameter: {profilingAsyncWriteBufferSizeBytes: kBufferSizeBytes}});
+assert.neq(null, conn, "mongod failed to start with asynchronous profiler writes");
+
+const dbA = conn.getDB("profile_async_writes_a");
+const dbB = conn.getDB("profile_async_writes_b");
+for (const db of [dbA, dbB]) {
+    assert.commandWorked(db.coll.insert({a: 1}));
+    assert.commandWorked(db.setProfilingLevel(2));
+}
+
+function getStats() {
+    return assert.commandWorked(conn.adminCommand({serverStatus: 1, profileWriter: 1}))
+        .profileWriter;
+}
+
+function runFinds(db, comment, count) {
+    for (let i = 0; i < count; ++i) {
+        assert.commandWorked(db.runCommand({find: "coll", filter: {a: i}, comment: comment}));
+    }
+}
+
+function countProfiled(db, comment) {
+    return db.system.profile.find({"command.comment": comment}).itcount();
+}
+
+function setPaused(paused) {
+    assert.commandWorked(conn.adminCommand(
+        {configureFailPoint: "pauseProfileWriter", mode: paused ? "alwaysOn" : "off"}));
+}
+
+// Entries buffered while the writer is paused are written in a single batch, with one insert per
+// database.
+{
+    const kFinds = 5;
+    const before = getStats();
+    setPaused(true);
+    runFinds(dbA, "batched", kFinds);
+    runFinds(dbB, "batched", kFinds);
+
+    let stats = getStats();
+    assert.gt(stats.bufferedBytes, 0, tojson(stats));
+    assert.eq(stats.written, before.written, tojson(stats));
+    assert.eq(stats.batches, before.batches, tojson(stats));
+
+    // Buffering the next entry schedules the write again.
+    setPaused(false);
+    runFinds(dbA, "batched", 1);
+    assert.soon(() => {
+        stats = getStats();
+        return stats.written == before.written + 2 * kFinds + 1;
+    }, () => tojson(stats));
+    assert.eq(stats.bufferedBytes, 0, tojson(stats));
+    assert.eq(stats.batches, before.batches + 1, tojson(stats));
+    assert.eq(stats.dropped, before.dropped, tojson(stats));
+
+    assert.eq(countProfiled(dbA, "batched"), kFinds + 1);
+    assert.eq(countProfiled(dbB, "batched"), kFinds);
+}
+
+// New entries are dropped while the buffer is full, and the buffered entries are written out at
+// shutdown even though the writer is still paused.
+let numBuffered;
+{
+    const before = getStats();
+    setPaused(true);
+
+    let numFinds = 0;
+    let stats = before;
+    while (stats.dropped == before.dropped) {
+        runFinds(dbA, "dropped", 1);
+        ++numFinds;
+        assert.lt(numFinds, 10000, "profiler entries were never dropped");
+        stats = getStats();
+    }
+    assert.lte(stats.bufferedBytes, kBufferSizeBytes, tojson(stats));
+    assert.eq(stats.written, before.written, tojson(stats));
+
+    numBuffered = numFinds - (stats.dropped - before.dropped);
+    assert.gt(numBuffered, 0, tojson(stats));
+}
+
+const dbpath = conn.dbpath;
+MongoRunner.stopMongod(conn);
+conn = MongoRunner.runMongod({dbpath: dbpath, noCleanData: true});
+assert.neq(null, conn, "mongod failed to restart");
+
+assert.eq(countProfiled(conn.getDB(dbA.getName()), "dropped"), numBuffered);
+MongoRunner.stopMongod(conn);
+})();
@@ -0,0 +1,70 @@
+/**
+ * Tests that profilingRateLimitPerShape suppresses the slow query log lines and profiler entries of
+ * a query shape beyond its rate, and that the next admitted operation of the shape reports the
+ * number of suppressed ones as suppressedSimilarOps in both.
+ */
+(function() {
+"use strict";
+
+const kSlowQueryLogId = 51803;
+
+// A bucket of one token which practically never refills.
+const conn = MongoRunner.runMongod(
+    {setParameter: {profilingRateLimitPerShape: 0.001, profilingRateLimitBurst: 1}});
+assert.neq(null, conn, "mongod failed to start");
+
+const db = conn.getDB("profile_rate_limit_per_shape");
+assert.commandWorked(db.coll.insert({a: 1}));
+
+// Every operation is slow, so that it is both logged and profiled.
+assert.commandWorked(db.setProfilingLevel(1, {slowms: -1}));
+
+function runFind(comment, value) {
+    assert.commandWorked(db.runCommand({find: "coll", filter: {a: value}, comment: comment}));
+}
+
+function getSlowQueryLogLines(comment) {
+    const log = assert.commandWorked(db.adminCommand({getLog: "global"})).log;
+    return log.map(line => JSON.parse(line))
+        .filter(line => line.id == kSlowQueryLogId && line.attr.command &&
+                    line.attr.command.comment == comment);
+}
+
+function getProfilerEntries(comment) {
+    return db.system.profile.find({"command.comment": comment}).toArray();
+}
+
+const kSuppressed = 4;
+runFind("first", 0);
+for (let i = 1; i <= kSuppressed; ++i) {
+    runFind("suppressed", i);
+}
+
+// Let the bucket refill, so that the next operation of the shape is admitted.
+assert.commandWorked(db.adminCommand({setParameter: 1, profilingRateLimitPerShape: 1000}));
+sleep(10);
+runFind("last", kSuppressed + 1);
+
+assert.eq(1, getSlowQueryLogLines("first").length);
+assert.eq(0, getSlowQueryLogLines("suppressed").length);
+const lastLogLines = getSlowQueryLogLines("last");
+assert.eq(1, lastLogLines.length);
+assert.eq(kSuppressed, lastLogLines[0].attr.suppressedSimilarOps, tojson(lastLogLines[0]));
+
+const firstEntries = getProfilerEntries("first");
+assert.eq(1, firstEntries.length);
+assert(!firstEntries[0].hasOwnProperty("suppressedSimilarOps"), tojson(firstEntries[0]));
+assert.eq(0, getProfilerEntries("suppressed").length);
+const lastEntries = getProfilerEntries("last");
+assert.eq(1, lastEntries.length);
+assert.eq(kSuppressed, lastEntries[0].suppressedSimilarOps, tojson(lastEntries[0]));
+
+const stats =
+    assert.commandWorked(db.adminCommand({serverStatus: 1, shapeRateLimiter: 1})).shapeRateLimiter;
+assert.gte(stats.suppressed, kSuppressed, tojson(stats));
+assert(stats.topSuppressed.some(shape => shape.ns == db.coll.getFullName() &&
+                                    shape.command == "find" && shape.suppressed == kSuppressed),
+       tojson(stats));
+
+MongoRunner.stopMongod(conn);
+})();
@@ -29,9 +29,13 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <thread>
 
 #include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
 
 namespace mongo {
 /**
@@ -65,4 +69,127 @@ public:
 private:
     AtomicWord<long long> _counter;
 };
+
+namespace striped_counter_detail {
+
+/**
+ * Upper bound on the number of stripes of a Striped<T>, which bounds the memory each one
+ * uses.
+ */
+constexpr size_t kMaxStripes = 32;
+
+/**
+ * Returns the number of stripes every Striped<T> has: the number of hardware threads rounded
+ * up to a power of two, but no more than kMaxStripes.
+ */
+inline size_t stripeCount() {
+    static const size_t count = [] {
+        const size_t hardwareThreads = std::thread::hardware_concurrency();
+        size_t stripes = 1;
+        while (stripes < hardwareThreads && stripes < kMaxStripes) {
+            stripes <<= 1;
+        }
+        return stripes;
+    }();
+    return count;
+}
+
+/**
+ * Returns the stripe updated by the calling thread. Threads are assigned stripes round-robin the
+ * first time they update any Striped<T>.
+ */
+inline size_t threadStripe() {
+    thread_local const size_t stripe = [] {
+        static AtomicWord<unsigned> nextStripe{0};
+        return nextStripe.fetchAndAddRelaxed(1) & (stripeCount() - 1);
+    }();
+    return stripe;
+}
+
+}  // namespace striped_counter_detail
+
+/**
+ * Holds one instance of T per stripe, each on its own cache line, for statistics that are updated
+ * far more often than they are read. Every thread updates the instance of its own stripe, and
+ * readers combine all instances. T must be safe to update concurrently from the threads that share
+ * a stripe and to read while it is being updated.
+ */
+template <typename T>
+class Striped {
+public:
+    Striped()
+        : _numStripes(striped_counter_detail::stripeCount()),
+          _stripes(std::make_unique<CacheExclusive<T>[]>(_numStripes)) {}
+
+    Striped(const Striped&) = delete;
+    Striped& operator=(const Striped&) = delete;
+
+    /** Returns the instance of the calling thread's stripe. */
+    T& local() {
+        return *_stripes[striped_counter_detail::threadStripe()];
+    }
+
+    /** Invokes 'fn' on the instance of every stripe. */
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (size_t i = 0; i < _numStripes; ++i) {
+            fn(*_stripes[i]);
+        }
+    }
+
+    template <typename Fn>
+    void forEach(Fn&& fn) {
+        for (size_t i = 0; i < _numStripes; ++i) {
+            fn(*_stripes[i]);
+        }
+    }
+
+private:
+    const size_t _numStripes;
+    std::unique_ptr<CacheExclusive<T>[]> _stripes;
+};
+
+/**
+ * A 64bit counter for values updated far more often than they are read.
+ *
+ * Like Counter64, but the value is spread over several stripes, each on its own cache line, and
+ * every thread only updates its own stripe. Concurrent updates from different cores therefore do
+ * not contend on a single cache line. Reading the value sums the stripes, so get() is more
+ * expensive than Counter64::get() and is not a point-in-time snapshot with respect to concurrent
+ * updates.
+ */
+class StripedCounter64 {
+public:
+    /** Atomically increment the stripe of the calling thread. */
+    void increment(uint64_t n = 1) {
+        _stripes.local().fetchAndAddRelaxed(n);
+    }
+
+    /** Atomically decrement the stripe of the calling thread. */
+    void decrement(uint64_t n = 1) {
+        _stripes.local().fetchAndAddRelaxed(-static_cast<long long>(n));
+    }
+
+    /** Return the sum of all stripes. */
+    long long get() const {
+        long long sum = 0;
+        _stripes.forEach([&](const AtomicWord<long long>& stripe) { sum += stripe.loadRelaxed(); });
+        return sum;
+    }
+
+    operator long long() const {
+        return get();
+    }
+
+    /**
+     * Resets every stripe to zero. Updates that happen concurrently with the reset may or may not
+     * be lost.
+     */
+    void reset() {
+        _stripes.forEach([](AtomicWord<long long>& stripe) { stripe.store(0); });
+    }
+
+private:
+    Striped<AtomicWord<long long>> _stripes;
+};
 }  // namespace mongo
@@ -0,0 +1,83 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/base/counter.h"
+#include "mongo/util/processinfo.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Benchmark increments of a single counter shared by all threads executing the benchmark, as
+ * operation and network counters are. Counter64 is a single atomic word, so its throughput is
+ * limited by the cache line bouncing between the cores of the incrementing threads.
+ * StripedCounter64 is expected to scale with the number of threads instead.
+ */
+template <typename CounterType>
+void BM_CounterIncrement(benchmark::State& state) {
+    static CounterType counter;
+
+    for (auto keepRunning : state) {
+        counter.increment();
+    }
+    state.SetItemsProcessed(state.iterations());
+
+    if (state.thread_index == 0) {
+        benchmark::DoNotOptimize(counter.get());
+    }
+}
+
+/**
+ * Benchmark reads of a counter, as done by serverStatus and FTDC, while not being updated.
+ */
+template <typename CounterType>
+void BM_CounterGet(benchmark::State& state) {
+    CounterType counter;
+    counter.increment();
+
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(counter.get());
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_CounterIncrement, Counter64)
+    ->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+BENCHMARK_TEMPLATE(BM_CounterIncrement, StripedCounter64)
+    ->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+
+BENCHMARK_TEMPLATE(BM_CounterGet, Counter64);
+BENCHMARK_TEMPLATE(BM_CounterGet, StripedCounter64);
+
+}  // namespace
+}  // namespace mongo
@@ -32,8 +32,10 @@
 
 #include <climits>
 #include <iostream>
+#include <vector>
 
 #include "mongo/base/counter.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/unittest.h"
 
 namespace mongo {
@@ -55,5 +57,41 @@ TEST(CounterTest, Test1) {
     ASSERT_EQUALS(static_cast<long long>(c), 0);
 }
 
+TEST(CounterTest, StripedCounter) {
+    StripedCounter64 c;
+    ASSERT_EQUALS(c.get(), 0);
+    c.increment();
+    ASSERT_EQUALS(c.get(), 1);
+    c.decrement();
+    ASSERT_EQUALS(c.get(), 0);
+    c.decrement(3);
+    ASSERT_EQUALS(c.get(), -3);
+    c.increment(5);
+    ASSERT_EQUALS(static_cast<long long>(c), 2);
+    c.reset();
+    ASSERT_EQUALS(c.get(), 0);
+}
+
+TEST(CounterTest, StripedCounterConcurrentIncrements) {
+    constexpr int kThreads = 16;
+    constexpr int kIncrementsPerThread = 10000;
+
+    StripedCounter64 c;
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kIncrementsPerThread; ++j) {
+                c.increment();
+            }
+            c.decrement(kIncrementsPerThread / 2);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQUALS(c.get(), kThreads * kIncrementsPerThread / 2);
+}
+
 }  // namespace
 }  // namespace mongo
@@ -6383,6 +6383,106 @@ TEST_F(BSONColumnTest, Intermediate) {
 }
 
 
+TEST_F(BSONColumnTest, ContinueExistingBinary) {
+    std::vector<BSONElement> elems;
+    for (int i = 0; i < 200; ++i) {
+        elems.push_back(createElementInt64(i * i));
+    }
+
+    BSONColumnBuilder cb;
+    for (auto&& elem : elems) {
+        cb.append(elem);
+    }
+    auto binData = cb.finalize();
+
+    BSONColumnBuilder continued(static_cast<const char*>(binData.data), binData.length);
+    elems.push_back(createElementInt64(-1));
+    elems.push_back(BSONElement());
+    elems.push_back(createElementInt64(-1));
+    for (size_t i = 200; i < elems.size(); ++i) {
+        continued.append(elems[i]);
+    }
+    auto continuedBinData = continued.finalize();
+
+    // Everything but the EOO terminating the existing binary is kept as-is.
+    ASSERT_EQ(memcmp(binData.data, continuedBinData.data, binData.length - 1), 0);
+    verifyDecompression(continuedBinData, elems);
+}
+
+TEST_F(BSONColumnTest, TruncateExistingBinary) {
+    // Mix growing deltas, skips and a type change to get several literals and Simple-8b control
+    // blocks of both 64 and 128 bit selectors.
+    std::vector<BSONElement> elems;
+    for (int i = 0; i < 100; ++i) {
+        elems.push_back(i % 7 == 3 ? BSONElement() : createElementInt64(i * i * i));
+    }
+    for (int i = 0; i < 60; ++i) {
+        elems.push_back(i % 5 == 1 ? BSONElement() : createElementString(std::to_string(i)));
+    }
+    for (int i = 0; i < 5; ++i) {
+        elems.push_back(BSONElement());
+    }
+
+    BSONColumnBuilder cb;
+    for (auto&& elem : elems) {
+        cb.append(elem);
+    }
+    auto binData = cb.finalize();
+
+    for (int keep = 0; keep <= static_cast<int>(elems.size()) + 1; ++keep) {
+        BSONColumnBuilder truncated(static_cast<const char*>(binData.data), binData.length, keep);
+        std::vector<BSONElement> expected(elems.begin(),
+                                          elems.begin() + std::min<size_t>(keep, elems.size()));
+        verifyDecompression(truncated.intermediate(), expected);
+
+        // Appending after truncation must decode independently of the discarded elements.
+        expected.push_back(BSONElement());
+        expected.push_back(createElementString("appended"));
+        truncated.skip();
+        truncated.append(expected.back());
+        verifyDecompression(truncated.finalize(), expected);
+    }
+}
+
+TEST_F(BSONColumnTest, TruncateExistingInterleavedBinary) {
+    std::vector<BSONElement> elems = {
+        createElementInt32(1),
+        createElementObj(BSON("x" << 1 << "y" << 2)),
+        createElementObj(BSON("x" << 2 << "y" << 3)),
+        createElementObj(BSON("x" << 3 << "y" << 4)),
+        createElementInt32(2),
+        createElementInt32(3),
+    };
+
+    BSONColumnBuilder cb;
+    for (auto&& elem : elems) {
+        cb.append(elem);
+    }
+    auto binData = cb.finalize();
+
+    for (int keep = 0; keep <= static_cast<int>(elems.size()); ++keep) {
+        BSONColumnBuilder truncated(static_cast<const char*>(binData.data), binData.length, keep);
+        verifyDecompression(truncated.finalize(), {elems.begin(), elems.begin() + keep});
+    }
+}
+
+TEST_F(BSONColumnTest, TruncateExistingBinaryInvalidLiteral) {
+    BSONColumnBuilder cb;
+    cb.append(createElementString("a string literal"));
+    cb.append(createRegex("ab"));
+    auto binData = cb.finalize();
+    const char* binary = static_cast<const char*>(binData.data);
+    int stringSize = BSONElement(binary, 1, -1).size();
+
+    // The length of the string literal is cut off.
+    ASSERT_THROWS_CODE(BSONColumnBuilder(binary, 3, 1), DBException, 9393802);
+    // The string literal extends past the end of the binary.
+    ASSERT_THROWS_CODE(BSONColumnBuilder(binary, stringSize - 1, 1), DBException, 9393805);
+    // The pattern and options of the regex literal are not terminated.
+    ASSERT_THROWS_CODE(BSONColumnBuilder(binary, stringSize + 2, 2), DBException, 9393803);
+    ASSERT_THROWS_CODE(BSONColumnBuilder(binary, binData.length - 2, 2), DBException, 9393804);
+}
+
 // The large literal emits this on Visual Studio: Fatal error C1091: compiler limit: string exceeds
 // 65535 bytes in length
 #if !defined(_MSC_VER) || _MSC_VER >= 1929
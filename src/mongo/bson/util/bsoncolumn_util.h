@@ -41,6 +41,11 @@ inline bool isLiteralControlByte(char control) {
     return (control & 0xE0) == 0;
 }
 
+inline bool isInterleavedStartControlByte(char control) {
+    return control == kInterleavedStartControlByteLegacy ||
+        control == kInterleavedStartControlByte || control == kInterleavedStartArrayRootControlByte;
+}
+
 inline uint8_t numSimple8bBlocksForControlByte(char control) {
     return (control & 0x0F) + 1;
 }
@@ -30,11 +30,14 @@
 #include "mongo/bson/util/bsoncolumnbuilder.h"
 
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/util/bsoncolumn.h"
 #include "mongo/bson/util/bsoncolumn_util.h"
 
 #include "mongo/bson/util/simple8b.h"
 #include "mongo/bson/util/simple8b_type_util.h"
 
+#include <cstring>
+#include <limits>
 #include <memory>
 
 namespace mongo {
@@ -287,6 +290,43 @@ BSONObj mergeObj(const BSONObj& reference, const BSONObj& obj) {
     return builder.obj();
 }
 
+// Returns the size of the literal at 'pos', a BSONElement without field name, after checking that
+// the bytes its size is computed from and the literal itself are before 'end'.
+int literalSize(const char* pos, const char* end) {
+    switch (static_cast<BSONType>(*pos)) {
+        case String:
+        case Object:
+        case Array:
+        case BinData:
+        case DBRef:
+        case Code:
+        case Symbol:
+        case CodeWScope:
+            // The size is read from the int32 length following the type byte.
+            uassert(9393802,
+                    "Invalid BSON Column encoding",
+                    end - pos > static_cast<std::ptrdiff_t>(1 + sizeof(int32_t)));
+            break;
+        case RegEx: {
+            // The size is computed by scanning the pattern and the options, both null-terminated.
+            const char* pattern = pos + 1;
+            const char* patternEnd = static_cast<const char*>(memchr(pattern, 0, end - pattern));
+            uassert(9393803, "Invalid BSON Column encoding", patternEnd);
+            const char* options = patternEnd + 1;
+            uassert(9393804,
+                    "Invalid BSON Column encoding",
+                    options < end && memchr(options, 0, end - options));
+            break;
+        }
+        default:
+            break;
+    }
+
+    int size = BSONElement(pos, 1, -1).size();
+    uassert(9393805, "Invalid BSON Column encoding", size > 0 && size < end - pos);
+    return size;
+}
+
 }  // namespace
 
 BSONColumnBuilder::BSONColumnBuilder() : BSONColumnBuilder(BufBuilder()) {}
@@ -296,6 +336,87 @@ BSONColumnBuilder::BSONColumnBuilder(BufBuilder builder) : _bufBuilder(std::move
     _is.regular.init(&_bufBuilder, nullptr);
 }
 
+BSONColumnBuilder::BSONColumnBuilder(const char* binary,
+                                     int size,
+                                     boost::optional<int> numElementsToKeep)
+    : BSONColumnBuilder() {
+    const char* pos = binary;
+    const char* end = binary + size;
+    int limit = numElementsToKeep.value_or(std::numeric_limits<int>::max());
+    int numCopied = 0;
+
+    // Type of the last literal, it determines whether the Simple-8b blocks following it are
+    // encoded with 64 or 128 bit selectors.
+    BSONType lastLiteralType = EOO;
+
+    // Position and element index of the last copied literal. Decoding state is reset by a literal
+    // so the elements following the copied blocks can be decompressed starting from here.
+    const char* lastLiteralPos = binary;
+    int lastLiteralIndex = 0;
+
+    // Find the longest run of complete control blocks in regular mode that fit within the elements
+    // to keep. These can be copied as-is as they do not depend on anything that follows them.
+    while (pos < end && *pos != EOO) {
+        char control = *pos;
+        if (isInterleavedStartControlByte(control)) {
+            break;
+        }
+
+        int blockSize;
+        int blockCount = 0;
+        BSONType blockLiteralType = lastLiteralType;
+        if (isLiteralControlByte(control)) {
+            blockSize = literalSize(pos, end);
+            blockCount = 1;
+            blockLiteralType = static_cast<BSONType>(control);
+        } else {
+            blockSize = 1 + sizeof(uint64_t) * numSimple8bBlocksForControlByte(control);
+            uassert(9393800, "Invalid BSON Column encoding", pos + blockSize < end);
+            auto countValues = [&](const auto& simple8b) {
+                for (auto it = simple8b.begin(), itEnd = simple8b.end(); it != itEnd; ++it) {
+                    ++blockCount;
+                }
+            };
+            if (uses128bit(lastLiteralType)) {
+                countValues(Simple8b<uint128_t>(pos + 1, blockSize - 1));
+            } else {
+                countValues(Simple8b<uint64_t>(pos + 1, blockSize - 1));
+            }
+        }
+
+        if (numCopied + blockCount > limit) {
+            break;
+        }
+        if (isLiteralControlByte(control)) {
+            lastLiteralPos = pos;
+            lastLiteralIndex = numCopied;
+        }
+        numCopied += blockCount;
+        lastLiteralType = blockLiteralType;
+        pos += blockSize;
+    }
+    uassert(9393801, "Invalid BSON Column encoding", pos < end);
+
+    _bufBuilder.appendBuf(binary, pos - binary);
+
+    // Skips appended before the next literal are decoded with the selectors of the last copied
+    // literal, make sure we encode them the same way.
+    _is.regular._storeWith128 = uses128bit(lastLiteralType);
+
+    // Decompress and re-append the remaining elements to keep, if we did not reach the end. Only
+    // the part of the binary following the last copied literal needs to be decoded.
+    if (*pos != EOO && numCopied < limit) {
+        BSONColumn column(lastLiteralPos, end - lastLiteralPos);
+        int index = lastLiteralIndex;
+        for (auto it = column.begin(), itEnd = column.end(); it != itEnd && index < limit;
+             ++it, ++index) {
+            if (index >= numCopied) {
+                append(*it);
+            }
+        }
+    }
+}
+
 BSONColumnBuilder& BSONColumnBuilder::append(BSONElement elem) {
     auto type = elem.type();
     uassert(ErrorCodes::InvalidBSONType,
@@ -50,6 +50,21 @@ public:
     BSONColumnBuilder();
     explicit BSONColumnBuilder(BufBuilder builder);
 
+    /**
+     * Constructs a BSONColumnBuilder that continues the existing BSON Column binary in 'binary',
+     * keeping only its first 'numElementsToKeep' elements, or all of them if boost::none.
+     *
+     * Complete control blocks before the truncation point are copied verbatim instead of being
+     * decompressed and re-encoded. The elements to keep after them, from a control block
+     * straddling the truncation point or the first interleaved section on, are appended again.
+     * Decompression of these starts at the last copied literal, the blocks before it are not
+     * decoded.
+     * Further appends are encoded relative to a new literal.
+     */
+    BSONColumnBuilder(const char* binary,
+                      int size,
+                      boost::optional<int> numElementsToKeep = boost::none);
+
     /**
      * Appends a BSONElement to this BSONColumnBuilder.
      *
@@ -167,7 +167,8 @@ void ClientCursor::dispose(OperationContext* opCtx, boost::optional<Date_t> now)
                                      _queryStatsStoreKey,
                                      std::move(_queryStatsRequestShapifier),
                                      _metrics.executionTime.value_or(Microseconds{0}).count(),
-                                     _metrics.nreturned.value_or(0));
+                                     _metrics.nreturned.value_or(0),
+                                     _metrics.phaseTimes);
     }
 
     if (now) {
@@ -397,8 +398,26 @@ void startClientCursorMonitor() {
     getClientCursorMonitor(getGlobalServiceContext()).go();
 }
 
+namespace {
+
+/**
+ * Returns the phase breakdown to record in query stats, including the storage read time when the
+ * storage statistics of the operation can be gathered.
+ */
+OperationPhaseTimes getQueryStatsPhaseTimes(OperationContext* opCtx) {
+    auto curOp = CurOp::get(opCtx);
+    curOp->gatherStorageStatsIfLocked();
+    return curOp->debug().getPhaseTimes(opCtx);
+}
+
+}  // namespace
+
 void collectQueryStatsMongod(OperationContext* opCtx, ClientCursorPin& pinnedCursor) {
-    pinnedCursor->incrementCursorMetrics(CurOp::get(opCtx)->debug().additiveMetrics);
+    auto& opDebug = CurOp::get(opCtx)->debug();
+    opDebug.additiveMetrics.phaseTimes = pinnedCursor->hasQueryStatsStoreKey()
+        ? getQueryStatsPhaseTimes(opCtx)
+        : OperationPhaseTimers::get(opCtx)->snapshot();
+    pinnedCursor->incrementCursorMetrics(opDebug.additiveMetrics);
 }
 
 void collectQueryStatsMongod(OperationContext* opCtx,
@@ -406,13 +425,18 @@ void collectQueryStatsMongod(OperationContext* opCtx,
     // If we haven't registered a cursor to prepare for getMore requests, we record
     // telemetry directly.
     auto& opDebug = CurOp::get(opCtx)->debug();
+    if (!opDebug.queryStatsStoreKeyHash) {
+        return;
+    }
+    opDebug.additiveMetrics.phaseTimes = getQueryStatsPhaseTimes(opCtx);
     query_stats::writeQueryStats(
         opCtx,
         opDebug.queryStatsStoreKeyHash,
         opDebug.queryStatsStoreKey,
         std::move(requestShapifier),
         opDebug.additiveMetrics.executionTime.value_or(Microseconds{0}).count(),
-        opDebug.additiveMetrics.nreturned.value_or(0));
+        opDebug.additiveMetrics.nreturned.value_or(0),
+        opDebug.additiveMetrics.phaseTimes);
 }
 
 }  // namespace mongo
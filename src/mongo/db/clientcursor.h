@@ -211,6 +211,13 @@ public:
         _metrics.add(newMetrics);
     }
 
+    /**
+     * Returns whether the metrics of this cursor are recorded in query stats.
+     */
+    bool hasQueryStatsStoreKey() const {
+        return _queryStatsStoreKeyHash.has_value();
+    }
+
     /**
      * Returns the number of batches returned by this cursor so far.
      */
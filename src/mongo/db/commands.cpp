@@ -48,6 +48,7 @@
 #include "mongo/db/error_labels.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/db/read_write_concern_defaults.h"
 #include "mongo/idl/command_generic_argument.h"
 #include "mongo/idl/idl_parser.h"
@@ -61,6 +62,7 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/database_name_util.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/sampling_profiler.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kCommand
@@ -183,7 +185,11 @@ void CommandHelpers::runCommandInvocation(OperationContext* opCtx,
         hooks->onBeforeRun(opCtx, request, invocation);
     }
 
-    invocation->run(opCtx, response);
+    {
+        ScopedSampleAttribution sampleAttribution(invocation->definition()->getName());
+        ScopedOperationPhaseTimer executeTimer(opCtx, OperationPhase::kExecute);
+        invocation->run(opCtx, response);
+    }
 
     if (hooks) {
         hooks->onAfterRun(opCtx, request, invocation, response);
@@ -37,6 +37,7 @@
 
 #include "mongo/base/init.h"
 #include "mongo/base/status.h"
+#include "mongo/base/counter.h"
 #include "mongo/base/status_with.h"
 #include "mongo/db/api_parameters.h"
 #include "mongo/db/auth/privilege.h"
@@ -57,6 +58,7 @@
 #include "mongo/transport/service_executor.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/future.h"
+#include "mongo/util/hdr_histogram.h"
 #include "mongo/util/string_map.h"
 
 namespace mongo {
@@ -584,6 +586,20 @@ public:
         _commandsFailed.increment();
     }
 
+    /**
+     * Records the latency, in microseconds, of one user operation that ran this command.
+     */
+    void recordLatency(uint64_t micros) const {
+        _latencyHistogram.local().record(micros);
+    }
+
+    /**
+     * Merges the latencies recorded for this command on every stripe into 'histogram'.
+     */
+    void mergeLatencyHistogramInto(HdrHistogram* histogram) const {
+        _latencyHistogram.forEach([&](const HdrHistogram& stripe) { histogram->merge(stripe); });
+    }
+
     /**
      * Generates a reply from the 'help' information associated with a command. The state of
      * the passed ReplyBuilder will be in kOutputDocs after calling this method.
@@ -677,6 +693,11 @@ private:
     // Counters for how many times this command has been executed and failed
     CounterMetric _commandsExecuted;
     CounterMetric _commandsFailed;
+
+    // Latencies of the user operations that ran this command, reported in
+    // serverStatus.opLatencies.byCommand. Striped per core, since the same command runs on many
+    // threads at once.
+    mutable Striped<HdrHistogram> _latencyHistogram;
 };
 
 /**
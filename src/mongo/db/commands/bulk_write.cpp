@@ -340,14 +340,7 @@ void finishCurOp(OperationContext* opCtx, CurOp* curOp) {
         curOp->debug().additiveMetrics.executionTime = executionTimeMicros;
 
         recordCurOpMetrics(opCtx);
-        Top::get(opCtx->getServiceContext())
-            .record(opCtx,
-                    curOp->getNS(),
-                    curOp->getLogicalOp(),
-                    Top::LockType::WriteLocked,
-                    durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses()),
-                    curOp->isCommand(),
-                    curOp->getReadWriteType());
+        write_ops_exec::recordWriteInTop(opCtx, curOp->getNSS(), curOp->getLogicalOp());
 
         if (!curOp->debug().errInfo.isOK()) {
             LOGV2_DEBUG(
@@ -62,7 +62,6 @@
 #include "mongo/db/s/query_analysis_writer.h"
 #include "mongo/db/stats/counters.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
-#include "mongo/db/stats/top.h"
 #include "mongo/db/storage/duplicate_key_error_info.h"
 #include "mongo/db/timeseries/timeseries_update_delete_util.h"
 #include "mongo/db/transaction/retryable_writes_stats.h"
@@ -204,14 +203,7 @@ void assertCanWrite_inlock(OperationContext* opCtx, const NamespaceString& nss)
 
 void recordStatsForTopCommand(OperationContext* opCtx) {
     auto curOp = CurOp::get(opCtx);
-    Top::get(opCtx->getClient()->getServiceContext())
-        .record(opCtx,
-                curOp->getNS(),
-                curOp->getLogicalOp(),
-                Top::LockType::WriteLocked,
-                durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses()),
-                curOp->isCommand(),
-                curOp->getReadWriteType());
+    write_ops_exec::recordWriteInTop(opCtx, curOp->getNSS(), curOp->getLogicalOp());
 }
 
 void checkIfTransactionOnCappedColl(const CollectionPtr& coll, bool inTransaction) {
@@ -0,0 +1,167 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/auth/authorization_session.h"
+#include "mongo/db/commands.h"
+#include "mongo/db/commands/sampling_profiler_gen.h"
+#include "mongo/util/sampling_profiler.h"
+
+namespace mongo {
+namespace {
+
+void checkSamplingProfilerAuthorization(OperationContext* opCtx) {
+    uassert(ErrorCodes::Unauthorized,
+            "Unauthorized",
+            AuthorizationSession::get(opCtx->getClient())
+                ->isAuthorizedForPrivilege(Privilege{ResourcePattern::forClusterResource(),
+                                                     ActionType::samplingProfiler}));
+}
+
+class StartSamplingProfilerCommand final : public TypedCommand<StartSamplingProfilerCommand> {
+public:
+    using Request = StartSamplingProfiler;
+
+    class Invocation final : public InvocationBase {
+    public:
+        using InvocationBase::InvocationBase;
+
+        void typedRun(OperationContext* opCtx) {
+            SamplingProfiler::Options options;
+            options.samplesPerSecond = request().getSamplesPerSecond();
+            SamplingProfiler::get().start(options);
+        }
+
+    private:
+        bool supportsWriteConcern() const override {
+            return false;
+        }
+
+        void doCheckAuthorization(OperationContext* opCtx) const override {
+            checkSamplingProfilerAuthorization(opCtx);
+        }
+
+        NamespaceString ns() const override {
+            return NamespaceString(request().getDbName());
+        }
+    };
+
+    bool adminOnly() const override {
+        return true;
+    }
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+} startSamplingProfilerCommand;
+
+class StopSamplingProfilerCommand final : public TypedCommand<StopSamplingProfilerCommand> {
+public:
+    using Request = StopSamplingProfiler;
+
+    class Invocation final : public InvocationBase {
+    public:
+        using InvocationBase::InvocationBase;
+
+        void typedRun(OperationContext* opCtx) {
+            SamplingProfiler::get().stop();
+        }
+
+    private:
+        bool supportsWriteConcern() const override {
+            return false;
+        }
+
+        void doCheckAuthorization(OperationContext* opCtx) const override {
+            checkSamplingProfilerAuthorization(opCtx);
+        }
+
+        NamespaceString ns() const override {
+            return NamespaceString(request().getDbName());
+        }
+    };
+
+    bool adminOnly() const override {
+        return true;
+    }
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+} stopSamplingProfilerCommand;
+
+class GetSamplingProfileCommand final : public TypedCommand<GetSamplingProfileCommand> {
+public:
+    using Request = GetSamplingProfile;
+    using Reply = typename GetSamplingProfile::Reply;
+
+    class Invocation final : public InvocationBase {
+    public:
+        using InvocationBase::InvocationBase;
+
+        Reply typedRun(OperationContext* opCtx) {
+            auto report =
+                SamplingProfiler::get().report(request().getLimit(), request().getReset());
+
+            Reply reply;
+            reply.setRunning(report.running);
+            reply.setSamplesPerSecond(report.samplesPerSecond);
+            reply.setSamples(static_cast<long long>(report.samples));
+            reply.setDroppedSamples(static_cast<long long>(report.droppedSamples));
+            reply.setStacks(std::move(report.stacks));
+            return reply;
+        }
+
+    private:
+        bool supportsWriteConcern() const override {
+            return false;
+        }
+
+        void doCheckAuthorization(OperationContext* opCtx) const override {
+            checkSamplingProfilerAuthorization(opCtx);
+        }
+
+        NamespaceString ns() const override {
+            return NamespaceString(request().getDbName());
+        }
+    };
+
+    bool adminOnly() const override {
+        return true;
+    }
+
+    AllowedOnSecondary secondaryAllowed(ServiceContext*) const override {
+        return AllowedOnSecondary::kAlways;
+    }
+} getSamplingProfileCommand;
+
+}  // namespace
+}  // namespace mongo
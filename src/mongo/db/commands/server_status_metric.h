@@ -184,18 +184,19 @@ T& makeServerStatusMetric(std::string path, std::function<bool()> predicate) {
         .value();
 }
 
+/**
+ * A serverStatus counter. CounterMetrics are mostly updated on hot paths and only read by
+ * serverStatus and FTDC, so they are backed by a StripedCounter64.
+ */
 class CounterMetric {
 public:
-    CounterMetric(const std::string& name) : _counter{makeServerStatusMetric<Counter64>(name)} {}
+    CounterMetric(const std::string& name)
+        : _counter{makeServerStatusMetric<StripedCounter64>(name)} {}
     CounterMetric(const std::string& name, std::function<bool()>&& predicate)
-        : _counter{makeServerStatusMetric<Counter64>(name, std::move(predicate))} {}
+        : _counter{makeServerStatusMetric<StripedCounter64>(name, std::move(predicate))} {}
     CounterMetric(CounterMetric&) = delete;
     CounterMetric& operator=(CounterMetric&) = delete;
 
-    operator Counter64&() {
-        return _counter;
-    }
-
     /**
      * replicates the same public interface found in Counter64.
      */
@@ -226,7 +227,7 @@ public:
     }
 
 private:
-    Counter64& _counter;
+    StripedCounter64& _counter;
 };
 
 /**
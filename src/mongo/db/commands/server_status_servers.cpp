@@ -29,6 +29,7 @@
 
 #include "mongo/config.h"
 #include "mongo/db/commands/server_status.h"
+#include "mongo/logv2/file_rotate_sink.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/transport/service_executor_fixed.h"
@@ -102,6 +103,28 @@ public:
 
 } network;
 
+class AsyncLogWriter : public ServerStatusSection {
+public:
+    AsyncLogWriter() : ServerStatusSection("asyncLogWriter") {}
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        auto stats = logv2::FileRotateSink::asyncWriteStats();
+
+        BSONObjBuilder b;
+        b.append("queuedLines", stats.queuedLines);
+        b.append("writtenLines", stats.writtenLines);
+        b.append("droppedLines", stats.droppedLines);
+        b.append("blockedWrites", stats.blockedWrites);
+        return b.obj();
+    }
+
+} asyncLogWriter;
+
 class Security : public ServerStatusSection {
 public:
     Security() : ServerStatusSection("security") {}
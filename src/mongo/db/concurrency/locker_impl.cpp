@@ -34,6 +34,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/json.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/flow_control.h"
 #include "mongo/db/storage/ticketholder_manager.h"
@@ -399,6 +400,7 @@ bool LockerImpl::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t d
         // hole.
         invariant(!opCtx->recoveryUnit()->isTimestamped());
 
+        ScopedOperationPhaseTimer ticketWaitTimer(opCtx, OperationPhase::kTicketWait);
         if (auto ticket = holder->waitForTicketUntil(
                 _uninterruptibleLocksRequested ? nullptr : opCtx, &_admCtx, deadline)) {
             _ticket = std::move(*ticket);
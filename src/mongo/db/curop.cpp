@@ -43,6 +43,8 @@
 #include "mongo/db/query/getmore_command_gen.h"
 #include "mongo/db/query/plan_summary_stats.h"
 #include "mongo/db/server_options.h"
+#include "mongo/db/shape_rate_limiter.h"
+#include "mongo/db/shape_rate_limiter_gen.h"
 #include "mongo/db/stats/timer_stats.h"
 #include "mongo/db/storage/storage_engine_feature_flags_gen.h"
 #include "mongo/logv2/log.h"
@@ -505,10 +507,22 @@ bool CurOp::completeAndLogOperation(logv2::LogComponent component,
         shouldProfileAtLevel1 = shouldLogSlowOp && shouldSample;
     }
 
+    // Whether this operation should also be added to the profiler.
+    // rateLimit only affects profiler at level 2
+    bool shouldProfile = _dbprofile >= 2 ? _shouldDBProfileWithRateLimit(slowMs)
+                                         : _dbprofile >= 1 && shouldProfileAtLevel1;
+
+    // The per-shape rate limit applies to slow operation logging and profiling alike, so that a
+    // single slow query shape does not flood both.
+    if (!forceLog && (shouldLogSlowOp || shouldProfile) && !_admitByShapeRateLimit()) {
+        shouldLogSlowOp = false;
+        shouldProfile = false;
+    }
+
     // Defer calculating the CPU time until we know that we actually are going to write it to
     // the logs or profiler. The CPU time may have been determined earlier if it was a dependency
     // of 'filter' in which case this is a no-op.
-    if (forceLog || shouldLogSlowOp || _dbprofile >= 2) {
+    if (forceLog || shouldLogSlowOp || shouldProfile) {
         calculateCpuTime();
     }
 
@@ -566,13 +580,7 @@ bool CurOp::completeAndLogOperation(logv2::LogComponent component,
         _checkForFailpointsAfterCommandLogged();
     }
 
-    // Return 'true' if this operation should also be added to the profiler.
-    // rateLimit only affects profiler at level 2
-    if (_dbprofile >= 2)
-        return _shouldDBProfileWithRateLimit(slowMs);
-    if (_dbprofile <= 0)
-        return false;
-    return shouldProfileAtLevel1;
+    return shouldProfile;
 }
 
 std::string CurOp::getNS() const {
@@ -818,6 +826,10 @@ void CurOp::reportState(BSONObjBuilder* builder,
 
     builder->append("numYields", _numYields.load());
 
+    if (auto phaseTimes = OperationPhaseTimers::get(opCtx)->snapshot(); !phaseTimes.empty()) {
+        builder->append("phaseMicros", phaseTimes.toBSON());
+    }
+
     if (_debug.dataThroughputLastSecond) {
         builder->append("dataThroughputLastSecond", *_debug.dataThroughputLastSecond);
     }
@@ -870,6 +882,30 @@ bool CurOp::_shouldDBProfileWithRateLimit(long long slowMS) {
     return true;
 }
 
+bool CurOp::_admitByShapeRateLimit() {
+    const auto tokensPerSecond = gProfilingRateLimitPerShape.load();
+    if (tokensPerSecond <= 0) {
+        return true;
+    }
+
+    // Operations without a query shape, like commands other than queries, are told apart by
+    // namespace and command only.
+    const auto ns = getNS();
+    const auto command = isCommand() && getCommand() ? StringData(getCommand()->getName())
+                                                     : StringData(logicalOpToString(_logicalOp));
+
+    auto opCtx = this->opCtx();
+    auto decision = ShapeRateLimiter::get(opCtx->getServiceContext())
+                        .admit({ns, command, _debug.queryHash},
+                               opCtx->getServiceContext()->getFastClockSource()->now(),
+                               tokensPerSecond,
+                               gProfilingRateLimitBurst.load());
+    if (decision.admitted) {
+        _debug.suppressedSimilarOps = decision.suppressedSinceAdmitted;
+    }
+    return decision.admitted;
+}
+
 namespace {
 StringData getProtoString(int op) {
     if (op == dbMsg) {
@@ -1048,6 +1084,10 @@ void OpDebug::report(OperationContext* opCtx,
         pAttrs->addDeepCopy("planCacheKey", zeroPaddedHex(*planCacheKey));
     }
 
+    if (suppressedSimilarOps > 0) {
+        pAttrs->add("suppressedSimilarOps", suppressedSimilarOps);
+    }
+
     switch (queryFramework) {
         case PlanExecutor::QueryFramework::kClassicOnly:
         case PlanExecutor::QueryFramework::kClassicHybrid:
@@ -1133,6 +1173,10 @@ void OpDebug::report(OperationContext* opCtx,
         pAttrs->add("storage", storageStats->toBSON());
     }
 
+    if (auto phaseTimes = getPhaseTimes(opCtx); !phaseTimes.empty()) {
+        pAttrs->add("phaseMicros", phaseTimes.toBSON());
+    }
+
     if (operationMetrics) {
         BSONObjBuilder builder;
         operationMetrics->toBsonNonZeroFields(&builder);
@@ -1253,6 +1297,10 @@ void OpDebug::append(OperationContext* opCtx,
         b.append("planCacheKey", zeroPaddedHex(*planCacheKey));
     }
 
+    if (suppressedSimilarOps > 0) {
+        b.append("suppressedSimilarOps", suppressedSimilarOps);
+    }
+
     switch (queryFramework) {
         case PlanExecutor::QueryFramework::kClassicOnly:
         case PlanExecutor::QueryFramework::kClassicHybrid:
@@ -1310,6 +1358,10 @@ void OpDebug::append(OperationContext* opCtx,
         b.append("storage", storageStats->toBSON());
     }
 
+    if (auto phaseTimes = getPhaseTimes(opCtx); !phaseTimes.empty()) {
+        b.append("phaseMicros", phaseTimes.toBSON());
+    }
+
     if (!errInfo.isOK()) {
         b.appendNumber("ok", 0.0);
         if (!errInfo.reason().empty()) {
@@ -1361,6 +1413,23 @@ void OpDebug::append(OperationContext* opCtx,
     }
 }
 
+void CurOp::gatherStorageStatsIfLocked() {
+    auto opCtx = this->opCtx();
+    if (_debug.storageStats || !opCtx->lockState()->isLocked() ||
+        !opCtx->getServiceContext()->getStorageEngine()) {
+        return;
+    }
+    _debug.storageStats = opCtx->recoveryUnit()->computeOperationStatisticsSinceLastCall();
+}
+
+OperationPhaseTimes OpDebug::getPhaseTimes(OperationContext* opCtx) const {
+    auto phaseTimes = OperationPhaseTimers::get(opCtx)->snapshot();
+    if (storageStats) {
+        phaseTimes.add(OperationPhase::kStorageRead, storageStats->timeReadingStorage());
+    }
+    return phaseTimes;
+}
+
 void OpDebug::appendUserInfo(const CurOp& c,
                              BSONObjBuilder& builder,
                              AuthorizationSession* authSession) {
@@ -1619,6 +1688,12 @@ std::function<BSONObj(ProfileFilter::Args)> OpDebug::appendStaged(StringSet requ
         }
     });
 
+    addIfNeeded("phaseMicros", [](auto field, auto args, auto& b) {
+        if (auto phaseTimes = args.op.getPhaseTimes(args.opCtx); !phaseTimes.empty()) {
+            b.append(field, phaseTimes.toBSON());
+        }
+    });
+
     // Don't short-circuit: call needs() for every supported field, so that at the end we can
     // uassert that no unsupported fields were requested.
     bool needsOk = needs("ok");
@@ -1859,6 +1934,7 @@ void OpDebug::AdditiveMetrics::add(const AdditiveMetrics& otherMetrics) {
     writeConflicts.fetchAndAdd(otherMetrics.writeConflicts.load());
     temporarilyUnavailableErrors.fetchAndAdd(otherMetrics.temporarilyUnavailableErrors.load());
     executionTime = addOptionals(executionTime, otherMetrics.executionTime);
+    phaseTimes.add(otherMetrics.phaseTimes);
 }
 
 void OpDebug::AdditiveMetrics::reset() {
@@ -1877,6 +1953,7 @@ void OpDebug::AdditiveMetrics::reset() {
     writeConflicts.store(0);
     temporarilyUnavailableErrors.store(0);
     executionTime = boost::none;
+    phaseTimes.reset();
 }
 
 bool OpDebug::AdditiveMetrics::equals(const AdditiveMetrics& otherMetrics) const {
@@ -1889,7 +1966,7 @@ bool OpDebug::AdditiveMetrics::equals(const AdditiveMetrics& otherMetrics) const
         prepareReadConflicts.load() == otherMetrics.prepareReadConflicts.load() &&
         writeConflicts.load() == otherMetrics.writeConflicts.load() &&
         temporarilyUnavailableErrors.load() == otherMetrics.temporarilyUnavailableErrors.load() &&
-        executionTime == otherMetrics.executionTime;
+        executionTime == otherMetrics.executionTime && phaseTimes == otherMetrics.phaseTimes;
 }
 
 void OpDebug::AdditiveMetrics::incrementWriteConflicts(long long n) {
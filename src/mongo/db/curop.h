@@ -37,6 +37,7 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/cursor_id.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/db/profile_filter.h"
 #include "mongo/db/query/request_shapifier.h"
 #include "mongo/db/server_options.h"
@@ -193,6 +194,10 @@ public:
 
         // Amount of time spent executing a query.
         boost::optional<Microseconds> executionTime;
+
+        // Time spent in each phase of the operation(s), copied from OperationPhaseTimers when the
+        // metrics are collected for query stats. Not included in report().
+        OperationPhaseTimes phaseTimes;
     };
 
     OpDebug() = default;
@@ -217,6 +222,13 @@ public:
                                                                          bool needWholeDocument);
     static void appendUserInfo(const CurOp&, BSONObjBuilder&, AuthorizationSession*);
 
+    /**
+     * Returns the time the operation spent in each phase. The storage read time is only known once
+     * 'storageStats' has been gathered, i.e. for operations which are logged, profiled or recorded
+     * in query stats.
+     */
+    OperationPhaseTimes getPhaseTimes(OperationContext* opCtx) const;
+
     /**
      * Copies relevant plan summary metrics to this OpDebug instance.
      */
@@ -333,6 +345,10 @@ public:
     // Stores the duration of time spent blocked on prepare conflicts.
     Milliseconds prepareConflictDurationMillis{0};
 
+    // Number of operations of the same shape suppressed by profilingRateLimitPerShape since the
+    // last one which was logged or profiled.
+    long long suppressedSimilarOps{0};
+
     // Total time spent looking up database entry in the local catalog cache, including eventual
     // refreshes.
     Milliseconds catalogCacheDatabaseLookupMillis{0};
@@ -492,6 +508,13 @@ public:
                                  boost::optional<long long> slowMsOverride = boost::none,
                                  bool forceLog = false);
 
+    /**
+     * Gathers the storage statistics of the operation into 'debug().storageStats', unless they
+     * are already known or the operation does not hold the global lock, which protects the read
+     * against shutdown. The statistics are then reused when the operation is logged or profiled.
+     */
+    void gatherStorageStatsIfLocked();
+
     bool haveOpDescription() const {
         return !_opDescription.isEmpty();
     }
@@ -803,6 +826,8 @@ public:
         if (debug().planningTime == Microseconds{0} && start != 0) {
             _queryPlanningEnd = _tickSource->getTicks();
             debug().planningTime = computeElapsedTimeTotal(start, _queryPlanningEnd.load());
+            OperationPhaseTimers::get(opCtx())->record(OperationPhase::kPlan,
+                                                       debug().planningTime);
         }
     }
 
@@ -989,6 +1014,10 @@ private:
     // so calling this method on other levels is not necessary.
     bool _shouldDBProfileWithRateLimit(long long slowMS);
 
+    // Applies profilingRateLimitPerShape to an operation which is about to be logged as slow or
+    // profiled. Returns false if it must be suppressed.
+    bool _admitByShapeRateLimit();
+
     static const OperationContext::Decoration<CurOpStack> _curopStack;
 
     // The stack containing this CurOp instance.
@@ -50,6 +50,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/platform/random.h"
 #include "mongo/util/exit.h"
+#include "mongo/util/sampling_profiler.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
 
@@ -216,6 +217,9 @@ StatusWith<ClientCursorPin> CursorManager::pinCursor(
 
     // Pass along queryStats context so it is retrievable after query execution for storing metrics.
     CurOp::get(opCtx)->debug().queryStatsStoreKeyHash = cursor->_queryStatsStoreKeyHash;
+    if (cursor->_queryStatsStoreKeyHash) {
+        ScopedSampleAttribution::setQueryShapeHash(*cursor->_queryStatsStoreKeyHash);
+    }
     // TODO: SERVER-73152 remove queryStatsStoreKey when RequestShapifier is used for agg.
     CurOp::get(opCtx)->debug().queryStatsStoreKey = cursor->_queryStatsStoreKey;
 
@@ -288,13 +288,34 @@ AutoStatsTracker::AutoStatsTracker(
     LogMode logMode,
     int dbProfilingLevel,
     Date_t deadline,
-    const std::vector<NamespaceStringOrUUID>& secondaryNssOrUUIDVector)
-    : _opCtx(opCtx), _lockType(lockType), _logMode(logMode) {
-    // Deduplicate all namespaces for Top reporting on destruct.
-    _nssSet.insert(nss);
-    auto catalog = CollectionCatalog::get(opCtx);
-    for (auto&& secondaryNssOrUUID : secondaryNssOrUUIDVector) {
-        _nssSet.insert(catalog->resolveNamespaceStringOrUUID(opCtx, secondaryNssOrUUID));
+    const std::vector<NamespaceStringOrUUID>& secondaryNssOrUUIDVector,
+    const CollectionPtr* collection)
+    : _opCtx(opCtx), _lockType(lockType), _logMode(logMode), _nss(nss), _collection(collection) {
+    if (_logMode != LogMode::kUpdateCurOp) {
+        // Deduplicate all namespaces and resolve their Top statistics now, so that reporting on
+        // destruct does not need to look them up again. The statistics of the collection the
+        // caller holds are cached on the collection and resolved on destruct instead.
+        std::set<NamespaceString> nssSet;
+        if (!_collection) {
+            nssSet.insert(nss);
+        }
+        if (!secondaryNssOrUUIDVector.empty()) {
+            auto catalog = CollectionCatalog::get(opCtx);
+            for (auto&& secondaryNssOrUUID : secondaryNssOrUUIDVector) {
+                auto secondaryNss =
+                    catalog->resolveNamespaceStringOrUUID(opCtx, secondaryNssOrUUID);
+                if (!_collection || secondaryNss != nss) {
+                    nssSet.insert(std::move(secondaryNss));
+                }
+            }
+        }
+
+        auto& top = Top::get(opCtx->getServiceContext());
+        for (const auto& trackedNss : nssSet) {
+            if (auto coll = top.getCollectionData(trackedNss.ns())) {
+                _collectionData.push_back(std::move(coll));
+            }
+        }
     }
 
     if (_logMode == LogMode::kUpdateTop) {
@@ -312,14 +333,27 @@ AutoStatsTracker::~AutoStatsTracker() {
 
     // Update stats for each namespace.
     auto curOp = CurOp::get(_opCtx);
-    Top::get(_opCtx->getServiceContext())
-        .record(_opCtx,
-                _nssSet,
-                curOp->getLogicalOp(),
-                _lockType,
-                durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses()),
-                curOp->isCommand(),
-                curOp->getReadWriteType());
+    auto& top = Top::get(_opCtx->getServiceContext());
+    const auto micros = durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses());
+    const auto record = [&](Top::CollectionData& coll) {
+        top.record(
+            _opCtx, coll, curOp->getLogicalOp(), _lockType, micros, curOp->getReadWriteType());
+    };
+
+    if (_collection) {
+        // The collection may have been dropped or renamed while the operation yielded.
+        if (*_collection && (*_collection)->ns() == _nss) {
+            if (auto coll = top.getCollectionData(*_collection->get())) {
+                record(*coll);
+            }
+        } else if (auto coll = top.getCollectionData(_nss.ns())) {
+            record(*coll);
+        }
+    }
+
+    for (const auto& coll : _collectionData) {
+        record(*coll);
+    }
 }
 
 AutoGetCollectionForRead::AutoGetCollectionForRead(OperationContext* opCtx,
@@ -983,7 +1017,8 @@ AutoGetCollectionForReadCommandBase<AutoGetCollectionForReadType>::
                     CollectionCatalog::get(opCtx)->getDatabaseProfileLevel(
                         _autoCollForRead.getNss().dbName()),
                     options._deadline,
-                    options._secondaryNssOrUUIDs) {
+                    options._secondaryNssOrUUIDs,
+                    &_autoCollForRead.getCollection()) {
     hangBeforeAutoGetShardVersionCheck.executeIf(
         [&](auto&) { hangBeforeAutoGetShardVersionCheck.pauseWhileSet(opCtx); },
         [&](const BSONObj& data) {
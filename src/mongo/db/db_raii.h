@@ -30,6 +30,7 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "mongo/db/catalog_raii.h"
 #include "mongo/db/stats/top.h"
@@ -65,6 +66,10 @@ public:
     /**
      * If 'logMode' is 'kUpdateCurOp' or 'kUpdateTopAndCurOp', sets up and records state on the
      * CurOp object attached to 'opCtx', as described above.
+     *
+     * If 'collection' is given, it must outlive this object. The operation is then recorded against
+     * 'nss' through the Top statistics cached on the collection it holds on destruction, as long as
+     * that collection is still 'nss'.
      */
     AutoStatsTracker(OperationContext* opCtx,
                      const NamespaceString& nss,
@@ -72,7 +77,8 @@ public:
                      LogMode logMode,
                      int dbProfilingLevel,
                      Date_t deadline = Date_t::max(),
-                     const std::vector<NamespaceStringOrUUID>& secondaryNssVector = {});
+                     const std::vector<NamespaceStringOrUUID>& secondaryNssVector = {},
+                     const CollectionPtr* collection = nullptr);
 
     /**
      * Records stats about the current operation via Top, if 'logMode' is 'kUpdateTop' or
@@ -84,7 +90,14 @@ private:
     OperationContext* _opCtx;
     Top::LockType _lockType;
     const LogMode _logMode;
-    std::set<NamespaceString> _nssSet;
+
+    const NamespaceString _nss;
+    const CollectionPtr* const _collection;
+
+    // Top statistics of the deduplicated namespaces this operation accesses, resolved on
+    // construction unless 'logMode' is 'kUpdateCurOp'. Those of '_nss' are only resolved here if
+    // there is no '_collection'.
+    std::vector<Top::CollectionDataHandle> _collectionData;
 };
 
 /**
@@ -1162,6 +1162,10 @@ struct UnpackTimeseriesBucketStats final : public SpecificStats {
     }
 
     size_t nBucketsUnpacked = 0u;
+    // Unpacked buckets whose control fields proved every event matches, so no event was filtered.
+    size_t nBucketsMatchedWholeBucketFilter = 0u;
+    // Unpacked buckets in which no event matched the event filter.
+    size_t nBucketsWithoutMatchingEvents = 0u;
 };
 
 struct TimeseriesModifyStats final : public SpecificStats {
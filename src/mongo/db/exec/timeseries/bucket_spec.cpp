@@ -635,9 +635,20 @@ std::unique_ptr<MatchExpression> createTightExprComparisonPredicate(
     const BucketSpec& bucketSpec,
     boost::intrusive_ptr<ExpressionContext> pExpCtx) {
     using namespace timeseries;
-    auto rewriteMatchExpr = RewriteExpr::rewrite(matchExpr->getExpression(), pExpCtx->getCollator())
-                                .releaseMatchExpression();
-    if (rewriteMatchExpr &&
+    const auto& expr = matchExpr->getExpression();
+    auto rewriteMatchExpr =
+        RewriteExpr::rewrite(expr, pExpCtx->getCollator()).releaseMatchExpression();
+    if (!rewriteMatchExpr) {
+        return handleIneligible(BucketSpec::IneligiblePredicatePolicy::kIgnore,
+                                matchExpr,
+                                "can't handle non-comparison $expr match expression")
+            .tightPredicate;
+    }
+
+    // The rewrite drops the parts of an $and it cannot translate, so it is only equivalent to the
+    // original expression if the expression is a single comparison, or an $and made only of
+    // comparisons which all survived the rewrite.
+    if (dynamic_cast<const ExpressionCompare*>(expr.get()) &&
         ComparisonMatchExpressionBase::isInternalExprComparison(rewriteMatchExpr->matchType())) {
         auto compareMatchExpr =
             checked_cast<const ComparisonMatchExpressionBase*>(rewriteMatchExpr.get());
@@ -645,6 +656,34 @@ std::unique_ptr<MatchExpression> createTightExprComparisonPredicate(
             compareMatchExpr, bucketSpec, pExpCtx->collationMatchesDefault);
     }
 
+    if (auto andExpr = dynamic_cast<const ExpressionAnd*>(expr.get()); andExpr &&
+        rewriteMatchExpr->matchType() == MatchExpression::AND &&
+        rewriteMatchExpr->numChildren() == andExpr->getOperandList().size() &&
+        std::all_of(andExpr->getOperandList().begin(),
+                    andExpr->getOperandList().end(),
+                    [](auto&& operand) {
+                        return dynamic_cast<const ExpressionCompare*>(operand.get());
+                    })) {
+        // Every event in a bucket satisfies the conjunction if the bucket satisfies the tight
+        // predicate of each of its comparisons, e.g. a bounded range on the time field.
+        auto tightAndExpression = std::make_unique<AndMatchExpression>();
+        for (size_t i = 0; i < rewriteMatchExpr->numChildren(); ++i) {
+            auto child = rewriteMatchExpr->getChild(i);
+            if (!ComparisonMatchExpressionBase::isInternalExprComparison(child->matchType())) {
+                return nullptr;
+            }
+            auto tightChild = createTightComparisonPredicate(
+                checked_cast<const ComparisonMatchExpressionBase*>(child),
+                bucketSpec,
+                pExpCtx->collationMatchesDefault);
+            if (!tightChild) {
+                return nullptr;
+            }
+            tightAndExpression->add(std::move(tightChild));
+        }
+        return tightAndExpression;
+    }
+
     return handleIneligible(BucketSpec::IneligiblePredicatePolicy::kIgnore,
                             matchExpr,
                             "can't handle non-comparison $expr match expression")
@@ -862,12 +901,25 @@ BucketSpec::BucketPredicate BucketSpec::createPredicatesOnBucketLevelField(
                 policy, matchExpr, "can't handle {$eq: null} predicate (inside $in predicate)");
 
         auto result = std::make_unique<OrMatchExpression>();
+        auto tightResult = std::make_unique<OrMatchExpression>();
 
         bool alwaysTrue = false;
         for (auto&& elem : inExpr->getEqualities()) {
             // If inExpr is {$in: [X, Y]} then the elems are '0: X' and '1: Y'.
             auto eq = std::make_unique<EqualityMatchExpression>(
                 inExpr->path(), elem, nullptr /*annotation*/, inExpr->getCollator());
+
+            // As with OR, a bucket whose events all equal one of the values matches the $in as a
+            // whole, so any equality that has a tight form can be added to the tight predicate.
+            if (auto tightChild = createTightComparisonPredicate(
+                    eq.get(), bucketSpec, pExpCtx->collationMatchesDefault)) {
+                tightResult->add(std::move(tightChild));
+            }
+
+            if (alwaysTrue) {
+                continue;
+            }
+
             auto child = createComparisonPredicate(eq.get(),
                                                    bucketSpec,
                                                    bucketMaxSpanSeconds,
@@ -883,16 +935,22 @@ BucketSpec::BucketPredicate BucketSpec::createPredicatesOnBucketLevelField(
                 result->add(std::move(child));
             } else {
                 alwaysTrue = true;
-                if (policy == IneligiblePredicatePolicy::kIgnore)
-                    break;
             }
         }
+
+        std::unique_ptr<MatchExpression> tightExpression = nullptr;
+        if (tightResult->numChildren() == 1) {
+            tightExpression = tightResult->releaseChild(0);
+        } else if (tightResult->numChildren() > 1) {
+            tightExpression = std::move(tightResult);
+        }
+
         if (alwaysTrue)
-            return {};
+            return {nullptr, std::move(tightExpression)};
 
         // As above, no special case for an empty IN: returning nullptr would be incorrect because
         // it means 'always-true', here.
-        return {std::move(result), nullptr};
+        return {std::move(result), std::move(tightExpression)};
     }
     return handleIneligible(policy, matchExpr, "can't handle this predicate");
 }
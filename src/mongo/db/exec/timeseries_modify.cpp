@@ -31,6 +31,7 @@
 
 #include "mongo/db/catalog/document_validation.h"
 #include "mongo/db/query/plan_executor_impl.h"
+#include "mongo/db/timeseries/timeseries_constants.h"
 #include "mongo/db/timeseries/timeseries_write_util.h"
 #include "mongo/db/update/update_util.h"
 
@@ -174,12 +175,14 @@ std::pair<bool, PlanStage::StageState> TimeseriesModifyStage::_writeToTimeseries
     WorkingSetID bucketWsmId,
     std::vector<BSONObj>&& unchangedMeasurements,
     const std::vector<BSONObj>& matchedMeasurements,
+    bool unchangedAreLeading,
     bool bucketFromMigrate) {
     // No measurements needed to be updated or deleted from the bucket document.
     if (matchedMeasurements.empty()) {
         return {false, PlanStage::NEED_TIME};
     }
     _specificStats.nMeasurementsMatched += matchedMeasurements.size();
+    const auto numUnchangedMeasurements = unchangedMeasurements.size();
 
     auto updateResult = _params.isUpdate
         ? _buildInsertOps(matchedMeasurements, unchangedMeasurements)
@@ -217,8 +220,20 @@ std::pair<bool, PlanStage::StageState> TimeseriesModifyStage::_writeToTimeseries
     auto recordId = _ws->get(bucketWsmId)->recordId;
 
     OID bucketId = record_id_helpers::toBSONAs(recordId, "_id")["_id"].OID();
-    auto modificationOp =
-        timeseries::makeModificationOp(bucketId, collection(), unchangedMeasurements);
+
+    // When only trailing measurements are removed from a compressed bucket, truncate its columns in
+    // place rather than rewriting the remaining measurements uncompressed. No-op updates append
+    // their measurements out of order, so they disqualify the bucket.
+    const auto& bucket = _bucketUnpacker.bucket();
+    const bool truncateCompressedBucket = unchangedAreLeading && !unchangedMeasurements.empty() &&
+        unchangedMeasurements.size() == numUnchangedMeasurements &&
+        bucket[timeseries::kBucketControlFieldName][timeseries::kBucketControlVersionFieldName]
+                .numberInt() == timeseries::kTimeseriesControlCompressedVersion;
+    auto modificationOp = timeseries::makeModificationOp(bucketId,
+                                                         collection(),
+                                                         unchangedMeasurements,
+                                                         truncateCompressedBucket ? bucket
+                                                                                  : BSONObj());
     try {
         const auto modificationRet = handlePlanStageYield(
             expCtx(),
@@ -415,6 +430,7 @@ PlanStage::StageState TimeseriesModifyStage::doWork(WorkingSetID* out) {
 
     std::vector<BSONObj> unchangedMeasurements;
     std::vector<BSONObj> modifiedMeasurements;
+    bool unchangedAreLeading = true;
 
     while (_bucketUnpacker.hasNext()) {
         auto measurement = _bucketUnpacker.getNext().toBson();
@@ -424,13 +440,19 @@ PlanStage::StageState TimeseriesModifyStage::doWork(WorkingSetID* out) {
             (!_residualPredicate || _residualPredicate->matchesBSON(measurement))) {
             modifiedMeasurements.push_back(measurement);
         } else {
+            unchangedAreLeading = unchangedAreLeading && modifiedMeasurements.empty();
             unchangedMeasurements.push_back(measurement);
         }
     }
 
     auto isWriteSuccessful = false;
-    std::tie(isWriteSuccessful, status) = _writeToTimeseriesBuckets(
-        bucketFreer, id, std::move(unchangedMeasurements), modifiedMeasurements, bucketFromMigrate);
+    std::tie(isWriteSuccessful, status) =
+        _writeToTimeseriesBuckets(bucketFreer,
+                                  id,
+                                  std::move(unchangedMeasurements),
+                                  modifiedMeasurements,
+                                  unchangedAreLeading,
+                                  bucketFromMigrate);
     if (status != PlanStage::NEED_TIME) {
         *out = WorkingSet::INVALID_ID;
         if (_params.returnDeleted && isWriteSuccessful) {
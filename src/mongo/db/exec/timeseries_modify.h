@@ -152,7 +152,9 @@ private:
         std::vector<BSONObj>& unchangedMeasurements);
 
     /**
-     * Writes the modifications to a bucket.
+     * Writes the modifications to a bucket. 'unchangedAreLeading' tells whether all of the
+     * 'unchangedMeasurements' precede the matched ones in the bucket, which allows truncating a
+     * compressed bucket in place.
      *
      * Returns the pair of (whether the write was successful, the stage state to propagate).
      */
@@ -162,6 +164,7 @@ private:
         WorkingSetID bucketWsmId,
         std::vector<BSONObj>&& unchangedMeasurements,
         const std::vector<BSONObj>& modifiedMeasurements,
+        bool unchangedAreLeading,
         bool bucketFromMigrate);
 
     /**
@@ -38,7 +38,18 @@
 namespace mongo {
 
 /**
- * Compesses and uncompresses a block of buffer using zlib.
+ * Algorithm used to compress a block of FTDC metrics.
+ *
+ * NOTE: Persisted to disk as the format version of metric chunks, see
+ * FTDCBSONUtil::createBSONMetricChunkDocument.
+ */
+enum class FTDCCompression : std::int32_t {
+    kZlib = 1,
+    kZstd = 2,
+};
+
+/**
+ * Compesses and uncompresses a block of buffer using zlib or zstd.
  */
 class BlockCompressor {
     BlockCompressor(const BlockCompressor&) = delete;
@@ -53,7 +64,8 @@ public:
      * Returns a pointer to a buffer that BlockCompressor owns.
      * The returned buffer is valid until the next call to compress or uncompress.
      */
-    StatusWith<ConstDataRange> compress(ConstDataRange source);
+    StatusWith<ConstDataRange> compress(ConstDataRange source,
+                                        FTDCCompression compression = FTDCCompression::kZlib);
 
     /**
      * Uncompress a buffer of data.
@@ -64,7 +76,16 @@ public:
      * Returns a pointer to a buffer that BlockCompressor owns.
      * The returned buffer is valid until the next call to compress or uncompress.
      */
-    StatusWith<ConstDataRange> uncompress(ConstDataRange source, size_t maxUncompressedLength);
+    StatusWith<ConstDataRange> uncompress(ConstDataRange source,
+                                          size_t maxUncompressedLength,
+                                          FTDCCompression compression = FTDCCompression::kZlib);
+
+private:
+    StatusWith<ConstDataRange> _compressZlib(ConstDataRange source);
+    StatusWith<ConstDataRange> _uncompressZlib(ConstDataRange source, size_t uncompressedLength);
+
+    StatusWith<ConstDataRange> _compressZstd(ConstDataRange source);
+    StatusWith<ConstDataRange> _uncompressZstd(ConstDataRange source, size_t uncompressedLength);
 
 private:
     std::vector<std::uint8_t> _buffer;
@@ -40,11 +40,16 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 namespace mongo {
 
 void FTDCCollectorCollection::add(std::unique_ptr<FTDCCollectorInterface> collector) {
     // TODO: ensure the collectors all have unique names.
+    _collectorMicros.push_back(
+        _metricRegistry
+            ? &_metricRegistry->registerMetric("ftdc.collectors." + collector->name() + ".micros")
+            : nullptr);
     _collectors.emplace_back(std::move(collector));
 }
 
@@ -70,7 +75,9 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
     ShouldNotConflictWithSecondaryBatchApplicationBlock shouldNotConflictBlock(opCtx->lockState());
     opCtx->lockState()->setAdmissionPriority(AdmissionContext::Priority::kImmediate);
 
-    for (auto& collector : _collectors) {
+    for (size_t i = 0; i < _collectors.size(); ++i) {
+        auto& collector = _collectors[i];
+
         // Skip collection if this collector has no data to return
         if (!collector->hasData()) {
             continue;
@@ -90,7 +97,11 @@ std::tuple<BSONObj, Date_t> FTDCCollectorCollection::collect(Client* client) {
 
         subObjBuilder.appendDate(kFTDCCollectStartField, now);
 
+        Timer timer;
         collector->collect(opCtx.get(), subObjBuilder);
+        if (auto micros = _collectorMicros[i]) {
+            micros->increment(timer.micros());
+        }
 
         end = client->getServiceContext()->getPreciseClockSource()->now();
         subObjBuilder.appendDate(kFTDCCollectEndField, end);
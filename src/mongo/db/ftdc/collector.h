@@ -34,6 +34,7 @@
 #include <tuple>
 #include <vector>
 
+#include "mongo/db/ftdc/metric_registry.h"
 
 namespace mongo {
 
@@ -86,6 +87,9 @@ protected:
 /**
  * Manages the set of BSON collectors
  *
+ * If constructed with a metric registry, the time spent in each collector is accumulated in a
+ * registered "ftdc.collectors.<name>.micros" metric, so that a slow collector can be spotted.
+ *
  * Not Thread-Safe. Locking is owner's responsibility.
  */
 class FTDCCollectorCollection {
@@ -93,7 +97,8 @@ class FTDCCollectorCollection {
     FTDCCollectorCollection& operator=(const FTDCCollectorCollection&) = delete;
 
 public:
-    FTDCCollectorCollection() = default;
+    explicit FTDCCollectorCollection(FTDCMetricRegistry* metricRegistry = nullptr)
+        : _metricRegistry(metricRegistry) {}
 
     /**
      * Add a metric collector to the collection.
@@ -120,8 +125,13 @@ public:
     std::tuple<BSONObj, Date_t> collect(Client* client);
 
 private:
+    FTDCMetricRegistry* const _metricRegistry;
+
     // collection of collectors
     std::vector<std::unique_ptr<FTDCCollectorInterface>> _collectors;
+
+    // Time spent in each collector, if a metric registry is set
+    std::vector<FTDCMetricRegistry::Metric*> _collectorMicros;
 };
 
 }  // namespace mongo
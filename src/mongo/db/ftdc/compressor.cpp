@@ -33,6 +33,7 @@
 
 #include "mongo/base/data_builder.h"
 #include "mongo/db/ftdc/config.h"
+#include "mongo/db/ftdc/constants.h"
 #include "mongo/db/ftdc/util.h"
 #include "mongo/db/ftdc/varint.h"
 #include "mongo/db/jsobj.h"
@@ -44,21 +45,26 @@ namespace mongo {
 using std::swap;
 
 StatusWith<boost::optional<std::tuple<ConstDataRange, FTDCCompressor::CompressorState, Date_t>>>
-FTDCCompressor::addSample(const BSONObj& sample, Date_t date) {
+FTDCCompressor::addSample(const BSONObj& sample, Date_t date, const FTDCMetricRegistry* registry) {
+    if (registry) {
+        registry->readValues(&_registryValues);
+    } else {
+        _registryValues.clear();
+    }
+
     if (_referenceDoc.isEmpty()) {
-        auto swMatchesReference =
-            FTDCBSONUtil::extractMetricsFromDocument(sample, sample, &_metrics);
+        auto swMatchesReference = _extractMetrics(sample, sample);
         if (!swMatchesReference.isOK()) {
             return swMatchesReference.getStatus();
         }
 
-        _reset(sample, date);
+        _reset(sample, date, registry);
         return {boost::none};
     }
 
     _metrics.resize(0);
 
-    auto swMatches = FTDCBSONUtil::extractMetricsFromDocument(_referenceDoc, sample, &_metrics);
+    auto swMatches = _extractMetrics(_referenceSample, sample);
 
     if (!swMatches.isOK()) {
         return swMatches.getStatus();
@@ -76,7 +82,7 @@ FTDCCompressor::addSample(const BSONObj& sample, Date_t date) {
         }
 
         // Set the new sample as the current reference document as we have to start all over
-        _reset(sample, date);
+        _reset(sample, date, registry);
         return {std::tuple<ConstDataRange, FTDCCompressor::CompressorState, Date_t>(
             std::get<0>(swCompressedSamples.getValue()),
             CompressorState::kSchemaChanged,
@@ -105,6 +111,7 @@ FTDCCompressor::addSample(const BSONObj& sample, Date_t date) {
 
         // Setup so that we treat the next sample as the reference sample
         _referenceDoc = BSONObj();
+        _referenceSample = BSONObj();
 
         return {std::tuple<ConstDataRange, FTDCCompressor::CompressorState, Date_t>(
             std::get<0>(swCompressedSamples.getValue()),
@@ -146,7 +153,7 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
         // 3. Finally, for non-zero members, we store these as VarInt packed
         //
         // These byte arrays are added to a buffer which is then concatenated with other chunks and
-        // compressed with ZLIB.
+        // compressed with the configured block compressor.
         for (std::uint32_t i = 0; i < _metricsCount; i++) {
             for (std::uint32_t j = 0; j < _deltaCount; j++) {
                 std::uint64_t delta = _deltas[getArrayOffset(_maxDeltas, j, i)];
@@ -199,7 +206,8 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
     }
 
     auto swDest = _compressor.compress(
-        ConstDataRange(_uncompressedChunkBuffer.buf(), _uncompressedChunkBuffer.len()));
+        ConstDataRange(_uncompressedChunkBuffer.buf(), _uncompressedChunkBuffer.len()),
+        _config->compression);
 
     // The only way for compression to fail is if the buffer size calculations are wrong
     if (!swDest.isOK()) {
@@ -220,11 +228,37 @@ StatusWith<std::tuple<ConstDataRange, Date_t>> FTDCCompressor::getCompressedSamp
 
 void FTDCCompressor::reset() {
     _metrics.clear();
-    _reset(BSONObj(), Date_t());
+    _registryValues.clear();
+    _reset(BSONObj(), Date_t(), nullptr);
+}
+
+StatusWith<bool> FTDCCompressor::_extractMetrics(const BSONObj& referenceSample,
+                                                 const BSONObj& sample) {
+    auto swMatches = FTDCBSONUtil::extractMetricsFromDocument(referenceSample, sample, &_metrics);
+    if (!swMatches.isOK()) {
+        return swMatches;
+    }
+
+    // Metrics are only ever registered, so the same number of values means the same names.
+    _metrics.insert(_metrics.end(), _registryValues.begin(), _registryValues.end());
+    return swMatches.getValue() && _registryValues.size() == _referenceRegistrySize;
 }
 
-void FTDCCompressor::_reset(const BSONObj& referenceDoc, Date_t date) {
-    _referenceDoc = referenceDoc;
+void FTDCCompressor::_reset(const BSONObj& referenceSample,
+                            Date_t date,
+                            const FTDCMetricRegistry* registry) {
+    _referenceSample = referenceSample;
+    _referenceRegistrySize = _registryValues.size();
+    if (_registryValues.empty()) {
+        _referenceDoc = referenceSample;
+    } else {
+        BSONObjBuilder builder;
+        builder.appendElements(referenceSample);
+        BSONObjBuilder registryBuilder(builder.subobjStart(kFTDCRegisteredMetricsField));
+        registry->appendValues(_registryValues, &registryBuilder);
+        registryBuilder.doneFast();
+        _referenceDoc = builder.obj();
+    }
     _referenceDocDate = date;
 
     _metricsCount = _metrics.size();
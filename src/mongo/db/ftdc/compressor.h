@@ -39,6 +39,7 @@
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/ftdc/block_compressor.h"
 #include "mongo/db/ftdc/config.h"
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/jsobj.h"
 
 namespace mongo {
@@ -54,10 +55,16 @@ namespace mongo {
  * 2. It stores the deltas into an array of std::int64_t.
  * 3. It compressed each std::int64_t using VarInt integer compression. See varint.h.
  * 4. Encodes zeros in Run Length Encoded pairs of <Count, Zero>
- * 5. ZLIB compresses the final processed array
+ * 5. Compresses the final processed array with zlib or zstd, see FTDCConfig::compression
  *
  * NOTE: This compression ignores non-number data, and assumes the non-number data is constant
  * across all documents in the series of documents.
+ *
+ * The metrics of an FTDCMetricRegistry can be added to each sample without being converted to
+ * BSON: their values are read directly from the registry and follow the metrics of the BSON
+ * sample, and the reference document holds them in a trailing "registeredMetrics" sub-document so
+ * that decompression restores them like any other field. The reference document is only rebuilt
+ * when the BSON schema changes or metrics are registered.
  */
 class FTDCCompressor {
     FTDCCompressor(const FTDCCompressor&) = delete;
@@ -92,9 +99,11 @@ public:
      *
      * date is the date at which the sample as started to be captured. It will be saved in the
      * compressor if this sample is used as the reference document.N
+     *
+     * If 'registry' is set, the current values of its metrics are added to the sample.
      */
     StatusWith<boost::optional<std::tuple<ConstDataRange, CompressorState, Date_t>>> addSample(
-        const BSONObj& sample, Date_t date);
+        const BSONObj& sample, Date_t date, const FTDCMetricRegistry* registry = nullptr);
 
     /**
      * Returns the number of enqueued samples.
@@ -145,10 +154,16 @@ public:
     }
 
 private:
+    /**
+     * Appends the metrics of 'sample' and the registered metric values read for it to _metrics.
+     * Returns whether they match the schema of the reference document.
+     */
+    StatusWith<bool> _extractMetrics(const BSONObj& referenceSample, const BSONObj& sample);
+
     /**
      * Reset the state
      */
-    void _reset(const BSONObj& referenceDoc, Date_t date);
+    void _reset(const BSONObj& referenceSample, Date_t date, const FTDCMetricRegistry* registry);
 
 private:
     // Block Compressor
@@ -157,9 +172,14 @@ private:
     // Config
     const FTDCConfig* const _config;
 
-    // Reference schema document
+    // Reference schema document, including the registered metrics
     BSONObj _referenceDoc;
 
+    // The sample the reference document was built from, and the number of registered metrics it
+    // was built with
+    BSONObj _referenceSample;
+    std::size_t _referenceRegistrySize{0};
+
     // Time at which reference schema document was collected.
     // Passed in via addSample and returned with each chunk.
     Date_t _referenceDocDate;
@@ -186,6 +206,9 @@ private:
     // Buffer to hold metrics
     std::vector<std::uint64_t> _metrics;
     std::vector<std::uint64_t> _prevmetrics;
+
+    // Values of the registered metrics for the current sample
+    std::vector<std::uint64_t> _registryValues;
 };
 
 }  // namespace mongo
@@ -0,0 +1,162 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/platform/basic.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/ftdc/compressor.h"
+#include "mongo/db/ftdc/config.h"
+#include "mongo/db/ftdc/decompressor.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Generates the samples of one archive metric chunk with the given number of metrics, shaped like
+ * serverStatus: monotonic counters advancing at different rates, gauges wandering around a level
+ * and constants, grouped in sections of 16 metrics.
+ */
+std::vector<BSONObj> generateSamples(const FTDCConfig& config, int metricsCount) {
+    std::mt19937_64 rng(metricsCount);
+    std::vector<long long> values(metricsCount);
+    std::vector<long long> rates(metricsCount);
+    for (int i = 0; i < metricsCount; ++i) {
+        values[i] = rng() % 1'000'000;
+        rates[i] = i % 4 == 3 ? 0 : rng() % (1 << (i % 20));
+    }
+
+    std::vector<BSONObj> samples;
+    for (std::uint32_t sample = 0; sample < config.maxSamplesPerArchiveMetricChunk; ++sample) {
+        BSONObjBuilder builder;
+        builder.append("host", "ftdc-benchmark");
+        for (int section = 0; section * 16 < metricsCount; ++section) {
+            BSONObjBuilder sectionBuilder(builder.subobjStart("section" + std::to_string(section)));
+            for (int i = section * 16; i < std::min(metricsCount, (section + 1) * 16); ++i) {
+                if (i % 4 == 2 && rates[i] != 0) {
+                    values[i] += static_cast<long long>(rng() % (2 * rates[i])) - rates[i];
+                } else if (rates[i] != 0) {
+                    values[i] += rng() % (2 * rates[i]);
+                }
+                sectionBuilder.append("metric" + std::to_string(i), values[i]);
+            }
+        }
+        samples.push_back(builder.obj());
+    }
+    return samples;
+}
+
+/**
+ * Compresses a chunk, returning the compressed chunk which is valid until the next call on the
+ * compressor.
+ */
+ConstDataRange compressChunk(FTDCCompressor& compressor, const std::vector<BSONObj>& samples) {
+    compressor.reset();
+    for (const auto& sample : samples) {
+        auto swResult = compressor.addSample(sample, Date_t());
+        invariant(swResult.getStatus());
+        if (swResult.getValue()) {
+            return std::get<0>(*swResult.getValue());
+        }
+    }
+    MONGO_UNREACHABLE;
+}
+
+/**
+ * Reports the size of the raw samples and of their compressed chunk, whose ratio is the
+ * compression ratio.
+ */
+void setChunkCounters(benchmark::State& state,
+                      const std::vector<BSONObj>& samples,
+                      ConstDataRange chunk) {
+    double rawBytes = 0;
+    for (const auto& sample : samples) {
+        rawBytes += sample.objsize();
+    }
+    state.counters["rawBytes"] = rawBytes;
+    state.counters["chunkBytes"] = chunk.length();
+    state.counters["ratio"] = rawBytes / chunk.length();
+}
+
+void BM_FTDCCompressChunk(benchmark::State& state) {
+    FTDCConfig config;
+    config.compression = static_cast<FTDCCompression>(state.range(0));
+    auto samples = generateSamples(config, state.range(1));
+    FTDCCompressor compressor(&config);
+
+    ConstDataRange chunk(nullptr, 0);
+    for (auto _ : state) {
+        chunk = compressChunk(compressor, samples);
+        benchmark::DoNotOptimize(chunk.data());
+    }
+
+    setChunkCounters(state, samples, chunk);
+    state.SetItemsProcessed(state.iterations() * samples.size());
+}
+
+void BM_FTDCDecompressChunk(benchmark::State& state) {
+    FTDCConfig config;
+    config.compression = static_cast<FTDCCompression>(state.range(0));
+    auto samples = generateSamples(config, state.range(1));
+    FTDCCompressor compressor(&config);
+    FTDCDecompressor decompressor;
+
+    auto chunk = compressChunk(compressor, samples);
+    for (auto _ : state) {
+        auto swDocs = decompressor.uncompress(chunk, config.compression);
+        invariant(swDocs.getStatus());
+        benchmark::DoNotOptimize(swDocs.getValue().data());
+    }
+
+    setChunkCounters(state, samples, chunk);
+    state.SetItemsProcessed(state.iterations() * samples.size());
+}
+
+void compressionArgs(benchmark::internal::Benchmark* b) {
+    for (auto compression : {FTDCCompression::kZlib, FTDCCompression::kZstd}) {
+        for (int metricsCount : {256, 1024, 4096}) {
+            b->Args({static_cast<int>(compression), metricsCount});
+        }
+    }
+    b->ArgNames({"compression", "metrics"})->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_FTDCCompressChunk)->Apply(compressionArgs);
+BENCHMARK(BM_FTDCDecompressChunk)->Apply(compressionArgs);
+
+}  // namespace
+}  // namespace mongo
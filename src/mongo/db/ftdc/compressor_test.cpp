@@ -39,6 +39,7 @@
 #include "mongo/db/ftdc/config.h"
 #include "mongo/db/ftdc/decompressor.h"
 #include "mongo/db/ftdc/ftdc_test.h"
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/unittest/unittest.h"
 #include "mongo/util/assert_util.h"
@@ -122,8 +123,11 @@ TEST_F(FTDCCompressorTest, TestStrings) {
  */
 class TestTie {
 public:
-    TestTie(FTDCValidationMode mode = FTDCValidationMode::kStrict)
-        : _compressor(&_config), _mode(mode) {}
+    TestTie(FTDCValidationMode mode = FTDCValidationMode::kStrict,
+            FTDCCompression compression = FTDCCompression::kZlib)
+        : _compressor(&_config), _mode(mode) {
+        _config.compression = compression;
+    }
 
     ~TestTie() {
         validate(boost::none);
@@ -155,13 +159,14 @@ public:
     void validate(boost::optional<ConstDataRange> cdr) {
         std::vector<BSONObj> list;
         if (cdr.has_value()) {
-            auto sw = _decompressor.uncompress(cdr.value());
+            auto sw = _decompressor.uncompress(cdr.value(), _config.compression);
             ASSERT_TRUE(sw.isOK());
             list = sw.getValue();
         } else {
             auto swBuf = _compressor.getCompressedSamples();
             ASSERT_TRUE(swBuf.isOK());
-            auto sw = _decompressor.uncompress(std::get<0>(swBuf.getValue()));
+            auto sw =
+                _decompressor.uncompress(std::get<0>(swBuf.getValue()), _config.compression);
             ASSERT_TRUE(sw.isOK());
 
             list = sw.getValue();
@@ -183,6 +188,67 @@ private:
     FTDCValidationMode _mode;
 };
 
+// Test that registered metrics are recorded with every sample and restored by decompression
+TEST_F(FTDCCompressorTest, TestRegisteredMetrics) {
+    FTDCConfig config;
+    FTDCCompressor c(&config);
+    FTDCDecompressor d;
+    FTDCMetricRegistry registry;
+
+    auto& a = registry.registerMetric("a");
+    auto& b = registry.registerMetric("b");
+    a.set(10);
+    b.set(-5);
+
+    auto st = c.addSample(BSON("name"
+                               << "joe"
+                               << "key1" << 33),
+                          Date_t(),
+                          &registry);
+    ASSERT_HAS_SPACE(st);
+
+    a.increment();
+    st = c.addSample(BSON("name"
+                          << "joe"
+                          << "key1" << 34),
+                     Date_t(),
+                     &registry);
+    ASSERT_HAS_SPACE(st);
+
+    // Registering a metric changes the schema.
+    registry.registerMetric("c").set(7);
+    st = c.addSample(BSON("name"
+                          << "joe"
+                          << "key1" << 35),
+                     Date_t(),
+                     &registry);
+    ASSERT_SCHEMA_CHANGED(st);
+
+    auto sw = d.uncompress(std::get<0>(st.getValue().get()));
+    ASSERT_OK(sw.getStatus());
+    ValidateDocumentList(sw.getValue(),
+                         {BSON("name"
+                               << "joe"
+                               << "key1" << 33 << "registeredMetrics"
+                               << BSON("a" << 10LL << "b" << -5LL)),
+                          BSON("name"
+                               << "joe"
+                               << "key1" << 34 << "registeredMetrics"
+                               << BSON("a" << 11LL << "b" << -5LL))},
+                         FTDCValidationMode::kStrict);
+
+    auto swBuf = c.getCompressedSamples();
+    ASSERT_OK(swBuf.getStatus());
+    sw = d.uncompress(std::get<0>(swBuf.getValue()));
+    ASSERT_OK(sw.getStatus());
+    ValidateDocumentList(sw.getValue(),
+                         {BSON("name"
+                               << "joe"
+                               << "key1" << 35 << "registeredMetrics"
+                               << BSON("a" << 11LL << "b" << -5LL << "c" << 7LL))},
+                         FTDCValidationMode::kStrict);
+}
+
 // Test various schema changes
 TEST_F(FTDCCompressorTest, TestSchemaChanges) {
     TestTie c;
@@ -542,6 +608,54 @@ TEST_F(FTDCCompressorTest, TestManyMetrics) {
     }
 }
 
+// Test full buffers and schema changes with zstd compressed chunks
+TEST_F(FTDCCompressorTest, TestZstd) {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+
+    std::uniform_int_distribution<long long> genValues(1, std::numeric_limits<long long>::max());
+    const size_t metrics = 1000;
+
+    TestTie c(FTDCValidationMode::kStrict, FTDCCompression::kZstd);
+
+    auto st = c.addSample(generateSample(rd, genValues, metrics));
+    ASSERT_HAS_SPACE(st);
+
+    for (size_t i = 0; i != FTDCConfig::kMaxSamplesPerArchiveMetricChunkDefault - 2; i++) {
+        st = c.addSample(generateSample(rd, genValues, metrics));
+        ASSERT_HAS_SPACE(st);
+    }
+
+    st = c.addSample(generateSample(rd, genValues, metrics));
+    ASSERT_FULL(st);
+
+    st = c.addSample(generateSample(rd, genValues, metrics));
+    ASSERT_HAS_SPACE(st);
+
+    st = c.addSample(generateSample(rd, genValues, metrics + 1));
+    ASSERT_SCHEMA_CHANGED(st);
+}
+
+// Test a chunk is only decompressed with the algorithm it was compressed with
+TEST_F(FTDCCompressorTest, TestCompressionMismatch) {
+    FTDCConfig config;
+    config.compression = FTDCCompression::kZstd;
+    FTDCCompressor c(&config);
+    FTDCDecompressor d;
+
+    auto st = c.addSample(BSON("name"
+                               << "joe"
+                               << "key1" << 33 << "key2" << 42),
+                          Date_t());
+    ASSERT_HAS_SPACE(st);
+
+    auto swBuf = c.getCompressedSamples();
+    ASSERT_OK(swBuf.getStatus());
+
+    ASSERT_NOT_OK(d.uncompress(std::get<0>(swBuf.getValue()), FTDCCompression::kZlib).getStatus());
+    ASSERT_OK(d.uncompress(std::get<0>(swBuf.getValue()), FTDCCompression::kZstd).getStatus());
+}
+
 // Test various non-finite double values
 TEST_F(FTDCCompressorTest, TestDoubleValues) {
     TestTie c;
@@ -31,6 +31,7 @@
 
 #include <cstdint>
 
+#include "mongo/db/ftdc/block_compressor.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
@@ -47,7 +48,8 @@ struct FTDCConfig {
           maxFileSizeBytes(kMaxFileSizeBytesDefault),
           period(kPeriodMillisDefault),
           maxSamplesPerArchiveMetricChunk(kMaxSamplesPerArchiveMetricChunkDefault),
-          maxSamplesPerInterimMetricChunk(kMaxSamplesPerInterimMetricChunkDefault) {}
+          maxSamplesPerInterimMetricChunk(kMaxSamplesPerInterimMetricChunkDefault),
+          compression(kCompressionDefault) {}
 
     /**
      * True if FTDC is collecting data. False otherwise
@@ -84,6 +86,12 @@ struct FTDCConfig {
      */
     std::uint32_t maxSamplesPerInterimMetricChunk;
 
+    /**
+     * Algorithm to compress metric chunks with. Chunks record the algorithm they were compressed
+     * with, so files may mix chunks of either kind.
+     */
+    FTDCCompression compression;
+
     static const bool kEnabledDefault = true;
 
     static const std::int64_t kPeriodMillisDefault;
@@ -94,6 +102,8 @@ struct FTDCConfig {
 
     static const std::uint32_t kMaxSamplesPerArchiveMetricChunkDefault = 300;
     static const std::uint32_t kMaxSamplesPerInterimMetricChunkDefault = 10;
+
+    static constexpr FTDCCompression kCompressionDefault = FTDCCompression::kZlib;
 };
 
 }  // namespace mongo
@@ -41,6 +41,7 @@ extern const char kFTDCIdField[];
 extern const char kFTDCTypeField[];
 
 extern const char kFTDCDataField[];
+extern const char kFTDCVersionField[];
 extern const char kFTDCDocField[];
 
 extern const char kFTDCDocsField[];
@@ -48,6 +49,8 @@ extern const char kFTDCDocsField[];
 extern const char kFTDCCollectStartField[];
 extern const char kFTDCCollectEndField[];
 
+extern const char kFTDCRegisteredMetricsField[];
+
 constexpr StringData kFTDCDefaultDirectory = "diagnostic.data"_sd;
 
 }  // namespace mongo
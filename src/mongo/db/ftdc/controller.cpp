@@ -36,6 +36,7 @@
 
 #include "mongo/db/client.h"
 #include "mongo/db/ftdc/collector.h"
+#include "mongo/db/ftdc/constants.h"
 #include "mongo/db/ftdc/util.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/logv2/log.h"
@@ -45,6 +46,7 @@
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/exit.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kFTDC
 
@@ -132,10 +134,24 @@ void FTDCController::addOnRotateCollector(std::unique_ptr<FTDCCollectorInterface
 }
 
 BSONObj FTDCController::getMostRecentPeriodicDocument() {
+    BSONObj document;
+    std::vector<std::uint64_t> values;
     {
         stdx::lock_guard<Latch> lock(_mutex);
-        return _mostRecentPeriodicDocument.getOwned();
+        document = _mostRecentPeriodicDocument.getOwned();
+        values = _mostRecentRegistryValues;
     }
+
+    if (document.isEmpty() || values.empty()) {
+        return document;
+    }
+
+    BSONObjBuilder builder;
+    builder.appendElements(document);
+    BSONObjBuilder registryBuilder(builder.subobjStart(kFTDCRegisteredMetricsField));
+    _metricRegistry->appendValues(values, &registryBuilder);
+    registryBuilder.doneFast();
+    return builder.obj();
 }
 
 void FTDCController::start() {
@@ -254,10 +270,19 @@ void FTDCController::doLoop() noexcept {
                 _mgr = uassertStatusOK(std::move(swMgr));
             }
 
+            Timer collectTimer;
             auto collectSample = _periodicCollectors.collect(client);
+            if (_slowCollections && collectTimer.elapsed() > _config.period) {
+                _slowCollections->increment();
+            }
+
+            std::vector<std::uint64_t> registryValues;
+            if (_metricRegistry) {
+                _metricRegistry->readValues(&registryValues);
+            }
 
             Status s = _mgr->writeSampleAndRotateIfNeeded(
-                client, std::get<0>(collectSample), std::get<1>(collectSample));
+                client, std::get<0>(collectSample), std::get<1>(collectSample), _metricRegistry);
 
             uassertStatusOK(s);
 
@@ -265,6 +290,7 @@ void FTDCController::doLoop() noexcept {
             {
                 stdx::lock_guard<Latch> lock(_mutex);
                 _mostRecentPeriodicDocument = std::get<0>(collectSample);
+                _mostRecentRegistryValues = std::move(registryValues);
             }
         }
     }
@@ -32,10 +32,12 @@
 #include <boost/filesystem/path.hpp>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/ftdc/collector.h"
 #include "mongo/db/ftdc/config.h"
 #include "mongo/db/ftdc/file_manager.h"
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
@@ -50,14 +52,27 @@ class ServiceContext;
  * and rotation.
  *
  * Exposes an methods to response to configuration changes in a thread-safe manner.
+ *
+ * If constructed with a metric registry, every periodic sample also records the registered
+ * metrics, including the time spent in each periodic collector and the number of collections
+ * which took longer than the period.
  */
 class FTDCController {
     FTDCController(const FTDCController&) = delete;
     FTDCController& operator=(const FTDCController&) = delete;
 
 public:
-    FTDCController(const boost::filesystem::path path, FTDCConfig config)
-        : _path(path), _config(std::move(config)), _configTemp(_config) {}
+    FTDCController(const boost::filesystem::path path,
+                   FTDCConfig config,
+                   FTDCMetricRegistry* metricRegistry = nullptr)
+        : _path(path),
+          _config(std::move(config)),
+          _configTemp(_config),
+          _metricRegistry(metricRegistry),
+          _slowCollections(metricRegistry
+                               ? &metricRegistry->registerMetric("ftdc.slowCollections")
+                               : nullptr),
+          _periodicCollectors(metricRegistry) {}
 
     ~FTDCController() = default;
 
@@ -138,7 +153,8 @@ public:
     static FTDCController* get(ServiceContext* serviceContext);
 
     /**
-     * Get a reference to most recent document from the periodic collectors.
+     * Get a reference to most recent document from the periodic collectors, with the values of
+     * the registered metrics read when it was collected.
      */
     BSONObj getMostRecentPeriodicDocument();
 
@@ -197,6 +213,12 @@ private:
     // Config settings that are manipulated by setters via setParameter.
     FTDCConfig _configTemp;
 
+    // Registry of the metrics recorded with every periodic sample, if any
+    FTDCMetricRegistry* const _metricRegistry;
+
+    // Number of periodic collections which took longer than the period
+    FTDCMetricRegistry::Metric* const _slowCollections;
+
     // Set of periodic collectors
     FTDCCollectorCollection _periodicCollectors;
 
@@ -204,6 +226,9 @@ private:
     // Owned
     BSONObj _mostRecentPeriodicDocument;
 
+    // Values of the registered metrics read with _mostRecentPeriodicDocument
+    std::vector<std::uint64_t> _mostRecentRegistryValues;
+
     // Set of file rotation collectors
     FTDCCollectorCollection _rotateCollectors;
 
@@ -44,6 +44,7 @@
 #include "mongo/db/ftdc/constants.h"
 #include "mongo/db/ftdc/controller.h"
 #include "mongo/db/ftdc/ftdc_test.h"
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
 #include "mongo/unittest/temp_dir.h"
@@ -159,6 +160,20 @@ public:
     }
 };
 
+class FTDCMetricsCollectorMockRegistry : public FTDCMetricsCollectorMockTee {
+public:
+    explicit FTDCMetricsCollectorMockRegistry(FTDCMetricRegistry::Metric* metric)
+        : _metric(metric) {}
+
+    void generateDocument(BSONObjBuilder& builder, std::uint32_t counter) final {
+        _metric->set(counter);
+        builder.append("counter", static_cast<int32_t>(counter));
+    }
+
+private:
+    FTDCMetricRegistry::Metric* const _metric;
+};
+
 // Test a run of the controller and the data it logs to log file
 TEST_F(FTDCControllerTest, TestFull) {
     unittest::TempDir tempdir("metrics_testpath");
@@ -283,4 +298,45 @@ TEST_F(FTDCControllerTest, TestStartAsDisabled) {
     ValidateDocumentList(alog, allDocs, FTDCValidationMode::kStrict);
 }
 
+// Test the most recent periodic document reports the registered metrics as of its collection
+TEST_F(FTDCControllerTest, TestMostRecentDocumentRegisteredMetrics) {
+    unittest::TempDir tempdir("metrics_testpath");
+    boost::filesystem::path dir(tempdir.path());
+
+    createDirectoryClean(dir);
+
+    FTDCConfig config;
+    config.enabled = true;
+    config.period = Milliseconds(1);
+    config.maxFileSizeBytes = FTDCConfig::kMaxFileSizeBytesDefault;
+    config.maxDirectorySizeBytes = FTDCConfig::kMaxDirectorySizeBytesDefault;
+
+    FTDCMetricRegistry registry;
+    auto& metric = registry.registerMetric("test.counter");
+
+    FTDCController c(dir, config, &registry);
+
+    auto c1 = std::make_unique<FTDCMetricsCollectorMockRegistry>(&metric);
+
+    auto c1Ptr = c1.get();
+
+    c1Ptr->setSignalOnCount(10);
+
+    c.addPeriodicCollector(std::move(c1));
+
+    c.start();
+
+    // Wait for 10 samples to have occured
+    c1Ptr->wait();
+
+    c.stop();
+
+    // Updates after the last sample are not reported with it.
+    metric.set(-1);
+
+    auto doc = c.getMostRecentPeriodicDocument();
+    auto registered = doc[kFTDCRegisteredMetricsField].Obj();
+    ASSERT_EQUALS(registered["test.counter"].numberLong(), doc["mock"]["counter"].numberLong());
+}
+
 }  // namespace mongo
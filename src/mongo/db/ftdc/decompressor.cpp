@@ -42,7 +42,8 @@
 
 namespace mongo {
 
-StatusWith<std::vector<BSONObj>> FTDCDecompressor::uncompress(ConstDataRange buf) {
+StatusWith<std::vector<BSONObj>> FTDCDecompressor::uncompress(ConstDataRange buf,
+                                                              FTDCCompression compression) {
     ConstDataRangeCursor compressedDataRange(buf);
 
     // Read the length of the uncompressed buffer
@@ -53,14 +54,15 @@ StatusWith<std::vector<BSONObj>> FTDCDecompressor::uncompress(ConstDataRange buf
     }
 
     // Now uncompress the data
-    // Limit size of the buffer we need zlib
+    // Limit size of the buffer we need to decompress into
     auto uncompressedLength = swUncompressedLength.getValue();
 
     if (uncompressedLength > 10000000) {
         return Status(ErrorCodes::InvalidLength, "Metrics chunk has exceeded the allowable size.");
     }
 
-    auto statusUncompress = _compressor.uncompress(compressedDataRange, uncompressedLength);
+    auto statusUncompress =
+        _compressor.uncompress(compressedDataRange, uncompressedLength, compression);
 
     if (!statusUncompress.isOK()) {
         return {statusUncompress.getStatus()};
@@ -54,8 +54,12 @@ public:
      * Will fail if the chunk is corrupt or too short.
      *
      * Returns N samples where N = sample count + 1. The 1 is the reference document.
+     *
+     * 'compression' is the algorithm the chunk was compressed with, as recorded in its metric
+     * chunk document.
      */
-    StatusWith<std::vector<BSONObj>> uncompress(ConstDataRange buf);
+    StatusWith<std::vector<BSONObj>> uncompress(
+        ConstDataRange buf, FTDCCompression compression = FTDCCompression::kZlib);
 
 private:
     BlockCompressor _compressor;
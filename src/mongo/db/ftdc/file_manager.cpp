@@ -327,8 +327,9 @@ Status FTDCFileManager::rotate(Client* client) {
 
 Status FTDCFileManager::writeSampleAndRotateIfNeeded(Client* client,
                                                      const BSONObj& sample,
-                                                     Date_t date) {
-    Status s = _writer.writeSample(sample, date);
+                                                     Date_t date,
+                                                     const FTDCMetricRegistry* registry) {
+    Status s = _writer.writeSample(sample, date, registry);
 
     if (!s.isOK()) {
         return s;
@@ -79,11 +79,14 @@ public:
     Status rotate(Client* client);
 
     /**
-     * Writes a sample to disk via FTDCFileWriter.
+     * Writes a sample, along with the metrics of 'registry' if set, to disk via FTDCFileWriter.
      *
      * Rotates files as needed.
      */
-    Status writeSampleAndRotateIfNeeded(Client* client, const BSONObj& sample, Date_t date);
+    Status writeSampleAndRotateIfNeeded(Client* client,
+                                        const BSONObj& sample,
+                                        Date_t date,
+                                        const FTDCMetricRegistry* registry = nullptr);
 
     /**
      * Closes the current file manager down.
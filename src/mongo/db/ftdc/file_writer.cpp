@@ -149,8 +149,10 @@ Status FTDCFileWriter::writeMetadata(const BSONObj& metadata, Date_t date) {
     return writeArchiveFileBuffer({wrapped.objdata(), static_cast<size_t>(wrapped.objsize())});
 }
 
-Status FTDCFileWriter::writeSample(const BSONObj& sample, Date_t date) {
-    auto ret = _compressor.addSample(sample, date);
+Status FTDCFileWriter::writeSample(const BSONObj& sample,
+                                   Date_t date,
+                                   const FTDCMetricRegistry* registry) {
+    auto ret = _compressor.addSample(sample, date, registry);
 
     if (!ret.isOK()) {
         return ret.getStatus();
@@ -169,7 +171,8 @@ Status FTDCFileWriter::writeSample(const BSONObj& sample, Date_t date) {
         }
 
         BSONObj o = FTDCBSONUtil::createBSONMetricChunkDocument(std::get<0>(swBuf.getValue()),
-                                                                std::get<1>(swBuf.getValue()));
+                                                                std::get<1>(swBuf.getValue()),
+                                                                _config->compression);
         return writeInterimFileBuffer({o.objdata(), static_cast<size_t>(o.objsize())});
     }
 
@@ -186,7 +189,8 @@ Status FTDCFileWriter::flush(const boost::optional<ConstDataRange>& range, Date_
             }
 
             BSONObj o = FTDCBSONUtil::createBSONMetricChunkDocument(std::get<0>(swBuf.getValue()),
-                                                                    std::get<1>(swBuf.getValue()));
+                                                                    std::get<1>(swBuf.getValue()),
+                                                                    _config->compression);
             Status s = writeArchiveFileBuffer({o.objdata(), static_cast<size_t>(o.objsize())});
 
             if (!s.isOK()) {
@@ -194,7 +198,8 @@ Status FTDCFileWriter::flush(const boost::optional<ConstDataRange>& range, Date_
             }
         }
     } else {
-        BSONObj o = FTDCBSONUtil::createBSONMetricChunkDocument(range.value(), date);
+        BSONObj o =
+            FTDCBSONUtil::createBSONMetricChunkDocument(range.value(), date, _config->compression);
         Status s = writeArchiveFileBuffer({o.objdata(), static_cast<size_t>(o.objsize())});
 
         if (!s.isOK()) {
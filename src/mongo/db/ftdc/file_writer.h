@@ -77,9 +77,12 @@ public:
     Status writeMetadata(const BSONObj& metadata, Date_t date);
 
     /**
-     * Write a sample to interim and/or archive log as needed.
+     * Write a sample to interim and/or archive log as needed, along with the metrics of
+     * 'registry' if set.
      */
-    Status writeSample(const BSONObj& sample, Date_t date);
+    Status writeSample(const BSONObj& sample,
+                       Date_t date,
+                       const FTDCMetricRegistry* registry = nullptr);
 
     /**
      * Close all the files and shutdown cleanly by zeroing the beginning of the interim file.
@@ -140,6 +140,52 @@ TEST_F(FTDCFileTest, TestFileBasicCompress) {
     ASSERT_EQUALS(sw.getValue(), false);
 }
 
+// Round trip zstd compressed metric chunks through a file
+TEST_F(FTDCFileTest, TestFileZstdCompress) {
+    unittest::TempDir tempdir("metrics_testpath");
+    boost::filesystem::path p(tempdir.path());
+    p /= kTestFile;
+
+    deleteFileIfNeeded(p);
+
+    BSONObj doc1 = BSON("name"
+                        << "joe"
+                        << "key1" << 34 << "key2" << 45);
+    BSONObj doc2 = BSON("name"
+                        << "joe"
+                        << "key3" << 34 << "key5" << 45);
+
+    FTDCConfig config;
+    config.compression = FTDCCompression::kZstd;
+    FTDCFileWriter writer(&config);
+
+    ASSERT_OK(writer.open(p));
+
+    ASSERT_OK(writer.writeSample(doc1, Date_t()));
+    ASSERT_OK(writer.writeSample(doc2, Date_t()));
+
+    writer.close().transitional_ignore();
+
+    FTDCFileReader reader;
+    ASSERT_OK(reader.open(p));
+
+    ASSERT_OK(reader.hasNext());
+
+    BSONObj doc1a = std::get<1>(reader.next());
+
+    ASSERT_BSONOBJ_EQ(doc1, doc1a);
+
+    ASSERT_OK(reader.hasNext());
+
+    BSONObj doc2a = std::get<1>(reader.next());
+
+    ASSERT_BSONOBJ_EQ(doc2, doc2a);
+
+    auto sw = reader.hasNext();
+    ASSERT_OK(sw);
+    ASSERT_EQUALS(sw.getValue(), false);
+}
+
 /**
  * Validates all the data that gets written to file is returned as is
  */
@@ -43,6 +43,7 @@
 #include "mongo/db/ftdc/controller.h"
 #include "mongo/db/ftdc/ftdc_server_gen.h"
 #include "mongo/db/ftdc/ftdc_system_stats.h"
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/mirror_maestro.h"
 #include "mongo/db/service_context.h"
@@ -69,6 +70,16 @@ FTDCController* getGlobalFTDCController() {
  */
 synchronized_value<boost::filesystem::path> ftdcDirectoryPathParameter;
 
+boost::optional<FTDCCompression> parseFTDCCompressor(StringData value) {
+    if (value == "zlib"_sd) {
+        return FTDCCompression::kZlib;
+    }
+    if (value == "zstd"_sd) {
+        return FTDCCompression::kZstd;
+    }
+    return boost::none;
+}
+
 }  // namespace
 
 FTDCStartupParams ftdcStartupParams;
@@ -171,6 +182,16 @@ Status onUpdateFTDCPerInterimUpdate(const std::int32_t potentialNewValue) {
     return Status::OK();
 }
 
+Status validateFTDCCompressor(const std::string& value, const boost::optional<TenantId>&) {
+    if (!parseFTDCCompressor(value)) {
+        return {ErrorCodes::BadValue,
+                str::stream() << "Unsupported diagnostic data compressor '" << value
+                              << "', expected 'zlib' or 'zstd'"};
+    }
+
+    return Status::OK();
+}
+
 FTDCSimpleInternalCommandCollector::FTDCSimpleInternalCommandCollector(StringData command,
                                                                        StringData name,
                                                                        StringData ns,
@@ -218,6 +239,9 @@ public:
         // document shape hurts FTDC compression.
         // "oplog" is included to append the earliest and latest optimes, which allow calculation of
         // the oplog window.
+        // "logicalSessionRecordCache" is filtered out because it locks the session catalog and the
+        // logical session cache. Its values are published to the FTDC metric registry instead, so
+        // they are recorded under "registeredMetrics" with dates as integers, see README.md.
 
         BSONObjBuilder commandBuilder;
         commandBuilder.append(kCommand, 1);
@@ -226,6 +250,7 @@ public:
         commandBuilder.append("defaultRWConcern", false);
         commandBuilder.append(MirrorMaestro::kServerStatusSectionName, true);
         commandBuilder.append("tenantMigrationAccessBlocker", false);
+        commandBuilder.append("logicalSessionRecordCache", false);
 
         // Avoid requesting metrics that aren't available during a shutdown.
         if (_serverShuttingDown) {
@@ -243,6 +268,8 @@ public:
                               BSON("query" << BSON("multiPlanner" << BSON("histograms" << false))
                                            << "apiVersions" << false));
 
+        // 'opLatencies.byCommand' is never requested, because its fields change whenever a command
+        // runs for the first time.
         if (gDiagnosticDataCollectionEnableLatencyHistograms.load()) {
             BSONObjBuilder subObjBuilder(commandBuilder.subobjStart("opLatencies"));
             subObjBuilder.append("histograms", true);
@@ -300,10 +327,12 @@ void startFTDC(boost::filesystem::path& path,
         ftdcStartupParams.maxSamplesPerArchiveMetricChunk.load();
     config.maxSamplesPerInterimMetricChunk =
         ftdcStartupParams.maxSamplesPerInterimMetricChunk.load();
+    config.compression = *parseFTDCCompressor(gDiagnosticDataCollectionCompressor);
 
     ftdcDirectoryPathParameter = path;
 
-    auto controller = std::make_unique<FTDCController>(path, config);
+    auto controller =
+        std::make_unique<FTDCController>(path, config, &FTDCMetricRegistry::get());
 
     // Install periodic collectors
     // These are collected on the period interval in FTDCConfig.
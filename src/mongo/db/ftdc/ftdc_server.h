@@ -134,6 +134,11 @@ Status onUpdateFTDCFileSize(std::int32_t value);
 Status onUpdateFTDCSamplesPerChunk(std::int32_t value);
 Status onUpdateFTDCPerInterimUpdate(std::int32_t value);
 
+/**
+ * Server Parameter validators
+ */
+Status validateFTDCCompressor(const std::string& value, const boost::optional<TenantId>&);
+
 /**
  * Server Parameter accessors
  */
@@ -70,4 +70,25 @@ TEST(FTDCUtilTest, TestMongoSPath) {
     }
 }
 
+// Validate metric chunks only record a version when they are not zlib compressed.
+TEST(FTDCUtilTest, TestMetricChunkVersion) {
+    const char data[] = "chunk";
+    ConstDataRange buf(data, sizeof(data));
+
+    auto zlibDoc = FTDCBSONUtil::createBSONMetricChunkDocument(buf, Date_t());
+    ASSERT_FALSE(zlibDoc.hasField("v"));
+
+    auto zstdDoc =
+        FTDCBSONUtil::createBSONMetricChunkDocument(buf, Date_t(), FTDCCompression::kZstd);
+    ASSERT_EQ(zstdDoc["v"].numberInt(), static_cast<int>(FTDCCompression::kZstd));
+
+    BSONObjBuilder builder;
+    builder.appendElements(zlibDoc);
+    builder.append("v", 3);
+
+    FTDCDecompressor decompressor;
+    ASSERT_EQ(FTDCBSONUtil::getMetricsFromMetricDoc(builder.obj(), &decompressor).getStatus(),
+              ErrorCodes::BadValue);
+}
+
 }  // namespace mongo
@@ -0,0 +1,92 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/ftdc/metric_registry.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/static_immortal.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+
+FTDCMetricRegistry::FTDCMetricRegistry()
+    : _metrics(std::make_unique<CacheExclusive<Metric>[]>(kMaxMetrics)) {
+    _names.reserve(kMaxMetrics);
+}
+
+FTDCMetricRegistry& FTDCMetricRegistry::get() {
+    static StaticImmortal<FTDCMetricRegistry> registry;
+    return *registry;
+}
+
+FTDCMetricRegistry::Metric& FTDCMetricRegistry::registerMetric(StringData name) {
+    stdx::lock_guard<Latch> lk(_mutex);
+
+    if (auto it = _indexes.find(name); it != _indexes.end()) {
+        return *_metrics[it->second];
+    }
+
+    const auto index = _names.size();
+    tassert(9394700,
+            str::stream() << "Cannot register more than " << kMaxMetrics
+                          << " FTDC metrics, registering: " << name,
+            index < kMaxMetrics);
+
+    _names.emplace_back(name.toString());
+    _indexes.emplace(name, index);
+
+    // Publishes the slot to readValues() only once its name can be appended.
+    _size.store(index + 1);
+    return *_metrics[index];
+}
+
+void FTDCMetricRegistry::readValues(std::vector<std::uint64_t>* values) const {
+    const auto size = _size.load();
+    values->resize(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        (*values)[i] = _metrics[i]->get();
+    }
+}
+
+void FTDCMetricRegistry::appendValues(const std::vector<std::uint64_t>& values,
+                                      BSONObjBuilder* builder) const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    invariant(values.size() <= _names.size());
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        builder->append(_names[i], static_cast<long long>(values[i]));
+    }
+}
+
+}  // namespace mongo
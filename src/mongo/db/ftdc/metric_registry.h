@@ -0,0 +1,133 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/aligned.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+
+/**
+ * A registry of numeric metrics which subsystems publish for full-time diagnostic data capture
+ * without implementing a collector.
+ *
+ * A subsystem registers a metric once and keeps the returned slot, which it then updates with a
+ * relaxed atomic operation on its own cache line. The FTDC compressor reads the values of all
+ * slots directly on every sample, and only builds a BSON document with their names when the set of
+ * registered metrics changes, instead of running a collector which builds a BSON document every
+ * period.
+ *
+ * Metrics are never unregistered, so the metrics registered at some point are always a prefix of
+ * the metrics registered later.
+ */
+class FTDCMetricRegistry {
+    FTDCMetricRegistry(const FTDCMetricRegistry&) = delete;
+    FTDCMetricRegistry& operator=(const FTDCMetricRegistry&) = delete;
+
+public:
+    static constexpr std::size_t kMaxMetrics = 1024;
+
+    class Metric {
+    public:
+        void set(std::int64_t value) {
+            _value.store(value);
+        }
+
+        void increment(std::int64_t n = 1) {
+            _value.fetchAndAddRelaxed(n);
+        }
+
+        std::int64_t get() const {
+            return _value.loadRelaxed();
+        }
+
+    private:
+        AtomicWord<std::int64_t> _value;
+    };
+
+    FTDCMetricRegistry();
+
+    /**
+     * Returns the process-wide registry, whose metrics the server's FTDC controller records.
+     */
+    static FTDCMetricRegistry& get();
+
+    /**
+     * Returns the slot of the metric named 'name', registering it if necessary. Names are used as
+     * field names in the FTDC documents, so dotted names are displayed as paths by FTDC tools.
+     */
+    Metric& registerMetric(StringData name);
+
+    /**
+     * Returns the number of registered metrics.
+     */
+    std::size_t size() const {
+        return _size.load();
+    }
+
+    /**
+     * Replaces the contents of 'values' with the current values of the registered metrics, in
+     * registration order. Does not lock.
+     */
+    void readValues(std::vector<std::uint64_t>* values) const;
+
+    /**
+     * Appends one field per value of 'values', as read by readValues(), named after the metric.
+     */
+    void appendValues(const std::vector<std::uint64_t>& values, BSONObjBuilder* builder) const;
+
+private:
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("FTDCMetricRegistry::_mutex");
+
+    // Names of the registered metrics in registration order, and their index. Guarded by _mutex.
+    std::vector<std::string> _names;
+    StringMap<std::size_t> _indexes;
+
+    // Number of registered metrics, whose slots are safe to read without the mutex.
+    AtomicWord<std::size_t> _size{0};
+
+    std::unique_ptr<CacheExclusive<Metric>[]> _metrics;
+};
+
+}  // namespace mongo
@@ -0,0 +1,122 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/platform/basic.h"
+
+#include "mongo/db/ftdc/metric_registry.h"
+
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+TEST(FTDCMetricRegistryTest, RegisterAndRead) {
+    FTDCMetricRegistry registry;
+    ASSERT_EQ(registry.size(), 0);
+
+    auto& first = registry.registerMetric("first");
+    auto& second = registry.registerMetric("second.nested");
+    ASSERT_EQ(registry.size(), 2);
+
+    // Registering a name again returns the same slot.
+    ASSERT_EQ(&registry.registerMetric("first"), &first);
+    ASSERT_EQ(registry.size(), 2);
+
+    first.increment(3);
+    second.set(-1);
+
+    std::vector<std::uint64_t> values;
+    registry.readValues(&values);
+    ASSERT_EQ(values.size(), 2);
+    ASSERT_EQ(values[0], 3);
+    ASSERT_EQ(static_cast<std::int64_t>(values[1]), -1);
+
+    BSONObjBuilder builder;
+    registry.appendValues(values, &builder);
+    ASSERT_BSONOBJ_EQ(builder.obj(), BSON("first" << 3LL << "second.nested" << -1LL));
+}
+
+TEST(FTDCMetricRegistryTest, AppendValuesOnlyNamesReadMetrics) {
+    FTDCMetricRegistry registry;
+    registry.registerMetric("a").set(1);
+
+    std::vector<std::uint64_t> values;
+    registry.readValues(&values);
+    registry.registerMetric("b").set(2);
+
+    BSONObjBuilder builder;
+    registry.appendValues(values, &builder);
+    ASSERT_BSONOBJ_EQ(builder.obj(), BSON("a" << 1LL));
+}
+
+TEST(FTDCMetricRegistryTest, ConcurrentUpdatesAndRegistration) {
+    constexpr int kThreads = 4;
+    constexpr int kIncrements = 10000;
+
+    FTDCMetricRegistry registry;
+    auto& shared = registry.registerMetric("shared");
+
+    std::vector<stdx::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&, t] {
+            auto& own = registry.registerMetric("thread" + std::to_string(t));
+            for (int i = 0; i < kIncrements; ++i) {
+                shared.increment();
+                own.increment();
+            }
+        });
+    }
+
+    std::vector<std::uint64_t> values;
+    for (int i = 0; i < 100; ++i) {
+        registry.readValues(&values);
+        ASSERT_LTE(values.size(), kThreads + 1);
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    registry.readValues(&values);
+    ASSERT_EQ(values.size(), kThreads + 1);
+    ASSERT_EQ(values[0], kThreads * kIncrements);
+    for (int t = 1; t <= kThreads; ++t) {
+        ASSERT_EQ(values[t], kIncrements);
+    }
+}
+
+}  // namespace
+}  // namespace mongo
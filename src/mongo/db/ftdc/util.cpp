@@ -59,6 +59,7 @@ const char kFTDCIdField[] = "_id";
 const char kFTDCTypeField[] = "type";
 
 const char kFTDCDataField[] = "data";
+const char kFTDCVersionField[] = "v";
 const char kFTDCDocField[] = "doc";
 
 const char kFTDCDocsField[] = "docs";
@@ -66,6 +67,8 @@ const char kFTDCDocsField[] = "docs";
 const char kFTDCCollectStartField[] = "start";
 const char kFTDCCollectEndField[] = "end";
 
+const char kFTDCRegisteredMetricsField[] = "registeredMetrics";
+
 const std::int64_t FTDCConfig::kPeriodMillisDefault = 1000;
 
 const std::size_t kMaxRecursion = 10;
@@ -437,13 +440,20 @@ BSONObj createBSONMetadataDocument(const BSONObj& metadata, Date_t date) {
     return builder.obj();
 }
 
-BSONObj createBSONMetricChunkDocument(ConstDataRange buf, Date_t date) {
+BSONObj createBSONMetricChunkDocument(ConstDataRange buf,
+                                      Date_t date,
+                                      FTDCCompression compression) {
     BSONObjBuilder builder;
 
     builder.appendDate(kFTDCIdField, date);
     builder.appendNumber(kFTDCTypeField, static_cast<int>(FTDCType::kMetricChunk));
     builder.appendBinData(kFTDCDataField, buf.length(), BinDataType::BinDataGeneral, buf.data());
 
+    // Chunks without a version are zlib compressed, which keeps them readable by older tools.
+    if (compression != FTDCCompression::kZlib) {
+        builder.appendNumber(kFTDCVersionField, static_cast<int>(compression));
+    }
+
     return builder.obj();
 }
 
@@ -513,7 +523,22 @@ StatusWith<std::vector<BSONObj>> getMetricsFromMetricDoc(const BSONObj& obj,
                 str::stream() << "Field " << std::string(kFTDCTypeField) << " is not a BinData."};
     }
 
-    return decompressor->uncompress({buffer, static_cast<std::size_t>(length)});
+    long long version;
+    status = bsonExtractIntegerFieldWithDefault(
+        obj, kFTDCVersionField, static_cast<long long>(FTDCCompression::kZlib), &version);
+    if (!status.isOK()) {
+        return {status};
+    }
+
+    if (static_cast<FTDCCompression>(version) != FTDCCompression::kZlib &&
+        static_cast<FTDCCompression>(version) != FTDCCompression::kZstd) {
+        return {ErrorCodes::BadValue,
+                str::stream() << "Field '" << std::string(kFTDCVersionField)
+                              << "' is not an expected value, found '" << version << "'"};
+    }
+
+    return decompressor->uncompress({buffer, static_cast<std::size_t>(length)},
+                                    static_cast<FTDCCompression>(version));
 }
 
 }  // namespace FTDCBSONUtil
@@ -147,9 +147,15 @@ BSONObj createBSONMetadataDocument(const BSONObj& metadata, Date_t date);
  *  "_id" : Date_t
  *  "type" : 1
  *  "data" : BinData(...)
+ *  "v" : 2
  * }
+ *
+ * The version field records the algorithm the chunk was compressed with. It is omitted for zlib,
+ * the only algorithm of the original format.
  */
-BSONObj createBSONMetricChunkDocument(ConstDataRange buf, Date_t now);
+BSONObj createBSONMetricChunkDocument(ConstDataRange buf,
+                                      Date_t now,
+                                      FTDCCompression compression = FTDCCompression::kZlib);
 
 /**
  * Get the _id field of a BSON document
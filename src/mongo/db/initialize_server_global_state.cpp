@@ -292,6 +292,15 @@ void forkServerOrDie() {
 
 namespace {
 
+boost::optional<logv2::LogOverflowPolicy> parseLogOverflowPolicy(StringData value) {
+    if (value == "block"_sd) {
+        return logv2::LogOverflowPolicy::kBlock;
+    } else if (value == "drop"_sd) {
+        return logv2::LogOverflowPolicy::kDrop;
+    }
+    return boost::none;
+}
+
 bool checkAndMoveLogFile(const std::string& absoluteLogpath) {
     bool exists;
 
@@ -370,6 +379,9 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
             ? logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kAppend
             : logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kTruncate;
 
+        lv2Config.fileAsyncQueueSize = gLogAsyncWriteQueueSize;
+        lv2Config.fileAsyncOverflowPolicy = *parseLogOverflowPolicy(gLogAsyncWriteOverflowPolicy);
+
         if (serverGlobalParams.logAppend && exists) {
             writeServerRestartedAfterLogConfig = true;
         }
@@ -546,4 +558,15 @@ void ProcessUMaskServerParameter::append(OperationContext*,
 #endif
 }
 
+Status validateLogAsyncWriteOverflowPolicy(const std::string& value,
+                                           const boost::optional<TenantId>&) {
+    if (!parseLogOverflowPolicy(value)) {
+        return {ErrorCodes::BadValue,
+                str::stream() << "Unsupported log overflow policy '" << value
+                              << "', expected 'block' or 'drop'"};
+    }
+
+    return Status::OK();
+}
+
 }  // namespace mongo::initialize_server_global_state
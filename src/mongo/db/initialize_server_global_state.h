@@ -29,7 +29,12 @@
 
 #pragma once
 
+#include <boost/optional.hpp>
+#include <string>
+
+#include "mongo/base/status.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/tenant_id.h"
 
 namespace mongo::initialize_server_global_state {
 
@@ -57,4 +62,10 @@ void forkServerOrDie();
  */
 void signalForkSuccess();
 
+/**
+ * Validates the logAsyncWriteOverflowPolicy server parameter.
+ */
+Status validateLogAsyncWriteOverflowPolicy(const std::string& value,
+                                           const boost::optional<TenantId>&);
+
 }  // namespace mongo::initialize_server_global_state
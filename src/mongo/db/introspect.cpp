@@ -29,19 +29,27 @@
 
 #include "mongo/db/introspect.h"
 
+#include <map>
+#include <vector>
+
 #include "mongo/bson/util/builder.h"
 #include "mongo/db/auth/authorization_manager.h"
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/catalog/collection_write_path.h"
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/concurrency/locker_impl.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/db_raii.h"
+#include "mongo/db/introspect_gen.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/stats/resource_consumption_metrics.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/rpc/metadata/client_metadata.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/fail_point.h"
 #include "mongo/util/scopeguard.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kDefault
@@ -52,6 +60,234 @@ using std::endl;
 using std::string;
 using std::unique_ptr;
 
+namespace {
+
+// Leaves the entries buffered instead of writing them, until the fail point is disabled and another
+// entry is buffered, or until the writer shuts down.
+MONGO_FAIL_POINT_DEFINE(pauseProfileWriter);
+
+auto kLogInterval = stdx::chrono::minutes(1);
+
+/**
+ * Inserts profiler entries into the system.profile collections on a background thread, see
+ * startProfileWriter().
+ *
+ * Like DeferredWriter, entries are buffered up to a number of bytes and new entries are dropped
+ * while the buffer is full. Unlike DeferredWriter, the buffered entries are written in batches, one
+ * WriteUnitOfWork per database, so that a burst of profiled operations costs a few inserts.
+ */
+class ProfileWriter {
+public:
+    explicit ProfileWriter(int64_t maxNumBytes) : _maxNumBytes(maxNumBytes) {}
+
+    void startup() {
+        ThreadPool::Options options;
+        options.poolName = "profile writer pool";
+        options.threadNamePrefix = "ProfileWriter";
+        options.minThreads = 0;
+        options.maxThreads = 1;
+        options.onCreateThread = [](const std::string& name) {
+            Client::initThread(name);
+
+            // TODO(SERVER-74657): Please revisit if this thread could be made killable.
+            stdx::lock_guard<Client> lk(cc());
+            cc().setSystemOperationUnkillableByStepdown(lk);
+        };
+        _pool = std::make_unique<ThreadPool>(options);
+        _pool->startup();
+    }
+
+    void shutdown() {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _inShutdown = true;
+            _scheduleWrite(lk);
+        }
+
+        _pool->waitForIdle();
+        _pool->shutdown();
+        _pool->join();
+    }
+
+    /**
+     * Buffers 'doc' to be inserted into the system.profile collection of the database of 'nss'.
+     * Returns false if the buffer is full and the entry was dropped.
+     */
+    bool insert(const NamespaceString& nss, BSONObj doc) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_inShutdown || _numBytes + doc.objsize() > _maxNumBytes) {
+            _logDroppedEntry(lk);
+            return false;
+        }
+
+        _numBytes += doc.objsize();
+        _buffer.push_back({nss.dbName(), std::move(doc)});
+        if (!MONGO_unlikely(pauseProfileWriter.shouldFail())) {
+            _scheduleWrite(lk);
+        }
+        return true;
+    }
+
+    BSONObj getStats() const {
+        stdx::lock_guard<Latch> lk(_mutex);
+        return BSON("bufferedBytes" << _numBytes << "written" << _written << "dropped"
+                                    << _dropped << "batches" << _batches);
+    }
+
+private:
+    struct Entry {
+        DatabaseName dbName;
+        BSONObj doc;
+    };
+
+    void _scheduleWrite(WithLock) {
+        if (_writeScheduled || _buffer.empty()) {
+            return;
+        }
+        _writeScheduled = true;
+        _pool->schedule([this](Status status) {
+            fassert(9395000, status);
+            _writeBuffered();
+        });
+    }
+
+    // Writes batches of buffered entries until the buffer is empty.
+    void _writeBuffered() {
+        while (true) {
+            std::vector<Entry> entries;
+            {
+                stdx::lock_guard<Latch> lk(_mutex);
+                if (_buffer.empty()) {
+                    _writeScheduled = false;
+                    return;
+                }
+                entries.swap(_buffer);
+                _numBytes = 0;
+                ++_batches;
+            }
+
+            std::map<DatabaseName, std::vector<InsertStatement>> byDatabase;
+            for (auto& entry : entries) {
+                byDatabase[entry.dbName].emplace_back(std::move(entry.doc));
+            }
+
+            for (const auto& [dbName, docs] : byDatabase) {
+                auto status = _write(dbName, docs);
+                if (status == ErrorCodes::InterruptedAtShutdown) {
+                    // Shutdown killed the write, retry it as part of shutdown.
+                    status = _write(dbName, docs);
+                }
+
+                stdx::lock_guard<Latch> lk(_mutex);
+                if (status.isOK()) {
+                    _written += docs.size();
+                } else {
+                    _logFailure(lk, dbName, status);
+                }
+            }
+        }
+    }
+
+    Status _write(const DatabaseName& dbName, const std::vector<InsertStatement>& docs) try {
+        auto uniqueOpCtx = cc().makeOperationContext();
+        auto opCtx = uniqueOpCtx.get();
+        if (opCtx->getServiceContext()->getKillAllOperations()) {
+            // Shutdown kills all operations before it shuts down the writer, which must still
+            // write out the buffered entries.
+            stdx::lock_guard<Client> lk(cc());
+            opCtx->setIsExecutingShutdown();
+        }
+
+        const auto dbProfilingNS = NamespaceString::makeSystemDotProfileNamespace(dbName);
+        AutoGetCollection autoColl(opCtx, dbProfilingNS, MODE_IX);
+        Database* const db = autoColl.getDb();
+        if (!db) {
+            // Database disappeared.
+            return Status::OK();
+        }
+
+        uassertStatusOK(createProfileCollection(opCtx, db));
+        CollectionPtr coll(
+            CollectionCatalog::get(opCtx)->lookupCollectionByNamespace(opCtx, dbProfilingNS));
+
+        return writeConflictRetry(opCtx, "profile", dbProfilingNS, [&] {
+            WriteUnitOfWork wuow(opCtx);
+            OpDebug* const nullOpDebug = nullptr;
+            auto status = collection_internal::insertDocuments(
+                opCtx, coll, docs.begin(), docs.end(), nullOpDebug, false);
+            if (!status.isOK()) {
+                return status;
+            }
+            wuow.commit();
+            return Status::OK();
+        });
+    } catch (const DBException& ex) {
+        return ex.toStatus();
+    }
+
+    void _logFailure(WithLock, const DatabaseName& dbName, const Status& status) {
+        if (TimePoint::clock::now() - _lastLoggedFailure > kLogInterval) {
+            LOGV2_WARNING(9395001,
+                          "Unable to write profiler entries",
+                          logAttrs(dbName),
+                          "error"_attr = redact(status));
+            _lastLoggedFailure = TimePoint::clock::now();
+        }
+    }
+
+    void _logDroppedEntry(WithLock) {
+        ++_dropped;
+        ++_droppedSinceLogged;
+        if (TimePoint::clock::now() - _lastLoggedDrop > kLogInterval) {
+            LOGV2(9395002,
+                  "Profile writer buffer is full, dropped profiler entries",
+                  "droppedEntries"_attr = _droppedSinceLogged);
+            _lastLoggedDrop = TimePoint::clock::now();
+            _droppedSinceLogged = 0;
+        }
+    }
+
+    const int64_t _maxNumBytes;
+
+    std::unique_ptr<ThreadPool> _pool;
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("ProfileWriter::_mutex");
+    std::vector<Entry> _buffer;
+    int64_t _numBytes = 0;
+    bool _writeScheduled = false;
+    bool _inShutdown = false;
+
+    long long _written = 0;
+    long long _dropped = 0;
+    long long _droppedSinceLogged = 0;
+    long long _batches = 0;
+
+    using TimePoint = stdx::chrono::time_point<stdx::chrono::system_clock>;
+    TimePoint _lastLoggedFailure;
+    TimePoint _lastLoggedDrop;
+};
+
+const auto getProfileWriter = ServiceContext::declareDecoration<std::unique_ptr<ProfileWriter>>();
+
+class ProfileWriterSSS : public ServerStatusSection {
+public:
+    ProfileWriterSSS() : ServerStatusSection("profileWriter") {}
+
+    ~ProfileWriterSSS() override = default;
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        auto& writer = getProfileWriter(opCtx->getServiceContext());
+        return writer ? writer->getStats() : BSONObj();
+    }
+} profileWriterSSS;
+
+}  // namespace
+
 void profile(OperationContext* opCtx, NetworkOp op) {
     // Initialize with 1kb at start in order to avoid realloc later
     BufBuilder profileBufBuilder(1024);
@@ -90,6 +326,11 @@ void profile(OperationContext* opCtx, NetworkOp op) {
 
     const auto ns = CurOp::get(opCtx)->getNSS();
 
+    if (auto& writer = getProfileWriter(opCtx->getServiceContext())) {
+        writer->insert(ns, p.getOwned());
+        return;
+    }
+
     try {
         // We create a new opCtx so that we aren't interrupted by having the original operation
         // killed or timed out. Those are the case we want to have profiling data.
@@ -145,6 +386,23 @@ void profile(OperationContext* opCtx, NetworkOp op) {
 }
 
 
+void startProfileWriter(ServiceContext* serviceContext) {
+    if (gProfilingAsyncWriteBufferSizeBytes <= 0) {
+        return;
+    }
+
+    auto& writer = getProfileWriter(serviceContext);
+    invariant(!writer);
+    writer = std::make_unique<ProfileWriter>(gProfilingAsyncWriteBufferSizeBytes);
+    writer->startup();
+}
+
+void shutdownProfileWriter(ServiceContext* serviceContext) {
+    if (auto& writer = getProfileWriter(serviceContext)) {
+        writer->shutdown();
+    }
+}
+
 Status createProfileCollection(OperationContext* opCtx, Database* db) {
     invariant(opCtx->lockState()->isDbLockedForMode(db->name(), MODE_IX));
 
@@ -36,12 +36,25 @@ namespace mongo {
 
 class Database;
 class OperationContext;
+class ServiceContext;
 
 /**
  * Invoked when database profile is enabled.
  */
 void profile(OperationContext* opCtx, NetworkOp op);
 
+/**
+ * Starts the background writer for profiler entries if profilingAsyncWriteBufferSizeBytes is set.
+ * profile() then only builds the entry on the operation's thread and buffers it, and the writer
+ * inserts the buffered entries in batches.
+ */
+void startProfileWriter(ServiceContext* serviceContext);
+
+/**
+ * Writes out the buffered profiler entries and stops the background writer, if it was started.
+ */
+void shutdownProfileWriter(ServiceContext* serviceContext);
+
 /**
  * Pre-creates the profile collection for the specified database.
  */
@@ -206,6 +206,7 @@
 #include "mongo/idl/cluster_server_parameter_initializer.h"
 #include "mongo/idl/cluster_server_parameter_op_observer.h"
 #include "mongo/logv2/log.h"
+#include "mongo/logv2/log_util.h"
 #include "mongo/platform/process_id.h"
 #include "mongo/platform/random.h"
 #include "mongo/rpc/metadata/egress_metadata_hook_list.h"
@@ -654,6 +655,9 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
     HealthLogInterface::set(serviceContext, std::make_unique<HealthLog>());
     HealthLogInterface::get(startupOpCtx.get())->startup();
 
+    // Start up the profile writer thread, if profiler entries are written asynchronously.
+    startProfileWriter(serviceContext);
+
     auto const globalLDAPManager = LDAPManager::get(serviceContext);
     if (globalLDAPManager) {
         globalLDAPManager->start_threads();
@@ -1646,6 +1650,9 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
         healthLog->shutdown();
     }
 
+    LOGV2(9395003, "Shutting down the profile writer");
+    shutdownProfileWriter(serviceContext);
+
     LOGV2(4784928, "Shutting down the TTL monitor");
     shutdownTTLMonitor(serviceContext);
 
@@ -1789,6 +1796,7 @@ int mongod_main(int argc, char* argv[]) {
     // Per SERVER-7434, startSignalProcessingThread must run after any forks (i.e.
     // initialize_server_global_state::forkServerOrDie) and before the creation of any other threads
     startSignalProcessingThread();
+    logv2::startAsyncFileWriter();
 
     ReadWriteConcernDefaults::create(service, readWriteConcernDefaultsCacheLookupMongoD);
     ChangeStreamOptionsManager::create(service);
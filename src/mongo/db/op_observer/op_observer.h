@@ -412,6 +412,19 @@ public:
                                const NamespaceString& collectionName,
                                const UUID& uuid) = 0;
 
+    /**
+     * Called when the records in [minRecordId, maxRecordId] of 'coll' have been removed with a
+     * single range truncate rather than one delete per document. 'bytesDeleted' and
+     * 'docsDeleted' describe the removed range, so that nodes applying the operation can adjust
+     * the collection size and count without reading the truncated records.
+     */
+    virtual void onTruncateRange(OperationContext* opCtx,
+                                 const CollectionPtr& coll,
+                                 const RecordId& minRecordId,
+                                 const RecordId& maxRecordId,
+                                 int64_t bytesDeleted,
+                                 int64_t docsDeleted) = 0;
+
     /**
      * The onTransaction Start method is called at the beginning of a multi-document transaction.
      * It must not be called when the transaction is already in progress.
@@ -1516,6 +1516,34 @@ void OpObserverImpl::onEmptyCapped(OperationContext* opCtx,
     }
 }
 
+void OpObserverImpl::onTruncateRange(OperationContext* opCtx,
+                                     const CollectionPtr& coll,
+                                     const RecordId& minRecordId,
+                                     const RecordId& maxRecordId,
+                                     int64_t bytesDeleted,
+                                     int64_t docsDeleted) {
+    const auto& nss = coll->ns();
+    if (nss.isSystemDotProfile()) {
+        // Do not replicate system.profile modifications
+        return;
+    }
+
+    BSONObjBuilder cmdBuilder;
+    cmdBuilder.append("truncateRange", nss.coll());
+    minRecordId.serializeToken("minRecordId", &cmdBuilder);
+    maxRecordId.serializeToken("maxRecordId", &cmdBuilder);
+    cmdBuilder.append("bytesDeleted", bytesDeleted);
+    cmdBuilder.append("docsDeleted", docsDeleted);
+
+    MutableOplogEntry oplogEntry;
+    oplogEntry.setOpType(repl::OpTypeEnum::kCommand);
+    oplogEntry.setTid(nss.tenantId());
+    oplogEntry.setNss(nss.getCommandNS());
+    oplogEntry.setUuid(coll->uuid());
+    oplogEntry.setObject(cmdBuilder.done());
+    logOperation(opCtx, &oplogEntry, true /*assignWallClockTime*/, _oplogWriter.get());
+}
+
 namespace {
 
 /**
@@ -209,6 +209,13 @@ public:
                        const NamespaceString& collectionName,
                        const UUID& uuid) override {}
 
+    void onTruncateRange(OperationContext* opCtx,
+                         const CollectionPtr& coll,
+                         const RecordId& minRecordId,
+                         const RecordId& maxRecordId,
+                         int64_t bytesDeleted,
+                         int64_t docsDeleted) override {}
+
     void onTransactionStart(OperationContext* opCtx) override {}
 
     void onUnpreparedTransactionCommit(OperationContext* opCtx,
@@ -0,0 +1,136 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/operation_phase_timer.h"
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+namespace {
+
+const auto getOperationPhaseTimers = OperationContext::declareDecoration<OperationPhaseTimers>();
+
+}  // namespace
+
+StringData toString(OperationPhase phase) {
+    switch (phase) {
+        case OperationPhase::kParse:
+            return "parse"_sd;
+        case OperationPhase::kPlan:
+            return "plan"_sd;
+        case OperationPhase::kExecute:
+            return "execute"_sd;
+        case OperationPhase::kStorageRead:
+            return "storageRead"_sd;
+        case OperationPhase::kPrepareConflict:
+            return "prepareConflict"_sd;
+        case OperationPhase::kTicketWait:
+            return "ticketWait"_sd;
+        case OperationPhase::kYield:
+            return "yield"_sd;
+        case OperationPhase::kNumPhases:
+            break;
+    }
+    MONGO_UNREACHABLE;
+}
+
+void OperationPhaseTimes::add(const OperationPhaseTimes& other) {
+    for (size_t i = 0; i < kNumPhases; ++i) {
+        _micros[i] += other._micros[i];
+    }
+}
+
+bool OperationPhaseTimes::empty() const {
+    for (const auto& micros : _micros) {
+        if (micros != Microseconds{0}) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void OperationPhaseTimes::append(BSONObjBuilder* builder) const {
+    for (size_t i = 0; i < kNumPhases; ++i) {
+        if (_micros[i] != Microseconds{0}) {
+            builder->append(toString(static_cast<OperationPhase>(i)),
+                            durationCount<Microseconds>(_micros[i]));
+        }
+    }
+}
+
+BSONObj OperationPhaseTimes::toBSON() const {
+    BSONObjBuilder builder;
+    append(&builder);
+    return builder.obj();
+}
+
+OperationPhaseTimers* OperationPhaseTimers::get(OperationContext* opCtx) {
+    return &getOperationPhaseTimers(opCtx);
+}
+
+OperationPhaseTimes OperationPhaseTimers::snapshot() const {
+    OperationPhaseTimes times;
+    for (size_t i = 0; i < OperationPhaseTimes::kNumPhases; ++i) {
+        times.add(static_cast<OperationPhase>(i), Microseconds{_micros[i].loadRelaxed()});
+    }
+    return times;
+}
+
+void OperationPhaseTimers::reset() {
+    for (auto& micros : _micros) {
+        micros.store(0);
+    }
+}
+
+ScopedOperationPhaseTimer::ScopedOperationPhaseTimer(OperationContext* opCtx, OperationPhase phase)
+    : _phase(phase) {
+    if (!opCtx) {
+        return;
+    }
+    _timers = OperationPhaseTimers::get(opCtx);
+    _tickSource = opCtx->getServiceContext()->getTickSource();
+    _start = _tickSource->getTicks();
+}
+
+ScopedOperationPhaseTimer::~ScopedOperationPhaseTimer() {
+    if (!_timers) {
+        return;
+    }
+    _timers->record(_phase, _tickSource->ticksTo<Microseconds>(_tickSource->getTicks() - _start));
+}
+
+}  // namespace mongo
@@ -0,0 +1,145 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "mongo/base/string_data.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/tick_source.h"
+
+namespace mongo {
+
+class BSONObj;
+class BSONObjBuilder;
+class OperationContext;
+
+/**
+ * The phases of an operation whose wall-clock time is accounted separately. The phases may nest
+ * (e.g. storage reads and yields happen while executing), so the sum of all phases is not
+ * expected to equal the total duration of the operation.
+ */
+enum class OperationPhase {
+    kParse,
+    kPlan,
+    kExecute,
+    kStorageRead,
+    kPrepareConflict,
+    kTicketWait,
+    kYield,
+    kNumPhases
+};
+
+StringData toString(OperationPhase phase);
+
+/**
+ * A copyable set of per-phase durations. Used to report the phase breakdown of a single operation
+ * and to aggregate it across operations, e.g. per query shape.
+ */
+class OperationPhaseTimes {
+public:
+    static constexpr size_t kNumPhases = static_cast<size_t>(OperationPhase::kNumPhases);
+
+    Microseconds get(OperationPhase phase) const {
+        return _micros[static_cast<size_t>(phase)];
+    }
+
+    void add(OperationPhase phase, Microseconds micros) {
+        _micros[static_cast<size_t>(phase)] += micros;
+    }
+
+    void add(const OperationPhaseTimes& other);
+
+    void reset() {
+        _micros.fill(Microseconds{0});
+    }
+
+    bool empty() const;
+
+    bool operator==(const OperationPhaseTimes& other) const {
+        return _micros == other._micros;
+    }
+
+    /**
+     * Appends the non-zero phases as "<phase>: <micros>" fields.
+     */
+    void append(BSONObjBuilder* builder) const;
+    BSONObj toBSON() const;
+
+private:
+    std::array<Microseconds, kNumPhases> _micros{};
+};
+
+/**
+ * Accumulates the phase durations of the operation it decorates. Phases are recorded by the thread
+ * running the operation, but the accumulated values may be read concurrently, e.g. by $currentOp.
+ */
+class OperationPhaseTimers {
+public:
+    static OperationPhaseTimers* get(OperationContext* opCtx);
+
+    void record(OperationPhase phase, Microseconds micros) {
+        _micros[static_cast<size_t>(phase)].fetchAndAddRelaxed(durationCount<Microseconds>(micros));
+    }
+
+    OperationPhaseTimes snapshot() const;
+
+    void reset();
+
+private:
+    std::array<AtomicWord<int64_t>, OperationPhaseTimes::kNumPhases> _micros;
+};
+
+/**
+ * Adds the time spent in its scope to the given phase of the operation. Costs two reads of the
+ * service context's TickSource. A null OperationContext makes the timer a no-op, so that it can be
+ * placed on code paths that run both with and without an operation.
+ */
+class ScopedOperationPhaseTimer {
+public:
+    ScopedOperationPhaseTimer(OperationContext* opCtx, OperationPhase phase);
+    ~ScopedOperationPhaseTimer();
+
+    ScopedOperationPhaseTimer(const ScopedOperationPhaseTimer&) = delete;
+    ScopedOperationPhaseTimer& operator=(const ScopedOperationPhaseTimer&) = delete;
+
+private:
+    OperationPhaseTimers* _timers = nullptr;
+    TickSource* _tickSource = nullptr;
+    OperationPhase _phase;
+    TickSource::Tick _start = 0;
+};
+
+}  // namespace mongo
@@ -0,0 +1,128 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/operation_phase_timer.h"
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/tick_source_mock.h"
+
+namespace mongo {
+namespace {
+
+class OperationPhaseTimerTest : public ServiceContextTest {
+public:
+    void setUp() override {
+        auto tickSource = std::make_unique<TickSourceMock<Microseconds>>();
+        _tickSource = tickSource.get();
+        getServiceContext()->setTickSource(std::move(tickSource));
+        _opCtx = makeOperationContext();
+    }
+
+    OperationContext* opCtx() const {
+        return _opCtx.get();
+    }
+
+    void advance(Microseconds micros) {
+        _tickSource->advance(micros);
+    }
+
+private:
+    TickSourceMock<Microseconds>* _tickSource = nullptr;
+    ServiceContext::UniqueOperationContext _opCtx;
+};
+
+TEST_F(OperationPhaseTimerTest, ScopedTimersAccumulatePerPhase) {
+    {
+        ScopedOperationPhaseTimer parseTimer(opCtx(), OperationPhase::kParse);
+        advance(Microseconds{10});
+    }
+    {
+        ScopedOperationPhaseTimer executeTimer(opCtx(), OperationPhase::kExecute);
+        advance(Microseconds{5});
+        {
+            ScopedOperationPhaseTimer yieldTimer(opCtx(), OperationPhase::kYield);
+            advance(Microseconds{3});
+        }
+        advance(Microseconds{2});
+    }
+    {
+        ScopedOperationPhaseTimer parseTimer(opCtx(), OperationPhase::kParse);
+        advance(Microseconds{1});
+    }
+
+    auto times = OperationPhaseTimers::get(opCtx())->snapshot();
+    ASSERT_EQ(times.get(OperationPhase::kParse), Microseconds{11});
+    ASSERT_EQ(times.get(OperationPhase::kExecute), Microseconds{10});
+    ASSERT_EQ(times.get(OperationPhase::kYield), Microseconds{3});
+    ASSERT_EQ(times.get(OperationPhase::kTicketWait), Microseconds{0});
+    ASSERT_BSONOBJ_EQ(times.toBSON(), BSON("parse" << 11 << "execute" << 10 << "yield" << 3));
+
+    OperationPhaseTimers::get(opCtx())->reset();
+    ASSERT_TRUE(OperationPhaseTimers::get(opCtx())->snapshot().empty());
+}
+
+TEST_F(OperationPhaseTimerTest, NullOperationContextIsIgnored) {
+    {
+        ScopedOperationPhaseTimer timer(nullptr, OperationPhase::kTicketWait);
+        advance(Microseconds{7});
+    }
+    ASSERT_TRUE(OperationPhaseTimers::get(opCtx())->snapshot().empty());
+}
+
+TEST(OperationPhaseTimesTest, AddAndAppend) {
+    OperationPhaseTimes times;
+    ASSERT_TRUE(times.empty());
+    ASSERT_BSONOBJ_EQ(times.toBSON(), BSONObj());
+
+    times.add(OperationPhase::kPlan, Microseconds{4});
+    OperationPhaseTimes other;
+    other.add(OperationPhase::kPlan, Microseconds{1});
+    other.add(OperationPhase::kPrepareConflict, Microseconds{20});
+    times.add(other);
+
+    ASSERT_FALSE(times.empty());
+    ASSERT_EQ(times.get(OperationPhase::kPlan), Microseconds{5});
+
+    BSONObjBuilder builder;
+    builder.append("a", 1);
+    times.append(&builder);
+    ASSERT_BSONOBJ_EQ(builder.obj(), BSON("a" << 1 << "plan" << 5 << "prepareConflict" << 20));
+
+    times.reset();
+    ASSERT_TRUE(times == OperationPhaseTimes{});
+}
+
+}  // namespace
+}  // namespace mongo
@@ -31,6 +31,7 @@
 
 #include "mongo/db/auth/authorization_session.h"
 #include "mongo/db/catalog/clustered_collection_util.h"
+#include "mongo/db/catalog/collection_catalog.h"
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/catalog/collection_uuid_mismatch.h"
 #include "mongo/db/catalog/collection_write_path.h"
@@ -225,14 +226,7 @@ void finishCurOp(OperationContext* opCtx, CurOp* curOp) {
         curOp->debug().additiveMetrics.executionTime = executionTimeMicros;
 
         recordCurOpMetrics(opCtx);
-        Top::get(opCtx->getServiceContext())
-            .record(opCtx,
-                    curOp->getNS(),
-                    curOp->getLogicalOp(),
-                    Top::LockType::WriteLocked,
-                    durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses()),
-                    curOp->isCommand(),
-                    curOp->getReadWriteType());
+        recordWriteInTop(opCtx, curOp->getNSS(), curOp->getLogicalOp());
 
         if (!curOp->debug().errInfo.isOK()) {
             LOGV2_DEBUG(20886,
@@ -948,14 +942,7 @@ WriteResult performInserts(OperationContext* opCtx,
         // This is the only part of finishCurOp we need to do for inserts because they reuse the
         // top-level curOp. The rest is handled by the top-level entrypoint.
         curOp.done();
-        Top::get(opCtx->getServiceContext())
-            .record(opCtx,
-                    wholeOp.getNamespace().ns(),
-                    LogicalOp::opInsert,
-                    Top::LockType::WriteLocked,
-                    durationCount<Microseconds>(curOp.elapsedTimeExcludingPauses()),
-                    curOp.isCommand(),
-                    curOp.getReadWriteType());
+        recordWriteInTop(opCtx, wholeOp.getNamespace(), LogicalOp::opInsert);
     });
 
     if (source != OperationSource::kTimeseriesInsert) {
@@ -1899,6 +1886,34 @@ Status performAtomicTimeseriesWrites(
     return ex.toStatus();
 }
 
+void recordWriteInTop(OperationContext* opCtx, const NamespaceString& nss, LogicalOp logicalOp) {
+    auto curOp = CurOp::get(opCtx);
+    auto& top = Top::get(opCtx->getServiceContext());
+    const auto micros = durationCount<Microseconds>(curOp->elapsedTimeExcludingPauses());
+
+    // The catalog instance keeps the collection, and so the statistics cached on it, alive.
+    auto catalog = CollectionCatalog::get(opCtx);
+    if (auto collection = catalog->lookupCollectionByNamespace(opCtx, nss)) {
+        if (auto coll = top.getCollectionData(*collection)) {
+            top.record(opCtx,
+                       *coll,
+                       logicalOp,
+                       Top::LockType::WriteLocked,
+                       micros,
+                       curOp->getReadWriteType());
+        }
+        return;
+    }
+
+    top.record(opCtx,
+               nss.ns(),
+               logicalOp,
+               Top::LockType::WriteLocked,
+               micros,
+               curOp->isCommand(),
+               curOp->getReadWriteType());
+}
+
 void recordUpdateResultInOpDebug(const UpdateResult& updateResult, OpDebug* opDebug) {
     invariant(opDebug);
     opDebug->additiveMetrics.nMatched = updateResult.numMatched;
@@ -3059,14 +3074,7 @@ write_ops::InsertCommandReply performTimeseriesWrites(
         // This is the only part of finishCurOp we need to do for inserts because they reuse
         // the top-level curOp. The rest is handled by the top-level entrypoint.
         curOp.done();
-        Top::get(opCtx->getServiceContext())
-            .record(opCtx,
-                    ns(request).ns(),
-                    LogicalOp::opInsert,
-                    Top::LockType::WriteLocked,
-                    durationCount<Microseconds>(curOp.elapsedTimeExcludingPauses()),
-                    curOp.isCommand(),
-                    curOp.getReadWriteType());
+        recordWriteInTop(opCtx, ns(request), LogicalOp::opInsert);
     });
 
     uassert(ErrorCodes::OperationNotSupportedInTransaction,
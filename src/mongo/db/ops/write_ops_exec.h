@@ -41,6 +41,7 @@
 #include "mongo/db/ops/write_ops_exec_util.h"
 #include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/repl_client_info.h"
+#include "mongo/rpc/message.h"
 #include "mongo/s/stale_exception.h"
 
 namespace mongo {
@@ -176,6 +177,13 @@ Status performAtomicTimeseriesWrites(OperationContext* opCtx,
  */
 void recordUpdateResultInOpDebug(const UpdateResult& updateResult, OpDebug* opDebug);
 
+/**
+ * Records the current operation, a write of type 'logicalOp' against 'nss', in Top. If 'nss' is a
+ * collection of the latest catalog, it is recorded through the statistics cached on it, without
+ * looking 'nss' up in Top.
+ */
+void recordWriteInTop(OperationContext* opCtx, const NamespaceString& nss, LogicalOp logicalOp);
+
 /**
  * Returns true if an update failure due to a given DuplicateKey error is eligible for retry.
  * Requires that parsedUpdate.hasParsedQuery() is true.
@@ -578,6 +578,15 @@ void DocumentSourceInternalUnpackBucket::serializeToArray(std::vector<Value>& ar
                          opts.serializeLiteralValue(Value{static_cast<long long>(*_sampleSize)}));
             out.addField("bucketMaxCount", opts.serializeLiteralValue(Value{_bucketMaxCount}));
         }
+        if (*explain >= ExplainOptions::Verbosity::kExecStats) {
+            auto addStat = [&](StringData fieldName, size_t value) {
+                out.addField(fieldName,
+                             opts.serializeLiteralValue(Value{static_cast<long long>(value)}));
+            };
+            addStat(kNBucketsUnpacked, _stats.nBucketsUnpacked);
+            addStat(kNBucketsMatchedWholeBucketFilter, _stats.nBucketsMatchedWholeBucketFilter);
+            addStat(kNBucketsWithoutMatchingEvents, _stats.nBucketsWithoutMatchingEvents);
+        }
         array.push_back(Value(DOC(getSourceName() << out.freeze())));
     }
 }
@@ -624,6 +633,10 @@ DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::doGetNext() {
         auto bucket = nextResult.getDocument().toBson();
         auto bucketMatchedQuery = _wholeBucketFilter && _wholeBucketFilter->matchesBSON(bucket);
         _bucketUnpacker.reset(std::move(bucket), bucketMatchedQuery);
+        ++_stats.nBucketsUnpacked;
+        if (bucketMatchedQuery) {
+            ++_stats.nBucketsMatchedWholeBucketFilter;
+        }
 
         uassert(5346509,
                 str::stream() << "A bucket with _id "
@@ -633,6 +646,7 @@ DocumentSource::GetNextResult DocumentSourceInternalUnpackBucket::doGetNext() {
         if (auto measure = getNextMatchingMeasure()) {
             return GetNextResult(std::move(*measure));
         }
+        ++_stats.nBucketsWithoutMatchingEvents;
         nextResult = pSource->getNext();
     }
 
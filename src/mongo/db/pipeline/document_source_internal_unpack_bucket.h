@@ -35,6 +35,7 @@
 #include "mongo/db/exec/collection_scan.h"
 #include "mongo/db/exec/index_scan.h"
 #include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/timeseries/bucket_unpacker.h"
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/document_source_match.h"
@@ -53,6 +54,10 @@ public:
     static constexpr StringData kIncludeMaxTimeAsMetadata = "includeMaxTimeAsMetadata"_sd;
     static constexpr StringData kWholeBucketFilter = "wholeBucketFilter"_sd;
     static constexpr StringData kEventFilter = "eventFilter"_sd;
+    static constexpr StringData kNBucketsUnpacked = "nBucketsUnpacked"_sd;
+    static constexpr StringData kNBucketsMatchedWholeBucketFilter =
+        "nBucketsMatchedWholeBucketFilter"_sd;
+    static constexpr StringData kNBucketsWithoutMatchingEvents = "nBucketsWithoutMatchingEvents"_sd;
 
     static boost::intrusive_ptr<DocumentSource> createFromBsonInternal(
         BSONElement elem, const boost::intrusive_ptr<ExpressionContext>& expCtx);
@@ -294,6 +299,10 @@ private:
 
     bool _unpackToBson = false;
 
+    // Counts of the buckets this stage received, reported by explain with 'executionStats'. Buckets
+    // eliminated by the bucket-level predicate pushed ahead of this stage are never received.
+    UnpackTimeseriesBucketStats _stats;
+
     bool _optimizedEndOfPipeline = false;
     bool _triedInternalizeProject = false;
     bool _triedLastpointRewrite = false;
@@ -1148,5 +1148,85 @@ TEST_F(InternalUnpackBucketPredicateMappingOptimizationTest,
                                "] ] ]}},field: \"loc\"}}"));
     ASSERT_FALSE(predicate.tightPredicate);
 }
+
+BSONObj makeBucketControl(Date_t min, Date_t max) {
+    return BSON("control" << BSON("min" << BSON("time" << min) << "max" << BSON("time" << max)));
+}
+
+TEST_F(InternalUnpackBucketPredicateMappingOptimizationTest,
+       OptimizeMapsINPredicatesOnTimeFieldToTightPredicate) {
+    const auto t1 = Date_t::fromMillisSinceEpoch(1000000);
+    const auto t2 = t1 + Seconds(1);
+    auto pipeline = Pipeline::parse(
+        makeVector(fromjson("{$_internalUnpackBucket: {exclude: [], timeField: "
+                            "'time', bucketMaxSpanSeconds: 3600}}"),
+                   BSON("$match" << BSON("time" << BSON("$in" << BSON_ARRAY(t1 << t2))))),
+        getExpCtx());
+    auto& container = pipeline->getSources();
+
+    ASSERT_EQ(pipeline->getSources().size(), 2U);
+
+    auto original = dynamic_cast<DocumentSourceMatch*>(container.back().get());
+    auto predicate = dynamic_cast<DocumentSourceInternalUnpackBucket*>(container.front().get())
+                         ->createPredicatesOnBucketLevelField(original->getMatchExpression());
+
+    ASSERT(predicate.loosePredicate);
+    ASSERT(predicate.tightPredicate);
+
+    // Only buckets whose events all share one of the values match the whole bucket.
+    ASSERT_TRUE(predicate.tightPredicate->matchesBSON(makeBucketControl(t1, t1)));
+    ASSERT_TRUE(predicate.tightPredicate->matchesBSON(makeBucketControl(t2, t2)));
+    ASSERT_FALSE(predicate.tightPredicate->matchesBSON(makeBucketControl(t1, t2)));
+}
+
+TEST_F(InternalUnpackBucketPredicateMappingOptimizationTest,
+       OptimizeMapsAggAndRangePredicatesOnTimeFieldToTightPredicate) {
+    const auto t1 = Date_t::fromMillisSinceEpoch(1000000);
+    const auto t2 = t1 + Minutes(10);
+    auto expr = BSON("$and" << BSON_ARRAY(BSON("$gte" << BSON_ARRAY("$time" << t1))
+                                          << BSON("$lt" << BSON_ARRAY("$time" << t2))));
+    auto pipeline =
+        Pipeline::parse(makeVector(fromjson("{$_internalUnpackBucket: {exclude: [], timeField: "
+                                            "'time', bucketMaxSpanSeconds: 3600}}"),
+                                   BSON("$match" << BSON("$expr" << expr))),
+                        getExpCtx());
+    auto& container = pipeline->getSources();
+
+    ASSERT_EQ(pipeline->getSources().size(), 2U);
+
+    auto original = dynamic_cast<DocumentSourceMatch*>(container.back().get());
+    auto predicate = dynamic_cast<DocumentSourceInternalUnpackBucket*>(container.front().get())
+                         ->createPredicatesOnBucketLevelField(original->getMatchExpression());
+
+    ASSERT(predicate.tightPredicate);
+    ASSERT_TRUE(predicate.tightPredicate->matchesBSON(
+        makeBucketControl(t1 + Minutes(1), t1 + Minutes(2))));
+    ASSERT_FALSE(predicate.tightPredicate->matchesBSON(makeBucketControl(t1 - Minutes(1), t1)));
+    ASSERT_FALSE(predicate.tightPredicate->matchesBSON(makeBucketControl(t1, t2)));
+}
+
+TEST_F(InternalUnpackBucketPredicateMappingOptimizationTest,
+       OptimizeDoesNotMapAggAndWithUnrewritableChildToTightPredicate) {
+    const auto t1 = Date_t::fromMillisSinceEpoch(1000000);
+    auto expr = BSON("$and" << BSON_ARRAY(BSON("$gte" << BSON_ARRAY("$time" << t1))
+                                          << BSON("$eq" << BSON_ARRAY("$a"
+                                                                      << "$b"))));
+    auto pipeline =
+        Pipeline::parse(makeVector(fromjson("{$_internalUnpackBucket: {exclude: [], timeField: "
+                                            "'time', bucketMaxSpanSeconds: 3600}}"),
+                                   BSON("$match" << BSON("$expr" << expr))),
+                        getExpCtx());
+    auto& container = pipeline->getSources();
+
+    ASSERT_EQ(pipeline->getSources().size(), 2U);
+
+    auto original = dynamic_cast<DocumentSourceMatch*>(container.back().get());
+    auto predicate = dynamic_cast<DocumentSourceInternalUnpackBucket*>(container.front().get())
+                         ->createPredicatesOnBucketLevelField(original->getMatchExpression());
+
+    // The bucket's control fields say nothing about {$eq: ["$a", "$b"]}, so no bucket can be
+    // matched as a whole.
+    ASSERT_FALSE(predicate.tightPredicate);
+}
 }  // namespace
 }  // namespace mongo
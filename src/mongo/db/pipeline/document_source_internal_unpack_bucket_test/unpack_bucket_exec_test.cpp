@@ -926,6 +926,49 @@ TEST_F(InternalUnpackBucketExecTest, ParserRoundtripsComputedMetaProjFieldOverri
     ASSERT_BSONOBJ_EQ(array[0].getDocument().toBson(), bson);
 }
 
+TEST_F(InternalUnpackBucketExecTest, ExplainReportsBucketCounts) {
+    auto expCtx = getExpCtx();
+    auto spec = fromjson(
+        "{$_internalUnpackBucket: {exclude: [], timeField: 'time', bucketMaxSpanSeconds: 3600, "
+        "eventFilter: {a: {$gt: 1}}, wholeBucketFilter: {'control.min.a': {$gt: 1}}}}");
+    auto unpack =
+        DocumentSourceInternalUnpackBucket::createFromBsonInternal(spec.firstElement(), expCtx);
+
+    // The first bucket has one matching event, every event in the second bucket matches, and no
+    // event in the third bucket matches.
+    auto source = DocumentSourceMock::createForTest(
+        {"{control: {version: 1, min: {a: 1}, max: {a: 2}}, "
+         "data: {time: {'0': 1, '1': 2}, a: {'0': 1, '1': 2}}}",
+         "{control: {version: 1, min: {a: 5}, max: {a: 6}}, "
+         "data: {time: {'0': 3, '1': 4}, a: {'0': 5, '1': 6}}}",
+         "{control: {version: 1, min: {a: 0}, max: {a: 1}}, "
+         "data: {time: {'0': 5, '1': 6}, a: {'0': 0, '1': 1}}}"},
+        expCtx);
+    unpack->setSource(source.get());
+
+    int numResults = 0;
+    for (auto next = unpack->getNext(); next.isAdvanced(); next = unpack->getNext()) {
+        ++numResults;
+    }
+    ASSERT_EQ(numResults, 3);
+
+    auto array = std::vector<Value>{};
+    unpack->serializeToArray(array, SerializationOptions{ExplainOptions::Verbosity::kExecStats});
+    auto explain = array[0].getDocument()[DocumentSourceInternalUnpackBucket::kStageNameInternal];
+    ASSERT_VALUE_EQ(explain[DocumentSourceInternalUnpackBucket::kNBucketsUnpacked], Value(3LL));
+    ASSERT_VALUE_EQ(explain[DocumentSourceInternalUnpackBucket::kNBucketsMatchedWholeBucketFilter],
+                    Value(1LL));
+    ASSERT_VALUE_EQ(explain[DocumentSourceInternalUnpackBucket::kNBucketsWithoutMatchingEvents],
+                    Value(1LL));
+
+    // The counters are only reported when explaining with execution stats.
+    array.clear();
+    unpack->serializeToArray(array,
+                             SerializationOptions{ExplainOptions::Verbosity::kQueryPlanner});
+    explain = array[0].getDocument()[DocumentSourceInternalUnpackBucket::kStageNameInternal];
+    ASSERT(explain[DocumentSourceInternalUnpackBucket::kNBucketsUnpacked].missing());
+}
+
 std::string applyHmacForTest(StringData s) {
     return str::stream() << "HASH<" << s << ">";
 }
@@ -28,6 +28,8 @@
  */
 
 #include "mongo/db/prepare_conflict_tracker.h"
+
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/platform/basic.h"
 
 namespace mongo {
@@ -54,6 +56,8 @@ void PrepareConflictTracker::endPrepareConflict(OperationContext* opCtx) {
         auto curConflictDuration =
             tickSource->ticksTo<Microseconds>(curTick - _prepareConflictStartTime);
         _prepareConflictDuration.store(_prepareConflictDuration.load() + curConflictDuration);
+        OperationPhaseTimers::get(opCtx)->record(OperationPhase::kPrepareConflict,
+                                                 curConflictDuration);
         _prepareConflictStartTime = 0;
 
         // Implies that the current read operation is not blocked on a prepared transaction.
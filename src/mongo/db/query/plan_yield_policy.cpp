@@ -35,6 +35,7 @@
 #include "mongo/db/catalog/collection_uuid_mismatch_info.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/db/shard_role.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/scopeguard.h"
@@ -130,6 +131,8 @@ Status PlanYieldPolicy::yieldOrInterrupt(OperationContext* opCtx,
     ON_BLOCK_EXIT([this]() { resetTimer(); });
     _forceYield = false;
 
+    ScopedOperationPhaseTimer yieldTimer(opCtx, OperationPhase::kYield);
+
     for (int attempt = 1; true; attempt++) {
         try {
             // Saving and restoring can modify '_yieldable', so we make a copy before we start.
@@ -54,6 +54,7 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/debug_util.h"
 #include "mongo/util/processinfo.h"
+#include "mongo/util/sampling_profiler.h"
 #include "mongo/util/system_clock_source.h"
 #include "query_shape.h"
 #include <optional>
@@ -473,6 +474,7 @@ void registerAggRequest(const AggregateCommandRequest& request, OperationContext
     BSONObj key = queryStatsKey.obj();
     CurOp::get(opCtx)->debug().queryStatsStoreKeyHash = hash(key);
     CurOp::get(opCtx)->debug().queryStatsStoreKey = key.getOwned();
+    ScopedSampleAttribution::setQueryShapeHash(*CurOp::get(opCtx)->debug().queryStatsStoreKeyHash);
 }
 
 void registerRequest(std::unique_ptr<RequestShapifier> requestShapifier,
@@ -497,6 +499,7 @@ void registerRequest(std::unique_ptr<RequestShapifier> requestShapifier,
     CurOp::get(opCtx)->debug().queryStatsStoreKeyHash =
         hash(requestShapifier->makeQueryStatsKey(options, expCtx));
     CurOp::get(opCtx)->debug().queryStatsRequestShapifier = std::move(requestShapifier);
+    ScopedSampleAttribution::setQueryShapeHash(*CurOp::get(opCtx)->debug().queryStatsStoreKeyHash);
 }
 
 QueryStatsStore& getQueryStatsStore(OperationContext* opCtx) {
@@ -512,7 +515,8 @@ void writeQueryStats(OperationContext* opCtx,
                      boost::optional<BSONObj> queryStatsKey,
                      std::unique_ptr<RequestShapifier> requestShapifier,
                      const uint64_t queryExecMicros,
-                     const uint64_t docsReturned) {
+                     const uint64_t docsReturned,
+                     const OperationPhaseTimes& phaseTimes) {
     if (!queryStatsKeyHash) {
         return;
     }
@@ -550,6 +554,10 @@ void writeQueryStats(OperationContext* opCtx,
     metrics->execCount++;
     metrics->queryExecMicros.aggregate(queryExecMicros);
     metrics->docsReturned.aggregate(docsReturned);
+    for (size_t i = 0; i < OperationPhaseTimes::kNumPhases; ++i) {
+        metrics->phaseMicros[i].aggregate(
+            durationCount<Microseconds>(phaseTimes.get(static_cast<OperationPhase>(i))));
+    }
 }
 }  // namespace query_stats
 }  // namespace mongo
@@ -34,11 +34,13 @@
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/db/query/partitioned_cache.h"
 #include "mongo/db/query/plan_explainer.h"
 #include "mongo/db/query/request_shapifier.h"
 #include "mongo/db/query/util/memory_util.h"
 #include "mongo/db/service_context.h"
+#include <array>
 #include <cstdint>
 #include <memory>
 
@@ -119,10 +121,27 @@ public:
         builder.append("execCount", (BSONNumeric)execCount);
         queryExecMicros.appendTo(builder, "queryExecMicros");
         docsReturned.appendTo(builder, "docsReturned");
+        appendPhaseMicros(builder);
         builder.append("firstSeenTimestamp", firstSeenTimestamp);
         return builder.obj();
     }
 
+    /**
+     * Appends the per-phase time breakdown for the phases the query shape spent any time in.
+     */
+    void appendPhaseMicros(BSONObjBuilder& builder) const {
+        boost::optional<BSONObjBuilder> phasesBuilder;
+        for (size_t i = 0; i < OperationPhaseTimes::kNumPhases; ++i) {
+            if (phaseMicros[i].sum == 0) {
+                continue;
+            }
+            if (!phasesBuilder) {
+                phasesBuilder.emplace(builder.subobjStart("phaseMicros"));
+            }
+            phaseMicros[i].appendTo(*phasesBuilder, toString(static_cast<OperationPhase>(i)));
+        }
+    }
+
     /**
      * Redact a given queryStats key and set _keySize.
      */
@@ -149,6 +168,11 @@ public:
 
     AggregatedMetric docsReturned;
 
+    /**
+     * Time spent in each OperationPhase, aggregated over all executions.
+     */
+    std::array<AggregatedMetric, OperationPhaseTimes::kNumPhases> phaseMicros;
+
     std::unique_ptr<RequestShapifier> requestShapifier;
 
     NamespaceStringOrUUID nss;
@@ -210,7 +234,8 @@ void writeQueryStats(OperationContext* opCtx,
                      boost::optional<BSONObj> queryStatsKey,
                      std::unique_ptr<RequestShapifier> requestShapifier,
                      uint64_t queryExecMicros,
-                     uint64_t docsReturned);
+                     uint64_t docsReturned,
+                     const OperationPhaseTimes& phaseTimes);
 
 /**
  * Serialize the FindCommandRequest according to the Options passed in. Returns the serialized BSON
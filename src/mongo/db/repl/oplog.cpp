@@ -764,6 +764,72 @@ NamespaceString extractNsFromUUIDorNs(OperationContext* opCtx,
     return ui ? extractNsFromUUID(opCtx, ui.value()) : extractNs(ns.dbName(), cmd);
 }
 
+Status applyTruncateRange(OperationContext* opCtx,
+                          const OplogEntry& entry,
+                          OplogApplication::Mode mode) {
+    const auto& cmd = entry.getObject();
+    const auto nss = extractNsFromUUIDorNs(opCtx, entry.getNss(), entry.getUuid(), cmd);
+    const auto minRecordId = RecordId::deserializeToken(cmd["minRecordId"]);
+    const auto maxRecordId = RecordId::deserializeToken(cmd["maxRecordId"]);
+
+    AutoGetCollection coll(opCtx, nss, MODE_IX);
+    if (!coll) {
+        return Status(ErrorCodes::NamespaceNotFound,
+                      str::stream() << "Cannot apply truncateRange to nonexistent collection "
+                                    << nss.toStringForErrorMsg());
+    }
+
+    // Only accept the collections the TTL monitor truncates expired ranges of. On any other the
+    // truncate would leave index keys, or the state capped and time-series collections keep about
+    // their records, behind.
+    uassert(9394001,
+            str::stream() << "Cannot apply truncateRange to non-clustered collection "
+                          << nss.toStringForErrorMsg(),
+            coll->isClustered());
+    uassert(9394002,
+            str::stream() << "Cannot apply truncateRange to collection with secondary indexes "
+                          << nss.toStringForErrorMsg(),
+            coll->getIndexCatalog()->numIndexesTotal() == 0);
+    uassert(9394003,
+            str::stream() << "Cannot apply truncateRange to capped collection "
+                          << nss.toStringForErrorMsg(),
+            !coll->isCapped());
+    uassert(9394004,
+            str::stream() << "Cannot apply truncateRange to time-series collection "
+                          << nss.toStringForErrorMsg(),
+            !coll->getTimeseriesOptions());
+
+    auto rs = coll->getRecordStore();
+
+    auto bytesDeleted = cmd["bytesDeleted"].safeNumberLong();
+    auto docsDeleted = cmd["docsDeleted"].safeNumberLong();
+    if (mode != OplogApplication::Mode::kSecondary) {
+        // Outside of steady state replication the range may already have been removed, either
+        // entirely or in part, so the sizes recorded by the primary cannot be trusted.
+        bytesDeleted = 0;
+        docsDeleted = 0;
+        auto cursor = rs->getCursor(opCtx, true /* forward */);
+        for (auto record = cursor->seekNear(minRecordId); record; record = cursor->next()) {
+            if (record->id > maxRecordId) {
+                break;
+            }
+            if (record->id < minRecordId) {
+                continue;
+            }
+            bytesDeleted += record->data.size();
+            ++docsDeleted;
+        }
+    }
+
+    WriteUnitOfWork wuow(opCtx);
+    auto status = rs->rangeTruncate(opCtx, minRecordId, maxRecordId, -bytesDeleted, -docsDeleted);
+    if (!status.isOK()) {
+        return status;
+    }
+    wuow.commit();
+    return Status::OK();
+}
+
 StatusWith<BSONObj> getObjWithSanitizedStorageEngineOptions(OperationContext* opCtx,
                                                             const BSONObj& cmd) {
     static_assert(
@@ -1124,6 +1190,10 @@ const StringMap<ApplyOpMetadata> kOpsMap = {
               extractNsFromUUIDorNs(opCtx, entry.getNss(), entry.getUuid(), entry.getObject()));
       },
       {ErrorCodes::NamespaceNotFound}}},
+    {"truncateRange",
+     {[](OperationContext* opCtx, const ApplierOperation& op, OplogApplication::Mode mode)
+          -> Status { return applyTruncateRange(opCtx, *op, mode); },
+      {ErrorCodes::NamespaceNotFound}}},
     {"commitTransaction",
      {[](OperationContext* opCtx, const ApplierOperation& op, OplogApplication::Mode mode)
           -> Status {
@@ -79,7 +79,13 @@ namespace {
 
 class TestServiceContext {
 public:
-    TestServiceContext() {
+    /**
+     * By default, applies as a secondary with the steady state writer pool. Recovery benchmarks
+     * pass a recovering 'mode' and an explicit 'numWriterThreads' to compare pool sizes.
+     */
+    explicit TestServiceContext(
+        repl::OplogApplication::Mode mode = repl::OplogApplication::Mode::kSecondary,
+        int numWriterThreads = 0) {
         // Disable execution control.
         gStorageEngineConcurrencyAdjustmentAlgorithm = "fixedConcurrentTransactions";
 
@@ -164,13 +170,16 @@ public:
             std::make_unique<MongoDSessionCatalog>(
                 std::make_unique<MongoDSessionCatalogTransactionInterfaceImpl>()));
 
-        _oplogApplierThreadPool = repl::makeReplWriterPool();
+        _oplogApplierThreadPool = numWriterThreads > 0
+            ? repl::makeReplWriterPool(numWriterThreads)
+            : repl::makeReplWriterPool();
 
         // Act as a secondary to get optimizations due to parallizing 'prepare' oplog entries. But
-        // do not include in the benchmark the time to write to the oplog.
+        // do not include in the benchmark the time to write to the oplog. Recovery never writes to
+        // the oplog either, as the entries it applies are already there.
         repl::OplogApplier::Options oplogApplierOptions(
-            repl::OplogApplication::Mode::kSecondary,
-            false /*allowNamespaceNotFoundErrorsOnCrudOps*/,
+            mode,
+            repl::OplogApplication::inRecovering(mode) /*allowNamespaceNotFoundErrorsOnCrudOps*/,
             true /*skipWritesToOplog*/);
         _oplogApplier = std::make_unique<repl::OplogApplierImpl>(nullptr,
                                                                  &_oplogBuffer,
@@ -531,6 +540,17 @@ void runBMTest(TestServiceContext& testSvcCtx, Fixture& fixture, benchmark::Stat
     }
 }
 
+// Applies inserts the way startup recovery from a stable timestamp does, with range(1) writer
+// threads, and reports the throughput so that recovery writer pool sizes can be compared.
+void BM_TestRecoveryInserts(benchmark::State& state) {
+    TestServiceContext testSvcCtx(repl::OplogApplication::Mode::kStableRecovering, state.range(1));
+    Fixture fixture(&testSvcCtx);
+    fixture.createBatch(state.range(0));
+    runBMTest(testSvcCtx, fixture, state);
+    state.counters["opsPerSecond"] = benchmark::Counter(
+        static_cast<double>(state.iterations() * state.range(0)), benchmark::Counter::kIsRate);
+}
+
 void BM_TestInserts(benchmark::State& state) {
     TestServiceContext testSvcCtx;
     Fixture fixture(&testSvcCtx);
@@ -568,6 +588,15 @@ void BM_TestPrepares(benchmark::State& state) {
 
 BENCHMARK(BM_TestInserts)->Arg(100 * 1000)->UseManualTime()->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_TestRecoveryInserts)
+    ->Args({100 * 1000, 1})
+    ->Args({100 * 1000, 2})
+    ->Args({100 * 1000, 4})
+    ->Args({100 * 1000, 8})
+    ->Args({100 * 1000, 16})
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_TestApplyOps)
     ->Args({100 * 1000, 10})
     ->Args({100 * 1000, 100})
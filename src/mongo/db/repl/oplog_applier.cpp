@@ -157,6 +157,15 @@ std::unique_ptr<ThreadPool> makeReplWriterPool(int threadCount) {
     return makeReplWriterPool(threadCount, "ReplWriterWorker"_sd);
 }
 
+std::unique_ptr<ThreadPool> makeReplRecoveryWriterPool() {
+    if (replRecoveryWriterThreadCount == 0) {
+        return makeReplWriterPool();
+    }
+    auto numberOfThreads = std::min(replRecoveryWriterThreadCount,
+                                    2 * static_cast<int>(ProcessInfo::getNumAvailableCores()));
+    return makeReplWriterPool(numberOfThreads, "ReplRecoveryWriterWorker"_sd);
+}
+
 std::unique_ptr<ThreadPool> makeReplWriterPool(int threadCount,
                                                StringData name,
                                                bool isKillableByStepdown) {
@@ -247,6 +247,12 @@ extern NoopOplogApplierObserver noopOplogApplierObserver;
 std::unique_ptr<ThreadPool> makeReplWriterPool();
 std::unique_ptr<ThreadPool> makeReplWriterPool(int threadCount);
 
+/**
+ * Creates the thread pool used to apply the oplog during startup and rollback recovery, sized by
+ * 'replRecoveryWriterThreadCount'.
+ */
+std::unique_ptr<ThreadPool> makeReplRecoveryWriterPool();
+
 /**
  * Creates a thread pool suitable for writer tasks, with the specified name
  */
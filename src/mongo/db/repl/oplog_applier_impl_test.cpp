@@ -35,6 +35,7 @@
 #include <vector>
 
 #include "mongo/bson/util/bson_extract.h"
+#include "mongo/db/catalog/clustered_collection_util.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/collection_options.h"
 #include "mongo/db/catalog/create_collection.h"
@@ -54,6 +55,7 @@
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
 #include "mongo/db/query/internal_plans.h"
+#include "mongo/db/record_id_helpers.h"
 #include "mongo/db/repl/bgsync.h"
 #include "mongo/db/repl/drop_pending_collection_reaper.h"
 #include "mongo/db/repl/idempotency_test_fixture.h"
@@ -138,9 +140,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
         NamespaceString::createNamespaceString_forTest(boost::none, "test.t");
     NamespaceString otherNss = NamespaceString::createNamespaceString_forTest("test.othername");
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, {});
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -178,9 +180,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     NamespaceString otherNss =
         NamespaceString::createNamespaceString_forTest(nss.getSisterNS("othername"));
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, kUuid);
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -223,10 +225,10 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     // which in the case of this test just ignores such errors. This tests mostly that we don't
     // implicitly create the collection.
     auto op = makeOplogEntry(OpTypeEnum::kDelete, nss, {});
-    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    int prevDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
     ASSERT_FALSE(collectionExists(_opCtx.get(), nss));
-    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace()->load();
+    auto postDeleteFromMissing = replOpCounters.getDeleteFromMissingNamespace();
     ASSERT_EQ(1, postDeleteFromMissing - prevDeleteFromMissing);
 
     ASSERT_EQ(postDeleteFromMissing,
@@ -260,9 +262,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
     repl::createCollection(_opCtx.get(), nss, {});
     auto op = makeOplogEntry(OpTypeEnum::kDelete, nss, {});
-    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     ASSERT_EQ(1, postDeleteWasEmpty - prevDeleteWasEmpty);
 
     ASSERT_EQ(postDeleteWasEmpty,
@@ -300,9 +302,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     auto uuid = createCollectionWithUuid(_opCtx.get(), nss);
     ASSERT_OK(getStorageInterface()->insertDocument(_opCtx.get(), nss, {BSON("_id" << 0)}, 0));
     auto op = makeOplogEntry(OpTypeEnum::kInsert, nss, uuid);
-    int prevInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc()->load();
+    int prevInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc()->load();
+    auto postInsertOnExistingDoc = replOpCounters.getInsertOnExistingDoc();
     ASSERT_EQ(1, postInsertOnExistingDoc - prevInsertOnExistingDoc);
 
     ASSERT_EQ(postInsertOnExistingDoc,
@@ -331,9 +333,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
                              update_oplog_entry::makeDeltaOplogEntry(
                                  BSON(doc_diff::kUpdateSectionFieldName << fromjson("{a: 1}"))),
                              BSON("_id" << 0));
-    int prevUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc()->load();
+    int prevUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, true);
-    auto postUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc()->load();
+    auto postUpdateOnMissingDoc = replOpCounters.getUpdateOnMissingDoc();
     ASSERT_EQ(1, postUpdateOnMissingDoc - prevUpdateOnMissingDoc);
 
     ASSERT_EQ(postUpdateOnMissingDoc,
@@ -378,9 +380,9 @@ TEST_F(OplogApplierImplTestDisableSteadyStateConstraints,
     NamespaceString otherNss =
         NamespaceString::createNamespaceString_forTest(nss.getSisterNS("othername"));
     auto op = makeOplogEntry(OpTypeEnum::kDelete, otherNss, options.uuid);
-    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    int prevDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     _testApplyOplogEntryOrGroupedInsertsCrudOperation(ErrorCodes::OK, op, nss, false);
-    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty()->load();
+    auto postDeleteWasEmpty = replOpCounters.getDeleteWasEmpty();
     ASSERT_EQ(1, postDeleteWasEmpty - prevDeleteWasEmpty);
 
     ASSERT_EQ(postDeleteWasEmpty,
@@ -774,6 +776,97 @@ TEST_F(OplogApplierImplTest, RenameCollectionCommandMultitenantAcrossTenantsRequ
     ASSERT_FALSE(collectionExists(_opCtx.get(), wrongTargetNss));
 }
 
+class OplogApplierImplTruncateRangeTest : public OplogApplierImplTest {
+protected:
+    static constexpr int kNumDocs = 5;
+
+    /**
+     * Creates a clustered collection holding the documents {_id: 1} to {_id: kNumDocs}.
+     */
+    UUID createClusteredCollection(const NamespaceString& nss) {
+        CollectionOptions options;
+        options.uuid = UUID::gen();
+        options.clusteredIndex = clustered_util::makeCanonicalClusteredInfoForLegacyFormat();
+        createCollection(_opCtx.get(), nss, options);
+        for (int i = 1; i <= kNumDocs; ++i) {
+            ASSERT_OK(getStorageInterface()->insertDocument(
+                _opCtx.get(), nss, {BSON("_id" << i)}, 0));
+        }
+        return *options.uuid;
+    }
+
+    /**
+     * Makes a 'truncateRange' oplog entry removing {_id: min} to {_id: max}, recording the given
+     * sizes for the range.
+     */
+    OplogEntry makeTruncateRangeOplogEntry(const NamespaceString& nss,
+                                           const UUID& uuid,
+                                           int min,
+                                           int max,
+                                           long long bytesDeleted,
+                                           long long docsDeleted) {
+        BSONObjBuilder cmdBuilder;
+        cmdBuilder.append("truncateRange", nss.coll());
+        record_id_helpers::keyForElem(BSON("_id" << min).firstElement())
+            .serializeToken("minRecordId", &cmdBuilder);
+        record_id_helpers::keyForElem(BSON("_id" << max).firstElement())
+            .serializeToken("maxRecordId", &cmdBuilder);
+        cmdBuilder.append("bytesDeleted", bytesDeleted);
+        cmdBuilder.append("docsDeleted", docsDeleted);
+        return makeCommandOplogEntry(nextOpTime(), nss, cmdBuilder.obj(), uuid);
+    }
+
+    void assertSizes(const NamespaceString& nss, long long numRecords, long long dataSize) {
+        AutoGetCollectionForRead coll(_opCtx.get(), nss);
+        ASSERT_EQ(coll->numRecords(_opCtx.get()), numRecords);
+        ASSERT_EQ(coll->dataSize(_opCtx.get()), dataSize);
+    }
+
+    const int kDocSize = BSON("_id" << 1).objsize();
+};
+
+TEST_F(OplogApplierImplTruncateRangeTest, SteadyStateTrustsPrimarySizes) {
+    const auto nss = NamespaceString::createNamespaceString_forTest("test.t");
+    const auto uuid = createClusteredCollection(nss);
+
+    // The primary sized the range within the snapshot it truncated it in, so a secondary applies
+    // the recorded sizes, even when they do not match its own records.
+    auto op = makeTruncateRangeOplogEntry(nss, uuid, 2, 4, 1, 1);
+    ASSERT_OK(_applyOplogEntryOrGroupedInsertsWrapper(
+        _opCtx.get(), ApplierOperation{&op}, OplogApplication::Mode::kSecondary));
+
+    ASSERT_EQ(getStorageInterface()->findById(_opCtx.get(), nss, BSON("_id" << 3).firstElement())
+                  .getStatus(),
+              ErrorCodes::NoSuchKey);
+    assertSizes(nss, kNumDocs - 1, kNumDocs * kDocSize - 1);
+}
+
+TEST_F(OplogApplierImplTruncateRangeTest, OtherModesRecountRange) {
+    for (auto mode : {OplogApplication::Mode::kInitialSync,
+                      OplogApplication::Mode::kUnstableRecovering,
+                      OplogApplication::Mode::kStableRecovering,
+                      OplogApplication::Mode::kApplyOpsCmd}) {
+        const auto nss = NamespaceString::createNamespaceString_forTest(
+            "test", "t" + std::to_string(static_cast<int>(mode)));
+        const auto uuid = createClusteredCollection(nss);
+
+        // Part of the range was already removed, so the recorded sizes are stale.
+        ASSERT_OK(getStorageInterface()->deleteById(
+            _opCtx.get(), nss, BSON("_id" << 3).firstElement()));
+
+        auto op = makeTruncateRangeOplogEntry(nss, uuid, 2, 4, 3 * kDocSize, 3);
+        ASSERT_OK(
+            _applyOplogEntryOrGroupedInsertsWrapper(_opCtx.get(), ApplierOperation{&op}, mode));
+
+        for (int i = 1; i <= kNumDocs; ++i) {
+            auto doc =
+                getStorageInterface()->findById(_opCtx.get(), nss, BSON("_id" << i).firstElement());
+            ASSERT_EQ(doc.isOK(), i < 2 || i > 4);
+        }
+        assertSizes(nss, 2, 2 * kDocSize);
+    }
+}
+
 TEST_F(OplogApplierImplTest, applyOplogEntryToInvalidateChangeStreamPreImages) {
     const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
     CollectionOptions options;
@@ -1658,14 +1751,14 @@ TEST_F(MultiOplogEntryOplogApplierImplTest, MultiApplyTwoTransactionsOneBatch) {
     // Note the insert counter so we can check it later.  It is necessary to use opCounters as
     // inserts are idempotent so we will not detect duplicate inserts just by checking inserts in
     // the opObserver.
-    int insertsBefore = replOpCounters.getInsert()->load();
+    int insertsBefore = replOpCounters.getInsert();
     // Insert all the oplog entries in one batch.  All inserts should be executed, in order, exactly
     // once.
     ASSERT_OK(oplogApplier.applyOplogBatch(
         _opCtx.get(),
         {insertOps1[0], insertOps1[1], commitOp1, insertOps2[0], insertOps2[1], commitOp2}));
     ASSERT_EQ(6U, oplogDocs().size());
-    ASSERT_EQ(4, replOpCounters.getInsert()->load() - insertsBefore);
+    ASSERT_EQ(4, replOpCounters.getInsert() - insertsBefore);
     ASSERT_EQ(4U, _insertedDocs[_nss1].size());
     checkTxnTable(_lsid,
                   txnNum2,
@@ -4373,10 +4466,10 @@ TEST_F(IdempotencyTestDisableSteadyStateConstraints, AcceptableErrorsRecordedInS
     auto emptyCappedOp = makeCommandOplogEntry(nextOpTime(), _nss, emptyCappedCmd);
 
     // Ensure that NamespaceNotFound is "acceptable" but counted.
-    int prevAcceptableError = replOpCounters.getAcceptableErrorInCommand()->load();
+    int prevAcceptableError = replOpCounters.getAcceptableErrorInCommand();
     ASSERT_OK(runOpSteadyState(emptyCappedOp));
 
-    auto postAcceptableError = replOpCounters.getAcceptableErrorInCommand()->load();
+    auto postAcceptableError = replOpCounters.getAcceptableErrorInCommand();
     ASSERT_EQ(1, postAcceptableError - prevAcceptableError);
 
     ASSERT_EQ(postAcceptableError,
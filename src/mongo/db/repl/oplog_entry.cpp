@@ -149,6 +149,8 @@ DurableOplogEntry::CommandType parseCommandType(const BSONObj& objectField) {
         return DurableOplogEntry::CommandType::kDropDatabase;
     } else if (commandString == "emptycapped") {
         return DurableOplogEntry::CommandType::kEmptyCapped;
+    } else if (commandString == "truncateRange") {
+        return DurableOplogEntry::CommandType::kTruncateRange;
     } else if (commandString == "createIndexes") {
         return DurableOplogEntry::CommandType::kCreateIndexes;
     } else if (commandString == "startIndexBuild") {
@@ -504,6 +504,7 @@ public:
         kApplyOps,
         kDropDatabase,
         kEmptyCapped,
+        kTruncateRange,
         kCreateIndexes,
         kStartIndexBuild,
         kCommitIndexBuild,
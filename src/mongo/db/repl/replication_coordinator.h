@@ -430,6 +430,23 @@ public:
     virtual OpTimeAndWallTime getMyLastAppliedOpTimeAndWallTime(
         bool rollbackSafe = false) const = 0;
 
+    /**
+     * Estimated replication lag of this node, along with the last applied optime of the member it
+     * was measured against.
+     */
+    struct ReplicationLagEstimate {
+        Milliseconds lag;
+        OpTime referenceOpTime;
+    };
+
+    /**
+     * Estimates how far this node's last applied optime lags behind the replica set, using the
+     * wall clock time of the last applied optime most recently reported by the primary, or by the
+     * most up-to-date member when no primary is known. Returns boost::none if this node is not a
+     * secondary or no estimate can be made.
+     */
+    virtual boost::optional<ReplicationLagEstimate> estimateReplicationLag() const = 0;
+
     /**
      * Returns the last optime recorded by setMyLastDurableOpTime.
      */
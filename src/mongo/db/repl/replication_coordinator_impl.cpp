@@ -214,62 +214,6 @@ constexpr StringData kQuiesceModeShutdownMessage =
 
 }  // namespace
 
-void ReplicationCoordinatorImpl::WaiterList::add_inlock(const OpTime& opTime,
-                                                        SharedWaiterHandle waiter) {
-    _waiters.emplace(opTime, std::move(waiter));
-}
-
-SharedSemiFuture<void> ReplicationCoordinatorImpl::WaiterList::add_inlock(
-    const OpTime& opTime, boost::optional<WriteConcernOptions> wc) {
-    auto pf = makePromiseFuture<void>();
-    _waiters.emplace(opTime, std::make_shared<Waiter>(std::move(pf.promise), std::move(wc)));
-    return std::move(pf.future);
-}
-
-bool ReplicationCoordinatorImpl::WaiterList::remove_inlock(SharedWaiterHandle waiter) {
-    for (auto iter = _waiters.begin(); iter != _waiters.end(); iter++) {
-        if (iter->second == waiter) {
-            _waiters.erase(iter);
-            return true;
-        }
-    }
-    return false;
-}
-
-template <typename Func>
-void ReplicationCoordinatorImpl::WaiterList::setValueIf_inlock(Func&& func,
-                                                               boost::optional<OpTime> opTime) {
-    for (auto it = _waiters.begin(); it != _waiters.end() && (!opTime || it->first <= *opTime);) {
-        const auto& waiter = it->second;
-        try {
-            if (func(it->first, waiter)) {
-                waiter->promise.emplaceValue();
-                it = _waiters.erase(it);
-            } else {
-                ++it;
-            }
-        } catch (const DBException& e) {
-            waiter->promise.setError(e.toStatus());
-            it = _waiters.erase(it);
-        }
-    }
-}
-
-void ReplicationCoordinatorImpl::WaiterList::setValueAll_inlock() {
-    for (auto& [opTime, waiter] : _waiters) {
-        waiter->promise.emplaceValue();
-    }
-    _waiters.clear();
-}
-
-void ReplicationCoordinatorImpl::WaiterList::setErrorAll_inlock(Status status) {
-    invariant(!status.isOK());
-    for (auto& [opTime, waiter] : _waiters) {
-        waiter->promise.setError(status);
-    }
-    _waiters.clear();
-}
-
 namespace {
 ReplicationCoordinator::Mode getReplicationModeFromSettings(const ReplSettings& settings) {
     if (settings.usingReplSets()) {
@@ -1560,6 +1504,29 @@ OpTimeAndWallTime ReplicationCoordinatorImpl::getMyLastAppliedOpTimeAndWallTime(
     return _getMyLastAppliedOpTimeAndWallTime_inlock();
 }
 
+boost::optional<ReplicationCoordinator::ReplicationLagEstimate>
+ReplicationCoordinatorImpl::estimateReplicationLag() const {
+    stdx::lock_guard<Latch> lock(_mutex);
+    if (!_getMemberState_inlock().secondary()) {
+        return boost::none;
+    }
+
+    auto reference = _topCoord->getReplicationLagReferenceOpTimeAndWallTime();
+    if (!reference) {
+        return boost::none;
+    }
+
+    // A node that has applied everything the reference member reported is not lagging, even if
+    // the wall clock times disagree because of clock skew between the members.
+    const auto myLastApplied = _getMyLastAppliedOpTimeAndWallTime_inlock();
+    if (myLastApplied.opTime >= reference->opTime) {
+        return ReplicationLagEstimate{Milliseconds(0), reference->opTime};
+    }
+    return ReplicationLagEstimate{
+        std::max(Milliseconds(0), reference->wallTime - myLastApplied.wallTime),
+        reference->opTime};
+}
+
 OpTimeAndWallTime ReplicationCoordinatorImpl::getMyLastDurableOpTimeAndWallTime() const {
     stdx::lock_guard<Latch> lock(_mutex);
     return _getMyLastDurableOpTimeAndWallTime_inlock();
@@ -5150,7 +5117,9 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
 }
 
 void ReplicationCoordinatorImpl::_wakeReadyWaiters(WithLock lk, boost::optional<OpTime> opTime) {
-    _replicationWaiterList.setValueIf_inlock(
+    // Within a write concern mode, a waiter that is not yet satisfied means no later waiter of that
+    // mode is either, so only the ready prefix of each mode is checked.
+    _replicationWaiterList.setReadyPrefixValue_inlock(
         [this](const OpTime& opTime, const SharedWaiterHandle& waiter) {
             invariant(waiter->writeConcern);
             return _doneWaitingForReplication_inlock(opTime, waiter->writeConcern.value());
@@ -5412,6 +5381,12 @@ ChangeSyncSourceAction ReplicationCoordinatorImpl::shouldChangeSyncSource(
         return ChangeSyncSourceAction::kStopSyncingAndDropLastBatchIfPresent;
     }
 
+    if (_topCoord->shouldChangeSyncSourceDueToLoad(
+            currentSource, _getMemberState_inlock(), previousOpTimeFetched, now, readPreference)) {
+        // As above, so that the less loaded node stays a viable sync source for us.
+        return ChangeSyncSourceAction::kStopSyncingAndDropLastBatchIfPresent;
+    }
+
     return ChangeSyncSourceAction::kContinueSyncing;
 }
 
@@ -5430,6 +5405,11 @@ ChangeSyncSourceAction ReplicationCoordinatorImpl::shouldChangeSyncSourceOnError
         return ChangeSyncSourceAction::kStopSyncingAndDropLastBatchIfPresent;
     }
 
+    if (_topCoord->shouldChangeSyncSourceDueToLoad(
+            currentSource, _getMemberState_inlock(), lastOpTimeFetched, now, readPreference)) {
+        return ChangeSyncSourceAction::kStopSyncingAndDropLastBatchIfPresent;
+    }
+
     return ChangeSyncSourceAction::kContinueSyncing;
 }
 
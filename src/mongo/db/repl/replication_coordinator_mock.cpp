@@ -311,6 +311,11 @@ OpTime ReplicationCoordinatorMock::getMyLastAppliedOpTime() const {
     return _myLastAppliedOpTime;
 }
 
+boost::optional<ReplicationCoordinator::ReplicationLagEstimate>
+ReplicationCoordinatorMock::estimateReplicationLag() const {
+    return boost::none;
+}
+
 OpTimeAndWallTime ReplicationCoordinatorMock::getMyLastDurableOpTimeAndWallTime() const {
     stdx::lock_guard<Mutex> lk(_mutex);
 
@@ -138,6 +138,11 @@ OpTimeAndWallTime ReplicationCoordinatorNoOp::getMyLastAppliedOpTimeAndWallTime(
     MONGO_UNREACHABLE;
 }
 
+boost::optional<ReplicationCoordinator::ReplicationLagEstimate>
+ReplicationCoordinatorNoOp::estimateReplicationLag() const {
+    MONGO_UNREACHABLE;
+}
+
 WriteConcernOptions ReplicationCoordinatorNoOp::populateUnsetWriteConcernOptionsSyncMode(
     WriteConcernOptions wc) {
     MONGO_UNREACHABLE;
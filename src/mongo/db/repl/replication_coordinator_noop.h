@@ -134,6 +134,8 @@ public:
     OpTime getMyLastAppliedOpTime() const final;
     OpTimeAndWallTime getMyLastAppliedOpTimeAndWallTime(bool rollbackSafe = false) const final;
 
+    boost::optional<ReplicationLagEstimate> estimateReplicationLag() const final;
+
     OpTime getMyLastDurableOpTime() const final;
     OpTimeAndWallTime getMyLastDurableOpTimeAndWallTime() const final;
 
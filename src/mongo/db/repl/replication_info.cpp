@@ -54,6 +54,7 @@
 #include "mongo/db/repl/replication_auth.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/replication_process.h"
+#include "mongo/db/repl/secondary_read_staleness.h"
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/s/global_user_write_block_state.h"
 #include "mongo/db/session/logical_session_id.h"
@@ -195,6 +196,7 @@ public:
                               boost::none /* maxAwaitTimeMS */);
 
         appendPrimaryOnlyServiceInfo(opCtx->getServiceContext(), &result);
+        appendSecondaryReadStalenessStats(opCtx, &result);
 
         auto rbid = ReplicationProcess::get(opCtx)->getRollbackID();
         if (ReplicationProcess::kUninitializedRollbackId != rbid) {
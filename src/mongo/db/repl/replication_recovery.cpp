@@ -35,6 +35,7 @@
 #include "mongo/db/repl/replication_recovery.h"
 
 #include "mongo/db/catalog/document_validation.h"
+#include "mongo/db/client.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/index_builds_coordinator.h"
@@ -57,6 +58,9 @@
 #include "mongo/db/transaction/transaction_history_iterator.h"
 #include "mongo/db/transaction/transaction_participant.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/timer.h"
 
@@ -79,6 +83,9 @@ const auto kRecoveryOperationLogLevel = logv2::LogSeverity::Debug(3);
  */
 class RecoveryOplogApplierStats : public OplogApplier::Observer {
 public:
+    RecoveryOplogApplierStats(Timestamp startPoint, Timestamp endPoint)
+        : _startPoint(startPoint), _endPoint(endPoint) {}
+
     void onBatchBegin(const std::vector<OplogEntry>& batch) final {
         _numBatches++;
         LOGV2_FOR_RECOVERY(24098,
@@ -112,19 +119,64 @@ public:
         }
     }
 
-    void onBatchEnd(const StatusWith<OpTime>&, const std::vector<OplogEntry>&) final {}
+    void onBatchEnd(const StatusWith<OpTime>& lastOpTimeApplied,
+                    const std::vector<OplogEntry>&) final {
+        if (!lastOpTimeApplied.isOK()) {
+            return;
+        }
+        const auto elapsed = Milliseconds(_timer.millis());
+        if (elapsed - _lastProgressLogTime < kRecoveryProgressLogInterval) {
+            return;
+        }
+        _lastProgressLogTime = elapsed;
+        LOGV2(9392800,
+              "Oplog application for recovery in progress",
+              "numOpsApplied"_attr = _numOpsApplied,
+              "numBatches"_attr = _numBatches,
+              "opsPerSecond"_attr = _opsPerSecond(elapsed),
+              "lastOpTimeApplied"_attr = lastOpTimeApplied.getValue(),
+              "endPoint"_attr = _endPoint,
+              "percentComplete"_attr =
+                  _percentComplete(lastOpTimeApplied.getValue().getTimestamp()));
+    }
 
     void complete(const OpTime& applyThroughOpTime) const {
+        const auto elapsed = Milliseconds(_timer.millis());
         LOGV2(21536,
               "Applied {numOpsApplied} operations in {numBatches} batches. Last operation applied "
               "with optime: {applyThroughOpTime}",
               "Completed oplog application for recovery",
               "numOpsApplied"_attr = _numOpsApplied,
               "numBatches"_attr = _numBatches,
-              "applyThroughOpTime"_attr = applyThroughOpTime);
+              "applyThroughOpTime"_attr = applyThroughOpTime,
+              "durationMillis"_attr = elapsed,
+              "opsPerSecond"_attr = _opsPerSecond(elapsed));
     }
 
 private:
+    // How often to report progress while replaying a long stretch of oplog.
+    static constexpr Seconds kRecoveryProgressLogInterval{10};
+
+    long long _opsPerSecond(Milliseconds elapsed) const {
+        return elapsed > Milliseconds(0)
+            ? static_cast<long long>(_numOpsApplied * 1000 / durationCount<Milliseconds>(elapsed))
+            : 0;
+    }
+
+    // The oplog only has second granularity in the timestamp range we replay over, which is enough
+    // for an operator estimating how much longer recovery will take.
+    double _percentComplete(Timestamp lastApplied) const {
+        if (_endPoint.getSecs() <= _startPoint.getSecs()) {
+            return 100.0;
+        }
+        const double span = _endPoint.getSecs() - _startPoint.getSecs();
+        return 100.0 * (double(lastApplied.getSecs()) - _startPoint.getSecs()) / span;
+    }
+
+    const Timestamp _startPoint;
+    const Timestamp _endPoint;
+    Timer _timer;
+    Milliseconds _lastProgressLogTime{0};
     std::size_t _numBatches = 0;
     std::size_t _numOpsApplied = 0;
 };
@@ -248,6 +300,102 @@ private:
     std::unique_ptr<DBClientCursor> _cursor;
 };
 
+/**
+ * Reads applier batches out of an OplogBufferLocalOplog on a dedicated thread, so that the next
+ * batch is read from the oplog while the writer pool applies the current one. This is the recovery
+ * counterpart of the OplogBatcher thread used in steady state replication. At most one batch is
+ * read ahead.
+ *
+ * The oplog buffer is started up and shut down on the prefetch thread, because its cursor is bound
+ * to that thread's operation context.
+ */
+class RecoveryOplogBatchPrefetcher {
+    RecoveryOplogBatchPrefetcher(const RecoveryOplogBatchPrefetcher&) = delete;
+    RecoveryOplogBatchPrefetcher& operator=(const RecoveryOplogBatchPrefetcher&) = delete;
+
+public:
+    RecoveryOplogBatchPrefetcher(OplogApplier* oplogApplier,
+                                 OplogBufferLocalOplog* oplogBuffer,
+                                 OplogApplier::BatchLimits batchLimits)
+        : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer), _batchLimits(batchLimits) {
+        _thread = stdx::thread([this] { _run(); });
+    }
+
+    ~RecoveryOplogBatchPrefetcher() {
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _inShutdown = true;
+        }
+        _cv.notify_all();
+        _thread.join();
+    }
+
+    /**
+     * Waits for the next batch read from the oplog. Returns an empty batch once every operation up
+     * to the end point has been handed out.
+     */
+    std::vector<OplogEntry> getNextBatch(OperationContext* opCtx) {
+        stdx::unique_lock<Latch> lk(_mutex);
+        opCtx->waitForConditionOrInterrupt(_cv, lk, [&] { return _nextBatch.has_value(); });
+        auto batch = std::move(*_nextBatch);
+        _nextBatch.reset();
+        _cv.notify_all();
+        return batch;
+    }
+
+private:
+    void _run() {
+        Client::initThread("ReplRecoveryBatcher");
+        {
+            // Shutdown of this thread is driven by the recovering operation, which joins it.
+            stdx::lock_guard<Client> lk(cc());
+            cc().setSystemOperationUnkillableByStepdown(lk);
+        }
+
+        auto opCtx = cc().makeOperationContext();
+        // Each batch is applied under the PBWM lock in MODE_X. Reading ahead must not wait on it,
+        // nor on a read ticket, for the same reasons as in OplogBatcher.
+        ShouldNotConflictWithSecondaryBatchApplicationBlock noConflict(opCtx->lockState());
+        opCtx->lockState()->setAdmissionPriority(AdmissionContext::Priority::kImmediate);
+
+        _oplogBuffer->startup(opCtx.get());
+        ON_BLOCK_EXIT([&] { _oplogBuffer->shutdown(opCtx.get()); });
+
+        while (true) {
+            auto batch =
+                fassert(50763, _oplogApplier->getNextApplierBatch(opCtx.get(), _batchLimits));
+            const bool exhausted = batch.empty();
+            if (exhausted) {
+                invariant(_oplogBuffer->isEmpty(),
+                          "Oplog buffer not empty after reading all operations for recovery");
+            }
+
+            stdx::unique_lock<Latch> lk(_mutex);
+            _cv.wait(lk, [&] { return _inShutdown || !_nextBatch.has_value(); });
+            if (_inShutdown) {
+                return;
+            }
+            _nextBatch = std::move(batch);
+            _cv.notify_all();
+            if (exhausted) {
+                return;
+            }
+        }
+    }
+
+    OplogApplier* const _oplogApplier;
+    OplogBufferLocalOplog* const _oplogBuffer;
+    const OplogApplier::BatchLimits _batchLimits;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("RecoveryOplogBatchPrefetcher::_mutex");
+    stdx::condition_variable _cv;
+    // Set once the recovering operation no longer wants batches, e.g. because it was interrupted.
+    bool _inShutdown = false;
+    // The batch read ahead of the one being applied, if any.
+    boost::optional<std::vector<OplogEntry>> _nextBatch;
+    stdx::thread _thread;
+};
+
 boost::optional<Timestamp> recoverFromOplogPrecursor(OperationContext* opCtx,
                                                      StorageInterface* storageInterface) {
     if (!storageInterface->supportsRecoveryTimestamp(opCtx->getServiceContext())) {
@@ -704,15 +852,19 @@ Timestamp ReplicationRecoveryImpl::_applyOplogOperations(OperationContext* opCtx
           "endPoint"_attr = endPoint);
 
     OplogBufferLocalOplog oplogBuffer(startPoint, endPoint);
-    oplogBuffer.startup(opCtx);
 
-    RecoveryOplogApplierStats stats;
+    RecoveryOplogApplierStats stats(startPoint, endPoint);
 
     auto oplogApplicationMode = (recoveryMode == RecoveryMode::kStartupFromStableTimestamp ||
                                  recoveryMode == RecoveryMode::kRollbackFromStableTimestamp)
         ? OplogApplication::Mode::kStableRecovering
         : OplogApplication::Mode::kUnstableRecovering;
-    auto writerPool = makeReplWriterPool();
+    // The node serves no reads while it recovers, so recovery gets its own, possibly larger, writer
+    // pool rather than being held to the steady state replWriterThreadCount.
+    auto writerPool = makeReplRecoveryWriterPool();
+    LOGV2(9392700,
+          "Applying oplog for recovery with writer thread pool",
+          "numWriterThreads"_attr = writerPool->getStats().options.maxThreads);
     auto* replCoord = ReplicationCoordinator::get(opCtx);
     OplogApplierImpl oplogApplier(nullptr,
                                   &oplogBuffer,
@@ -740,10 +892,14 @@ Timestamp ReplicationRecoveryImpl::_applyOplogOperations(OperationContext* opCtx
         (recoveryMode == RecoveryMode::kStartupFromStableTimestamp ||
          recoveryMode == RecoveryMode::kStartupFromUnstableCheckpoint);
 
+    // Reading the oplog is overlapped with applying it. The prefetcher owns the oplog buffer for
+    // the duration of the loop below.
+    boost::optional<RecoveryOplogBatchPrefetcher> prefetcher;
+    prefetcher.emplace(&oplogApplier, &oplogBuffer, batchLimits);
+
     OpTime applyThroughOpTime;
     std::vector<OplogEntry> batch;
-    while (
-        !(batch = fassert(50763, oplogApplier.getNextApplierBatch(opCtx, batchLimits))).empty()) {
+    while (!(batch = prefetcher->getNextBatch(opCtx)).empty()) {
         if (advanceTimestampsEachBatch && applyThroughOpTime.isNull()) {
             // We must set appliedThrough before applying anything at all, so we know
             // any unstable checkpoints we take are "dirty".  A null appliedThrough indicates
@@ -758,12 +914,8 @@ Timestamp ReplicationRecoveryImpl::_applyOplogOperations(OperationContext* opCtx
                 applyThroughOpTime.getTimestamp());
         }
     }
+    prefetcher.reset();
     stats.complete(applyThroughOpTime);
-    invariant(oplogBuffer.isEmpty(),
-              str::stream() << "Oplog buffer not empty after applying operations. Last operation "
-                               "applied with optime: "
-                            << applyThroughOpTime.toBSON());
-    oplogBuffer.shutdown(opCtx);
 
     // The applied up to timestamp will be null if no oplog entries were applied.
     if (applyThroughOpTime.isNull()) {
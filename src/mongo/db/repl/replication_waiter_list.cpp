@@ -0,0 +1,121 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/repl/replication_waiter_list.h"
+
+#include <algorithm>
+
+#include "mongo/util/assert_util.h"
+#include "mongo/util/overloaded_visitor.h"
+
+namespace mongo {
+namespace repl {
+
+ReplicationWaiterList::ModeKey ReplicationWaiterList::_makeModeKey(
+    const boost::optional<WriteConcernOptions>& writeConcern) {
+    if (!writeConcern) {
+        return {};
+    }
+
+    ModeKey key;
+    auto& [kind, modeName, numNodes, tags, syncMode, checkCondition] = key;
+    kind = static_cast<int>(writeConcern->w.index()) + 1;
+    stdx::visit(OverloadedVisitor{[&](const std::string& mode) { modeName = mode; },
+                                  [&](std::int64_t num) { numNodes = num; },
+                                  [&](const WTags& wTags) {
+                                      tags.assign(wTags.begin(), wTags.end());
+                                      std::sort(tags.begin(), tags.end());
+                                  }},
+                writeConcern->w);
+    syncMode = static_cast<int>(writeConcern->syncMode);
+    checkCondition = static_cast<int>(writeConcern->checkCondition);
+    return key;
+}
+
+void ReplicationWaiterList::add_inlock(const OpTime& opTime, SharedWaiterHandle waiter) {
+    _waitersByMode[_makeModeKey(waiter->writeConcern)].emplace(opTime, std::move(waiter));
+    ++_numWaiters;
+}
+
+SharedSemiFuture<void> ReplicationWaiterList::add_inlock(const OpTime& opTime,
+                                                         boost::optional<WriteConcernOptions> wc) {
+    auto pf = makePromiseFuture<void>();
+    add_inlock(opTime, std::make_shared<ReplicationWaiter>(std::move(pf.promise), std::move(wc)));
+    return std::move(pf.future);
+}
+
+bool ReplicationWaiterList::remove_inlock(SharedWaiterHandle waiter) {
+    auto modeIt = _waitersByMode.find(_makeModeKey(waiter->writeConcern));
+    if (modeIt == _waitersByMode.end()) {
+        return false;
+    }
+    auto& waiters = modeIt->second;
+    for (auto iter = waiters.begin(); iter != waiters.end(); iter++) {
+        if (iter->second == waiter) {
+            waiters.erase(iter);
+            --_numWaiters;
+            if (waiters.empty()) {
+                _waitersByMode.erase(modeIt);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void ReplicationWaiterList::setValueAll_inlock() {
+    for (auto& [mode, waiters] : _waitersByMode) {
+        for (auto& [opTime, waiter] : waiters) {
+            waiter->promise.emplaceValue();
+        }
+    }
+    _waitersByMode.clear();
+    _numWaiters = 0;
+}
+
+void ReplicationWaiterList::setErrorAll_inlock(Status status) {
+    invariant(!status.isOK());
+    for (auto& [mode, waiters] : _waitersByMode) {
+        for (auto& [opTime, waiter] : waiters) {
+            waiter->promise.setError(status);
+        }
+    }
+    _waitersByMode.clear();
+    _numWaiters = 0;
+}
+
+std::size_t ReplicationWaiterList::size_inlock() const {
+    return _numWaiters;
+}
+
+}  // namespace repl
+}  // namespace mongo
@@ -0,0 +1,163 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "mongo/base/status.h"
+#include "mongo/db/repl/optime.h"
+#include "mongo/db/write_concern_options.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/future.h"
+
+namespace mongo {
+namespace repl {
+
+struct ReplicationWaiter {
+    Promise<void> promise;
+    boost::optional<WriteConcernOptions> writeConcern;
+    explicit ReplicationWaiter(Promise<void> p,
+                               boost::optional<WriteConcernOptions> w = boost::none)
+        : promise(std::move(p)), writeConcern(w) {}
+};
+
+using SharedReplicationWaiterHandle = std::shared_ptr<ReplicationWaiter>;
+
+/**
+ * The waiters of the replication coordinator, for either an optime or a write concern at an
+ * optime. Waiters are indexed by write concern mode, i.e. by everything in their write concern
+ * that decides when it is satisfied (wtimeout does not), and by optime within each mode. Waiters
+ * without a write concern form a mode of their own.
+ *
+ * Not synchronized; the replication coordinator calls every method with its mutex held.
+ */
+class ReplicationWaiterList {
+public:
+    using SharedWaiterHandle = SharedReplicationWaiterHandle;
+
+    // Adds waiter into the list.
+    void add_inlock(const OpTime& opTime, SharedWaiterHandle waiter);
+    // Adds a waiter into the list and returns the future of the waiter's promise.
+    SharedSemiFuture<void> add_inlock(const OpTime& opTime,
+                                      boost::optional<WriteConcernOptions> w = boost::none);
+    // Returns whether waiter is found and removed.
+    bool remove_inlock(SharedWaiterHandle waiter);
+    // Signals all waiters whose opTime is <= the given opTime (if any) that satisfy the
+    // condition in func.
+    template <typename Func>
+    void setValueIf_inlock(Func&& func, boost::optional<OpTime> opTime = boost::none);
+    // Like setValueIf_inlock, but stops at the first waiter of each mode that does not satisfy
+    // func. This is only correct if func is monotonic in the optime within a mode, i.e. if it holds
+    // for a waiter then it holds for every waiter of the same mode with an earlier optime, which
+    // is the case for write concerns checked against member progress. It then only visits the
+    // ready prefix of each mode, plus one waiter, instead of every waiter.
+    template <typename Func>
+    void setReadyPrefixValue_inlock(Func&& func, boost::optional<OpTime> opTime = boost::none);
+    // Signals all waiters from the list and fulfills promises with OK status.
+    void setValueAll_inlock();
+    // Signals all waiters from the list and fulfills promises with Error status.
+    void setErrorAll_inlock(Status status);
+
+    // Returns the number of waiters in the list.
+    std::size_t size_inlock() const;
+
+private:
+    using WaitersByOpTime = std::multimap<OpTime, SharedWaiterHandle>;
+    // The kind of 'w' (see WriteConcernW), its value as a mode name, number or sorted tag set, the
+    // sync mode and the check condition.
+    using ModeKey = std::tuple<int,
+                               std::string,
+                               std::int64_t,
+                               std::vector<std::pair<std::string, std::int64_t>>,
+                               int,
+                               int>;
+
+    static ModeKey _makeModeKey(const boost::optional<WriteConcernOptions>& writeConcern);
+
+    template <typename Func>
+    void _setValueIf_inlock(Func&& func, boost::optional<OpTime> opTime, bool stopAtFirstUnready);
+
+    // Waiters grouped by write concern mode, each group sorted by OpTime. Groups are removed once
+    // they are empty.
+    std::map<ModeKey, WaitersByOpTime> _waitersByMode;
+    std::size_t _numWaiters = 0;
+};
+
+template <typename Func>
+void ReplicationWaiterList::setValueIf_inlock(Func&& func, boost::optional<OpTime> opTime) {
+    _setValueIf_inlock(std::forward<Func>(func), opTime, false /* stopAtFirstUnready */);
+}
+
+template <typename Func>
+void ReplicationWaiterList::setReadyPrefixValue_inlock(Func&& func,
+                                                       boost::optional<OpTime> opTime) {
+    _setValueIf_inlock(std::forward<Func>(func), opTime, true /* stopAtFirstUnready */);
+}
+
+template <typename Func>
+void ReplicationWaiterList::_setValueIf_inlock(Func&& func,
+                                               boost::optional<OpTime> opTime,
+                                               bool stopAtFirstUnready) {
+    for (auto modeIt = _waitersByMode.begin(); modeIt != _waitersByMode.end();) {
+        auto& waiters = modeIt->second;
+        for (auto it = waiters.begin(); it != waiters.end() && (!opTime || it->first <= *opTime);) {
+            const auto& waiter = it->second;
+            try {
+                if (func(it->first, waiter)) {
+                    waiter->promise.emplaceValue();
+                    it = waiters.erase(it);
+                    --_numWaiters;
+                } else if (stopAtFirstUnready) {
+                    break;
+                } else {
+                    ++it;
+                }
+            } catch (const DBException& e) {
+                waiter->promise.setError(e.toStatus());
+                it = waiters.erase(it);
+                --_numWaiters;
+            }
+        }
+        modeIt = waiters.empty() ? _waitersByMode.erase(modeIt) : std::next(modeIt);
+    }
+}
+
+}  // namespace repl
+}  // namespace mongo
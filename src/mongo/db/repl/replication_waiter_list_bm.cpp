@@ -0,0 +1,119 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/platform/basic.h"
+
+#include <benchmark/benchmark.h>
+#include <vector>
+
+#include "mongo/db/repl/replication_waiter_list.h"
+
+namespace mongo {
+namespace repl {
+namespace {
+
+// How many optimes each simulated member progress update advances the satisfied optime by.
+constexpr unsigned kOpTimesPerUpdate = 16;
+
+// A mix of the write concern modes concurrent writers typically wait for.
+std::vector<WriteConcernOptions> makeWriteConcernModes() {
+    std::vector<WriteConcernOptions> modes;
+    modes.emplace_back(2, WriteConcernOptions::SyncMode::NONE, Milliseconds(1000));
+    modes.emplace_back(WriteConcernOptions::kMajority,
+                       WriteConcernOptions::SyncMode::JOURNAL,
+                       Milliseconds(1000));
+    modes.emplace_back(3, WriteConcernOptions::SyncMode::JOURNAL, Milliseconds(1000));
+    WriteConcernOptions tagged;
+    tagged.w = WTags{{"dc", 2}};
+    tagged.syncMode = WriteConcernOptions::SyncMode::JOURNAL;
+    modes.push_back(std::move(tagged));
+    return modes;
+}
+
+/**
+ * Keeps range(0) waiters registered, spread round robin over the write concern modes, and measures
+ * waking the ready ones on each simulated replSetUpdatePosition. Mode i lags the newest satisfied
+ * optime by i updates, as stricter modes do. The waiters woken by an update are replaced by new
+ * ones at later optimes, so every update finds the same backlog.
+ */
+void runWakeReadyWaiters(benchmark::State& state, bool readyPrefixOnly) {
+    const auto modes = makeWriteConcernModes();
+    const auto numWaiters = static_cast<std::size_t>(state.range(0));
+
+    ReplicationWaiterList waiters;
+    unsigned nextInc = 1;
+    auto refill = [&] {
+        while (waiters.size_inlock() < numWaiters) {
+            [[maybe_unused]] auto future =
+                waiters.add_inlock(OpTime(Timestamp(1, nextInc), 1), modes[nextInc % modes.size()]);
+            ++nextInc;
+        }
+    };
+    refill();
+
+    unsigned satisfiedInc = 0;
+    std::size_t numChecks = 0;
+    for (auto _ : state) {
+        satisfiedInc += kOpTimesPerUpdate;
+        auto isSatisfied = [&](const OpTime& opTime, const SharedReplicationWaiterHandle& waiter) {
+            ++numChecks;
+            const auto mode = opTime.getTimestamp().getInc() % modes.size();
+            const auto lag = mode * kOpTimesPerUpdate;
+            return satisfiedInc > lag && opTime.getTimestamp().getInc() <= satisfiedInc - lag;
+        };
+        if (readyPrefixOnly) {
+            waiters.setReadyPrefixValue_inlock(isSatisfied);
+        } else {
+            waiters.setValueIf_inlock(isSatisfied);
+        }
+        refill();
+    }
+    state.counters["checksPerUpdate"] =
+        benchmark::Counter(static_cast<double>(numChecks), benchmark::Counter::kAvgIterations);
+}
+
+// What every member progress update paid before waiters were indexed by mode: each registered
+// waiter's write concern is re-checked.
+void BM_WakeReadyWaitersFullScan(benchmark::State& state) {
+    runWakeReadyWaiters(state, false /* readyPrefixOnly */);
+}
+
+void BM_WakeReadyWaitersReadyPrefix(benchmark::State& state) {
+    runWakeReadyWaiters(state, true /* readyPrefixOnly */);
+}
+
+BENCHMARK(BM_WakeReadyWaitersFullScan)->Arg(1000)->Arg(10 * 1000);
+BENCHMARK(BM_WakeReadyWaitersReadyPrefix)->Arg(1000)->Arg(10 * 1000);
+
+}  // namespace
+}  // namespace repl
+}  // namespace mongo
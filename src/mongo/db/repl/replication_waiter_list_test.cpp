@@ -0,0 +1,124 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/repl/replication_waiter_list.h"
+
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace repl {
+namespace {
+
+using SyncMode = WriteConcernOptions::SyncMode;
+
+const auto kMajority =
+    WriteConcernOptions(WriteConcernOptions::kMajority, SyncMode::JOURNAL, Milliseconds(1000));
+const auto kW2 = WriteConcernOptions(2, SyncMode::NONE, Milliseconds(1000));
+
+OpTime opTime(unsigned inc) {
+    return OpTime(Timestamp(1, inc), 1);
+}
+
+TEST(ReplicationWaiterListTest, ReadyPrefixStopsAtFirstUnreadyWaiterOfEachMode) {
+    ReplicationWaiterList waiters;
+    auto majority1 = waiters.add_inlock(opTime(1), kMajority);
+    auto majority3 = waiters.add_inlock(opTime(3), kMajority);
+    auto w2One = waiters.add_inlock(opTime(1), kW2);
+    auto w2Two = waiters.add_inlock(opTime(2), kW2);
+    ASSERT_EQ(4U, waiters.size_inlock());
+
+    // Majority is satisfied through optime 2 and w:2 through optime 1.
+    int numChecked = 0;
+    waiters.setReadyPrefixValue_inlock([&](const OpTime& waiterOpTime, const auto& waiter) {
+        ++numChecked;
+        return waiterOpTime <= (waiter->writeConcern->isMajority() ? opTime(2) : opTime(1));
+    });
+
+    ASSERT_EQ(4, numChecked);
+    ASSERT(majority1.isReady());
+    ASSERT_FALSE(majority3.isReady());
+    ASSERT(w2One.isReady());
+    ASSERT_FALSE(w2Two.isReady());
+    ASSERT_EQ(2U, waiters.size_inlock());
+}
+
+TEST(ReplicationWaiterListTest, WaitersDifferingOnlyInTimeoutShareAMode) {
+    ReplicationWaiterList waiters;
+    auto first = waiters.add_inlock(opTime(1), kMajority);
+    auto longerTimeout = kMajority;
+    longerTimeout.wTimeout = Milliseconds(5000);
+    auto second = waiters.add_inlock(opTime(2), longerTimeout);
+
+    int numChecked = 0;
+    waiters.setReadyPrefixValue_inlock([&](const OpTime&, const auto&) {
+        ++numChecked;
+        return false;
+    });
+    ASSERT_EQ(1, numChecked);
+}
+
+TEST(ReplicationWaiterListTest, SetValueIfChecksEveryWaiter) {
+    ReplicationWaiterList waiters;
+    auto first = waiters.add_inlock(opTime(1), kW2);
+    auto second = waiters.add_inlock(opTime(2), kW2);
+
+    waiters.setValueIf_inlock(
+        [&](const OpTime& waiterOpTime, const auto&) { return waiterOpTime == opTime(2); });
+    ASSERT_FALSE(first.isReady());
+    ASSERT(second.isReady());
+
+    waiters.setValueIf_inlock([&](const OpTime&, const auto&) -> bool {
+        uasserted(ErrorCodes::UnsatisfiableWriteConcern, "no longer satisfiable");
+    });
+    ASSERT_EQ(ErrorCodes::UnsatisfiableWriteConcern, first.getNoThrow().code());
+    ASSERT_EQ(0U, waiters.size_inlock());
+}
+
+TEST(ReplicationWaiterListTest, RemoveFindsWaiterInItsMode) {
+    ReplicationWaiterList waiters;
+    auto pf = makePromiseFuture<void>();
+    auto waiter = std::make_shared<ReplicationWaiter>(std::move(pf.promise), kW2);
+    waiters.add_inlock(opTime(1), waiter);
+    auto other = waiters.add_inlock(opTime(1));
+
+    ASSERT(waiters.remove_inlock(waiter));
+    ASSERT_FALSE(waiters.remove_inlock(waiter));
+    ASSERT_EQ(1U, waiters.size_inlock());
+
+    waiters.setErrorAll_inlock({ErrorCodes::ShutdownInProgress, "shutting down"});
+    ASSERT_EQ(ErrorCodes::ShutdownInProgress, other.getNoThrow().code());
+    ASSERT_EQ(0U, waiters.size_inlock());
+}
+
+}  // namespace
+}  // namespace repl
+}  // namespace mongo
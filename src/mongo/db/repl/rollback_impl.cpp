@@ -69,6 +69,7 @@
 #include "mongo/logv2/log.h"
 #include "mongo/s/catalog/type_config_version.h"
 #include "mongo/util/scopeguard.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplicationRollback
 
@@ -98,6 +99,24 @@ constexpr auto kNumRecordsFieldName = "numRecords"_sd;
 constexpr auto kToFieldName = "to"_sd;
 constexpr auto kDropTargetFieldName = "dropTarget"_sd;
 
+/**
+ * Records the time spent in a phase of rollback into the RollbackStats when it goes out of scope.
+ */
+class ScopedRollbackPhaseTimer {
+public:
+    ScopedRollbackPhaseTimer(RollbackStats* stats, StringData phase)
+        : _stats(stats), _phase(phase) {}
+
+    ~ScopedRollbackPhaseTimer() {
+        _stats->phaseDurations.emplace_back(_phase.toString(), Milliseconds(_timer.millis()));
+    }
+
+private:
+    RollbackStats* const _stats;
+    const StringData _phase;
+    Timer _timer;
+};
+
 /**
  * Parses the o2 field of a drop or rename oplog entry for the count of the collection that was
  * dropped.
@@ -194,7 +213,10 @@ RollbackImpl::~RollbackImpl() {
 Status RollbackImpl::runRollback(OperationContext* opCtx) {
     _rollbackStats.startTime = opCtx->getServiceContext()->getFastClockSource()->now();
 
-    auto status = _transitionToRollback(opCtx);
+    auto status = [&] {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "transitionToRollback"_sd);
+        return _transitionToRollback(opCtx);
+    }();
     if (!status.isOK()) {
         return status;
     }
@@ -217,7 +239,10 @@ Status RollbackImpl::runRollback(OperationContext* opCtx) {
     ON_BLOCK_EXIT([this, opCtx] { _transitionFromRollbackToSecondary(opCtx); });
     ON_BLOCK_EXIT([this, opCtx] { _summarizeRollback(opCtx); });
 
-    auto commonPointSW = _findCommonPoint(opCtx);
+    auto commonPointSW = [&] {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "findCommonPoint"_sd);
+        return _findCommonPoint(opCtx);
+    }();
     if (!commonPointSW.isOK()) {
         return commonPointSW.getStatus();
     }
@@ -257,7 +282,10 @@ Status RollbackImpl::runRollback(OperationContext* opCtx) {
     // the divergent branch of history. We therefore update the last optimes to the top of the
     // oplog, which should now be at the common point.
     _replicationCoordinator->resetLastOpTimesFromOplog(opCtx);
-    status = _triggerOpObserver(opCtx);
+    status = [&] {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "triggerOpObserver"_sd);
+        return _triggerOpObserver(opCtx);
+    }();
     if (!status.isOK()) {
         return status;
     }
@@ -443,6 +471,7 @@ StatusWith<std::set<NamespaceString>> RollbackImpl::_namespacesForOp(const Oplog
             case OplogEntry::CommandType::kCreate:
             case OplogEntry::CommandType::kDrop:
             case OplogEntry::CommandType::kImportCollection:
+            case OplogEntry::CommandType::kTruncateRange:
             case OplogEntry::CommandType::kCreateIndexes:
             case OplogEntry::CommandType::kDropIndexes:
             case OplogEntry::CommandType::kStartIndexBuild:
@@ -560,7 +589,10 @@ void RollbackImpl::_runPhaseFromAbortToReconstructPreparedTxns(
     OperationContext* opCtx, RollBackLocalOperations::RollbackCommonPoint commonPoint) noexcept {
     // Stop and wait for all background index builds to complete before starting the rollback
     // process.
-    _stopAndWaitForIndexBuilds(opCtx);
+    {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "waitForIndexBuilds"_sd);
+        _stopAndWaitForIndexBuilds(opCtx);
+    }
     _listener->onBgIndexesComplete();
 
     // Before computing record store counts, abort all active transactions. This ensures that
@@ -582,16 +614,18 @@ void RollbackImpl::_runPhaseFromAbortToReconstructPreparedTxns(
     // common point, we keep track of how much each collection's count will change during the
     // rollback. Note: these numbers are relative to the common point, not the stable timestamp,
     // and thus must be set after recovering from the oplog.
-    auto status = _findRecordStoreCounts(opCtx);
-    fassert(31227, status);
+    {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "findRecordStoreCounts"_sd);
+        fassert(31227, _findRecordStoreCounts(opCtx));
+    }
 
     if (shouldCreateDataFiles()) {
         // Write a rollback file for each namespace that has documents that would be deleted by
         // rollback. We need to do this after aborting prepared transactions. Otherwise, we risk
         // unecessary prepare conflicts when trying to read documents that were modified by
         // those prepared transactions, which we know we will abort anyway.
-        status = _writeRollbackFiles(opCtx);
-        fassert(31228, status);
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "writeRollbackFiles"_sd);
+        fassert(31228, _writeRollbackFiles(opCtx));
     } else {
         LOGV2(21598, "Not writing rollback files. 'createRollbackDataFiles' set to false");
     }
@@ -605,7 +639,10 @@ void RollbackImpl::_runPhaseFromAbortToReconstructPreparedTxns(
     }
 
     // Recover to the stable timestamp.
-    auto stableTimestamp = _recoverToStableTimestamp(opCtx);
+    auto stableTimestamp = [&] {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "recoverToStableTimestamp"_sd);
+        return _recoverToStableTimestamp(opCtx);
+    }();
 
     _rollbackStats.stableTimestamp = stableTimestamp;
     _listener->onRecoverToStableTimestamp(stableTimestamp);
@@ -629,7 +666,10 @@ void RollbackImpl::_runPhaseFromAbortToReconstructPreparedTxns(
     // one operation, so certain session operations history may be lost after restoring to the
     // 'stableTimestamp'. We must scan the oplog and restore the transactions table entries to
     // detail the last executed writes.
-    _restoreTxnsTableEntryFromRetryableWrites(opCtx, stableTimestamp);
+    {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "restoreTxnsTable"_sd);
+        _restoreTxnsTableEntryFromRetryableWrites(opCtx, stableTimestamp);
+    }
 
     // During replication recovery, we truncate all oplog entries with timestamps greater than the
     // oplog truncate after point. If we entered rollback, we are guaranteed to have at least one
@@ -660,8 +700,12 @@ void RollbackImpl::_runPhaseFromAbortToReconstructPreparedTxns(
     // being consistent.
     _resetDropPendingState(opCtx);
 
-    // Run the recovery process.
-    _replicationProcess->getReplicationRecovery()->recoverFromOplog(opCtx, stableTimestamp);
+    // Run the recovery process. This replays the oplog from the stable timestamp to the common
+    // point using the parallel oplog applier.
+    {
+        ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "recoverFromOplog"_sd);
+        _replicationProcess->getReplicationRecovery()->recoverFromOplog(opCtx, stableTimestamp);
+    }
     _listener->onRecoverFromOplog();
 
     // Sets the correct post-rollback counts on any collections whose counts changed during the
@@ -675,6 +719,7 @@ void RollbackImpl::_runPhaseFromAbortToReconstructPreparedTxns(
     // transactions were aborted (i.e. the in-memory counts were rolled-back) before computing
     // collection counts, reconstruct the prepared transactions now, adding on any additional counts
     // to the now corrected record store.
+    ScopedRollbackPhaseTimer phaseTimer(&_rollbackStats, "reconstructPreparedTransactions"_sd);
     reconstructPreparedTransactions(opCtx, OplogApplication::Mode::kStableRecovering);
 }
 
@@ -1010,6 +1055,10 @@ Status RollbackImpl::_processRollbackOp(OperationContext* opCtx, const OplogEntr
                 _pendingDrops.erase(importTargetUUID);
                 _newCounts.erase(importTargetUUID);
             }
+        } else if (oplogEntry.getCommandType() == OplogEntry::CommandType::kTruncateRange) {
+            // Rolling back a range truncate must restore every document it removed.
+            _countDiffs[oplogEntry.getUuid().value()] +=
+                oplogEntry.getObject()["docsDeleted"].safeNumberLong();
         } else if (oplogEntry.getCommandType() == OplogEntry::CommandType::kDrop ||
                    oplogEntry.getCommandType() == OplogEntry::CommandType::kDropGlobalIndex) {
             // The collection count at collection drop time is op-logged in the 'o2' field.
@@ -1463,6 +1512,12 @@ void RollbackImpl::_summarizeRollback(OperationContext* opCtx) const {
     attrs.add("affectedNamespaces", _observerInfo.rollbackNamespaces);
     attrs.add("rollbackCommandCounts", _observerInfo.rollbackCommandCounts);
     attrs.add("totalEntriesRolledBackIncludingNoops", _observerInfo.numberOfEntriesObserved);
+    BSONObjBuilder phaseDurationsBuilder;
+    for (const auto& [phase, duration] : _rollbackStats.phaseDurations) {
+        phaseDurationsBuilder.append(phase, durationCount<Milliseconds>(duration));
+    }
+    const auto phaseDurations = phaseDurationsBuilder.obj();
+    attrs.add("phaseDurationsMillis", phaseDurations);
     LOGV2(21612, "Rollback summary", attrs);
 }
 
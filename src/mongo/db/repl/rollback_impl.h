@@ -30,6 +30,9 @@
 #pragma once
 
 #include <functional>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "mongo/base/status_with.h"
 #include "mongo/db/op_observer/op_observer.h"
@@ -105,6 +108,12 @@ struct RollbackStats {
      * The wall clock time of the first operation after the common point, if known.
      */
     boost::optional<Date_t> firstOpWallClockTimeAfterCommonPoint;
+
+    /**
+     * The time spent in each phase of rollback, in the order the phases completed. Phases that did
+     * not run because rollback exited early are absent.
+     */
+    std::vector<std::pair<std::string, Milliseconds>> phaseDurations;
 };
 
 /**
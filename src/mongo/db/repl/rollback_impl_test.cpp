@@ -578,6 +578,38 @@ TEST_F(RollbackImplTest, RollbackSucceedsIfTopOfOplogIsFirstOpAfterCommonPoint)
     ASSERT_OK(_rollback->runRollback(_opCtx.get()));
 }
 
+TEST_F(RollbackImplTest, RollbackSummaryIncludesPhaseDurations) {
+    auto op = makeOpAndRecordId(1);
+    _remoteOplog->setOperations({op});
+    ASSERT_OK(_insertOplogEntry(op.first));
+    ASSERT_OK(_insertOplogEntry(makeOp(2)));
+
+    _storageInterface->setStableTimestamp(nullptr, Timestamp(1, 1));
+
+    startCapturingLogMessages();
+    ASSERT_OK(_rollback->runRollback(_opCtx.get()));
+    stopCapturingLogMessages();
+
+    boost::optional<BSONObj> phaseDurations;
+    for (const auto& log : getCapturedBSONFormatLogMessages()) {
+        if (log["id"].numberInt() == 21612) {
+            phaseDurations = log["attr"]["phaseDurationsMillis"].Obj().getOwned();
+        }
+    }
+    ASSERT(phaseDurations);
+    for (auto phase : {"transitionToRollback",
+                       "findCommonPoint",
+                       "waitForIndexBuilds",
+                       "findRecordStoreCounts",
+                       "recoverToStableTimestamp",
+                       "restoreTxnsTable",
+                       "recoverFromOplog",
+                       "reconstructPreparedTransactions",
+                       "triggerOpObserver"}) {
+        ASSERT(phaseDurations->hasField(phase)) << phase;
+    }
+}
+
 TEST_F(RollbackImplTest, RollbackKillsNecessaryOperations) {
     auto op = makeOpAndRecordId(1);
     _remoteOplog->setOperations({op});
@@ -1422,6 +1454,42 @@ TEST_F(RollbackImplTest, CountChangesCancelOut) {
     ASSERT_EQ(_storageInterface->getFinalCollectionCount(uuid), 1);
 }
 
+TEST_F(RollbackImplTest, RollbackRestoresCountOfTruncatedRange) {
+    auto uuid = kGenericUUID;
+    _storageInterface->setStableTimestamp(nullptr, Timestamp(1, 1));
+
+    const auto commonOp = makeOpAndRecordId(1);
+    _remoteOplog->setOperations({commonOp});
+    ASSERT_OK(_insertOplogEntry(commonOp.first));
+
+    const auto coll = _initializeCollection(_opCtx.get(), uuid, nss);
+
+    // A range truncate removed three documents, then another document was inserted.
+    BSONObjBuilder truncateRangeCmd;
+    truncateRangeCmd.append("truncateRange", nss.coll());
+    RecordId(1).serializeToken("minRecordId", &truncateRangeCmd);
+    RecordId(3).serializeToken("maxRecordId", &truncateRangeCmd);
+    truncateRangeCmd.append("bytesDeleted", 3 * BSON("_id" << 1).objsize());
+    truncateRangeCmd.append("docsDeleted", 3);
+    ASSERT_OK(_insertOplogEntry(makeCommandOp(Timestamp(2, 2),
+                                              uuid,
+                                              nss.getCommandNS().toString(),
+                                              truncateRangeCmd.obj(),
+                                              2)
+                                    .first));
+    _insertDocAndGenerateOplogEntry(BSON("_id" << 4), uuid, nss, 3);
+
+    ASSERT_EQ(1ULL,
+              unittest::assertGet(_storageInterface->getCollectionCount(
+                  _opCtx.get(), {nss.db().toString(), uuid})));
+    ASSERT_OK(_storageInterface->setCollectionCount(nullptr, {"", uuid}, 1));
+
+    _assertDocsInOplog(_opCtx.get(), {1, 2, 3});
+
+    ASSERT_OK(_rollback->runRollback(_opCtx.get()));
+    ASSERT_EQ(_storageInterface->getFinalCollectionCount(uuid), 3);
+}
+
 TEST_F(RollbackImplTest, RollbackIgnoresSetCollectionCountError) {
     _storageInterface->setStableTimestamp(nullptr, Timestamp(1, 1));
 
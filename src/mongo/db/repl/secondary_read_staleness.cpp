@@ -0,0 +1,194 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/repl/secondary_read_staleness.h"
+
+#include <algorithm>
+
+#include "mongo/base/counter.h"
+#include "mongo/client/read_preference.h"
+#include "mongo/db/logical_time.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/read_concern_args.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/repl/secondary_read_staleness_gen.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/str.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplication
+
+namespace mongo {
+namespace repl {
+namespace {
+
+// Cached parse of 'secondaryReadStalenessAdmissionMode', so that the per-read check does not have
+// to lock the synchronized parameter value.
+AtomicWord<SecondaryReadStalenessAdmissionMode> admissionMode{
+    SecondaryReadStalenessAdmissionMode::kOff};
+
+struct SecondaryReadStalenessCounters {
+    // Reads that had a staleness bound and a lag estimate to check it against.
+    Counter64 checked;
+    // Reads that exceeded their bound and had to wait for this node to catch up.
+    Counter64 waited;
+    // Reads that exceeded their bound and were failed with SecondaryStalenessExceeded.
+    Counter64 rejected;
+};
+SecondaryReadStalenessCounters counters;
+
+boost::optional<SecondaryReadStalenessAdmissionMode> parseAdmissionMode(StringData value) {
+    if (value == kSecondaryReadStalenessAdmissionOff) {
+        return SecondaryReadStalenessAdmissionMode::kOff;
+    }
+    if (value == kSecondaryReadStalenessAdmissionReject) {
+        return SecondaryReadStalenessAdmissionMode::kReject;
+    }
+    if (value == kSecondaryReadStalenessAdmissionWait) {
+        return SecondaryReadStalenessAdmissionMode::kWait;
+    }
+    return boost::none;
+}
+
+StringData admissionModeToString(SecondaryReadStalenessAdmissionMode mode) {
+    switch (mode) {
+        case SecondaryReadStalenessAdmissionMode::kOff:
+            return kSecondaryReadStalenessAdmissionOff;
+        case SecondaryReadStalenessAdmissionMode::kReject:
+            return kSecondaryReadStalenessAdmissionReject;
+        case SecondaryReadStalenessAdmissionMode::kWait:
+            return kSecondaryReadStalenessAdmissionWait;
+    }
+    MONGO_UNREACHABLE;
+}
+
+/**
+ * Returns the staleness bound that applies to the current operation, or zero if it has none.
+ */
+Seconds getStalenessBound(OperationContext* opCtx) {
+    const auto& readPref = ReadPreferenceSetting::get(opCtx);
+    if (readPref.maxStalenessSeconds > Seconds(0)) {
+        return readPref.maxStalenessSeconds;
+    }
+    return Seconds(gSecondaryReadMaxStalenessSecs.load());
+}
+
+}  // namespace
+
+Status validateSecondaryReadStalenessAdmissionMode(const std::string& value,
+                                                   const boost::optional<TenantId>&) {
+    if (!parseAdmissionMode(value)) {
+        return {ErrorCodes::BadValue,
+                str::stream() << "Invalid secondaryReadStalenessAdmissionMode '" << value
+                              << "', expected one of '" << kSecondaryReadStalenessAdmissionOff
+                              << "', '" << kSecondaryReadStalenessAdmissionReject << "' or '"
+                              << kSecondaryReadStalenessAdmissionWait << "'"};
+    }
+    return Status::OK();
+}
+
+Status onUpdateSecondaryReadStalenessAdmissionMode(const std::string& value) {
+    auto mode = parseAdmissionMode(value);
+    invariant(mode);
+    admissionMode.store(*mode);
+    return Status::OK();
+}
+
+void admitSecondaryReadWithinStalenessBound(OperationContext* opCtx) {
+    const auto mode = admissionMode.load();
+    if (mode == SecondaryReadStalenessAdmissionMode::kOff) {
+        return;
+    }
+
+    const auto bound = getStalenessBound(opCtx);
+    if (bound <= Seconds(0)) {
+        return;
+    }
+
+    auto replCoord = ReplicationCoordinator::get(opCtx);
+    auto estimate = replCoord->estimateReplicationLag();
+    if (!estimate) {
+        return;
+    }
+
+    counters.checked.increment();
+    if (estimate->lag <= bound) {
+        return;
+    }
+
+    if (mode == SecondaryReadStalenessAdmissionMode::kWait) {
+        counters.waited.increment();
+        const auto deadline = std::min(opCtx->getServiceContext()->getFastClockSource()->now() +
+                                           Milliseconds(gSecondaryReadStalenessMaxWaitMS.load()),
+                                       opCtx->getDeadline());
+        const ReadConcernArgs catchUpReadConcern(
+            LogicalTime(estimate->referenceOpTime.getTimestamp()),
+            ReadConcernLevel::kLocalReadConcern);
+        auto waitStatus =
+            replCoord->waitUntilOpTimeForReadUntil(opCtx, catchUpReadConcern, deadline);
+        if (!waitStatus.isOK()) {
+            LOGV2_DEBUG(9392600,
+                        2,
+                        "Stale secondary read did not catch up before its admission deadline",
+                        "bound"_attr = bound,
+                        "estimatedLag"_attr = estimate->lag,
+                        "error"_attr = waitStatus);
+        }
+
+        // The wait only fails on its own deadline or on interruption. Propagate interruption and
+        // re-check the lag otherwise.
+        opCtx->checkForInterrupt();
+        estimate = replCoord->estimateReplicationLag();
+        if (!estimate || estimate->lag <= bound) {
+            return;
+        }
+    }
+
+    counters.rejected.increment();
+    uasserted(ErrorCodes::SecondaryStalenessExceeded,
+              str::stream() << "Estimated replication lag of " << estimate->lag
+                            << " exceeds the read's staleness bound of " << bound);
+}
+
+void appendSecondaryReadStalenessStats(OperationContext* opCtx, BSONObjBuilder* result) {
+    BSONObjBuilder builder(result->subobjStart("secondaryReadStaleness"));
+    builder.append("mode", admissionModeToString(admissionMode.load()));
+    if (auto estimate = ReplicationCoordinator::get(opCtx)->estimateReplicationLag()) {
+        builder.append("estimatedLagMillis", durationCount<Milliseconds>(estimate->lag));
+    }
+    builder.append("checked", counters.checked.get());
+    builder.append("waited", counters.waited.get());
+    builder.append("rejected", counters.rejected.get());
+}
+
+}  // namespace repl
+}  // namespace mongo
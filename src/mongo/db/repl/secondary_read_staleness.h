@@ -0,0 +1,87 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <string>
+
+#include "mongo/base/status.h"
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/tenant_id.h"
+
+namespace mongo {
+
+class OperationContext;
+
+namespace repl {
+
+/*
+ * Server-side admission control for reads on secondaries that carry a staleness bound.
+ *
+ * The bound of a read is the maxStalenessSeconds of its read preference, or
+ * 'secondaryReadMaxStalenessSecs' when the read preference does not specify one. The node's
+ * replication lag is estimated by the ReplicationCoordinator from the heartbeat data of the
+ * primary, so a secondary that is catching up can shed reads it cannot serve fresh enough
+ * instead of letting them pile up.
+ */
+
+/**
+ * What to do with a read whose staleness bound is exceeded, see
+ * 'secondaryReadStalenessAdmissionMode'.
+ */
+enum class SecondaryReadStalenessAdmissionMode { kOff, kReject, kWait };
+
+constexpr auto kSecondaryReadStalenessAdmissionOff = "off"_sd;
+constexpr auto kSecondaryReadStalenessAdmissionReject = "reject"_sd;
+constexpr auto kSecondaryReadStalenessAdmissionWait = "wait"_sd;
+
+Status validateSecondaryReadStalenessAdmissionMode(const std::string& value,
+                                                   const boost::optional<TenantId>&);
+Status onUpdateSecondaryReadStalenessAdmissionMode(const std::string& value);
+
+/**
+ * Checks the staleness bound of a read that is about to run on this secondary. Does nothing if
+ * admission is disabled, no bound applies, or the lag cannot be estimated. Otherwise, if the
+ * estimated lag exceeds the bound, throws SecondaryStalenessExceeded; in 'wait' mode the read
+ * first waits, up to 'secondaryReadStalenessMaxWaitMS' and the operation's deadline, for this node
+ * to apply everything the reference member had applied when the estimate was taken.
+ */
+void admitSecondaryReadWithinStalenessBound(OperationContext* opCtx);
+
+/**
+ * Appends the admission mode, the current lag estimate and the admission counters to 'result'.
+ */
+void appendSecondaryReadStalenessStats(OperationContext* opCtx, BSONObjBuilder* result);
+
+}  // namespace repl
+}  // namespace mongo
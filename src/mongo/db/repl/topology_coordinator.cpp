@@ -85,6 +85,20 @@ constexpr Milliseconds TopologyCoordinator::PingStats::UninitializedPingTime;
 CounterMetric numSyncSourceChangesDueToSignificantlyCloserNode(
     "repl.syncSource.numSyncSourceChangesDueToSignificantlyCloserNode");
 
+// Tracks the number of times load-aware selection chose a sync source other than the closest
+// eligible node, because fewer members were syncing from it.
+CounterMetric numSelectionsDivertedByLoad("repl.syncSource.numSelectionsDivertedByLoad");
+
+// Tracks the number of times we decide to change sync sources because an equally close node serves
+// significantly fewer members than our current sync source.
+CounterMetric numSyncSourceChangesDueToLoadImbalance(
+    "repl.syncSource.numSyncSourceChangesDueToLoadImbalance");
+
+// Tracks the number of times we started skipping the re-evaluation of our sync source because we
+// had already changed sync sources 'maxNumSyncSourceChangesPerHour' times in the past hour. A
+// steadily growing value means sync sources are churning.
+CounterMetric numChurnBackoffWindows("repl.syncSource.numChurnBackoffWindows");
+
 using namespace fmt::literals;
 
 std::string TopologyCoordinator::roleToString(TopologyCoordinator::Role role) {
@@ -312,6 +326,8 @@ HostAndPort TopologyCoordinator::_chooseNearbySyncSource(Date_t now,
     // find the member with the lowest ping time that is ahead of me
 
     int closestIndex = -1;
+    // The candidates that were eligible in the attempt that set 'closestIndex'.
+    std::vector<int> eligibleCandidates;
 
     // Make two attempts, with less restrictive rules the second time.
     //
@@ -322,6 +338,7 @@ HostAndPort TopologyCoordinator::_chooseNearbySyncSource(Date_t now,
     //
     // This loop attempts to set 'closestIndex', to select a viable candidate.
     for (int attempts = 0; attempts < 2; ++attempts) {
+        eligibleCandidates.clear();
         for (size_t candidateIndex = 0; candidateIndex < _memberData.size(); candidateIndex++) {
             if (!_isEligibleSyncSource(candidateIndex,
                                        now,
@@ -332,6 +349,7 @@ HostAndPort TopologyCoordinator::_chooseNearbySyncSource(Date_t now,
                 // Node is not a viable sync source candidate.
                 continue;
             }
+            eligibleCandidates.push_back(candidateIndex);
 
             // Set 'closestIndex' if this node is the first viable candidate we have encountered.
             if (closestIndex == -1) {
@@ -374,6 +392,10 @@ HostAndPort TopologyCoordinator::_chooseNearbySyncSource(Date_t now,
         return HostAndPort();
     }
 
+    if (enableLoadAwareSyncSourceSelection.load()) {
+        closestIndex = _chooseLeastLoadedNearbySyncSource(closestIndex, eligibleCandidates);
+    }
+
     auto syncSource = _rsConfig.getMemberAt(closestIndex).getHostAndPort();
     LOGV2(21799, "Sync source candidate chosen", "syncSource"_attr = syncSource);
     std::string msg(str::stream() << "syncing from: " << syncSource.toString(), 0);
@@ -381,6 +403,50 @@ HostAndPort TopologyCoordinator::_chooseNearbySyncSource(Date_t now,
     return syncSource;
 }
 
+int TopologyCoordinator::_chooseLeastLoadedNearbySyncSource(
+    int closestIndex, const std::vector<int>& eligibleCandidates) {
+    const auto closestNode = _rsConfig.getMemberAt(closestIndex).getHostAndPort();
+    const auto closestPing = _getPing(closestNode);
+    const Milliseconds sameDataCenterThreshold(changeSyncSourceThresholdMillis.load());
+
+    int chosenIndex = closestIndex;
+    auto chosenPing = closestPing;
+    auto chosenLoad = _numMembersSyncingFrom(closestIndex);
+    for (auto candidateIndex : eligibleCandidates) {
+        const auto candidatePing = _getPing(_rsConfig.getMemberAt(candidateIndex).getHostAndPort());
+        // Only trade latency for load among nodes that look like they are in the same data center
+        // as the closest one.
+        if (candidatePing - closestPing > sameDataCenterThreshold) {
+            continue;
+        }
+        const auto candidateLoad = _numMembersSyncingFrom(candidateIndex);
+        if (candidateLoad < chosenLoad ||
+            (candidateLoad == chosenLoad && candidatePing < chosenPing)) {
+            chosenIndex = candidateIndex;
+            chosenPing = candidatePing;
+            chosenLoad = candidateLoad;
+        }
+    }
+
+    if (chosenIndex != closestIndex) {
+        LOGV2(9393000,
+              "Choosing a less loaded sync source candidate than the closest one",
+              "closestNode"_attr = closestNode,
+              "closestNodeSyncingMembers"_attr = _numMembersSyncingFrom(closestIndex),
+              "syncSourceCandidate"_attr = _rsConfig.getMemberAt(chosenIndex).getHostAndPort(),
+              "syncSourceCandidateSyncingMembers"_attr = chosenLoad);
+        numSelectionsDivertedByLoad.increment();
+    }
+    return chosenIndex;
+}
+
+int TopologyCoordinator::_numMembersSyncingFrom(int memberIndex) const {
+    const auto& member = _rsConfig.getMemberAt(memberIndex).getHostAndPort();
+    return std::count_if(_memberData.begin(), _memberData.end(), [&](const MemberData& data) {
+        return !data.isSelf() && data.up() && data.getSyncSource() == member;
+    });
+}
+
 OpTime TopologyCoordinator::_getOldestSyncOpTime() const {
     OpTime oldestSyncOpTime = OpTime();
 
@@ -1356,6 +1422,34 @@ OpTimeAndWallTime TopologyCoordinator::getMyLastDurableOpTimeAndWallTime() const
     return {_selfMemberData().getLastDurableOpTime(), _selfMemberData().getLastDurableWallTime()};
 }
 
+boost::optional<OpTimeAndWallTime>
+TopologyCoordinator::getReplicationLagReferenceOpTimeAndWallTime() const {
+    if (_selfIndex == -1 || _currentPrimaryIndex == _selfIndex) {
+        return boost::none;
+    }
+
+    const MemberData* reference = nullptr;
+    if (_currentPrimaryIndex != -1) {
+        reference = &_memberData.at(_currentPrimaryIndex);
+    } else {
+        for (const auto& memberData : _memberData) {
+            if (memberData.isSelf() || !memberData.up()) {
+                continue;
+            }
+            if (!reference ||
+                memberData.getLastAppliedOpTime() > reference->getLastAppliedOpTime()) {
+                reference = &memberData;
+            }
+        }
+    }
+
+    if (!reference || reference->getLastAppliedOpTime().isNull()) {
+        return boost::none;
+    }
+    return OpTimeAndWallTime(reference->getLastAppliedOpTime(),
+                             reference->getLastAppliedWallTime());
+}
+
 void TopologyCoordinator::setMyLastDurableOpTimeAndWallTime(OpTimeAndWallTime opTimeAndWallTime,
                                                             Date_t now,
                                                             bool isRollbackAllowed) {
@@ -3310,14 +3404,10 @@ bool TopologyCoordinator::_shouldChangeSyncSourceDueToBetterEligibleSource(
     return false;
 }
 
-bool TopologyCoordinator::shouldChangeSyncSourceDueToPingTime(const HostAndPort& currentSource,
-                                                              const MemberState& memberState,
-                                                              const OpTime& previousOpTimeFetched,
-                                                              Date_t now,
-                                                              const ReadPreference readPreference) {
-    // If we find an eligible sync source that is significantly closer than our current sync source,
-    // return true.
-
+bool TopologyCoordinator::_canReevaluateSyncSource(const HostAndPort& currentSource,
+                                                   const MemberState& memberState,
+                                                   Date_t now,
+                                                   const ReadPreference readPreference) {
     // Do not re-evaluate our sync source if it was set via the replSetSyncFrom command or the
     // forceSyncSourceCandidate failpoint.
     auto sfp = forceSyncSourceCandidate.scoped();
@@ -3336,21 +3426,36 @@ bool TopologyCoordinator::shouldChangeSyncSourceDueToPingTime(const HostAndPort&
         return false;
     }
 
-    // If we have already changed sync sources more than 'maxNumSyncSourceChangesPerHour' in the
-    // past hour, do not re-evaluate our sync source.
-    if (_recentSyncSourceChanges.changedTooOftenRecently(now)) {
-        return false;
-    }
-
     const bool primaryOnly = (readPreference == ReadPreference::PrimaryOnly);
     const bool primaryPreferredAndAlreadySyncing =
         (readPreference == ReadPreference::PrimaryPreferred &&
          (currentSource == getCurrentPrimaryMember()->getHostAndPort()));
 
-    if (primaryOnly || primaryPreferredAndAlreadySyncing) {
+    return !primaryOnly && !primaryPreferredAndAlreadySyncing;
+}
+
+bool TopologyCoordinator::shouldChangeSyncSourceDueToPingTime(const HostAndPort& currentSource,
+                                                              const MemberState& memberState,
+                                                              const OpTime& previousOpTimeFetched,
+                                                              Date_t now,
+                                                              const ReadPreference readPreference) {
+    // If we find an eligible sync source that is significantly closer than our current sync source,
+    // return true.
+    if (!_canReevaluateSyncSource(currentSource, memberState, now, readPreference)) {
         return false;
     }
 
+    // If we have already changed sync sources more than 'maxNumSyncSourceChangesPerHour' in the
+    // past hour, do not re-evaluate our sync source.
+    if (_recentSyncSourceChanges.changedTooOftenRecently(now)) {
+        if (!_inSyncSourceChurnBackoff) {
+            _inSyncSourceChurnBackoff = true;
+            numChurnBackoffWindows.increment();
+        }
+        return false;
+    }
+    _inSyncSourceChurnBackoff = false;
+
     const auto changeSyncSourceThreshold = changeSyncSourceThresholdMillis.load();
     // If the threshold is set to zero, do not consider changing sync sources due to ping time.
     if (changeSyncSourceThreshold == 0LL) {
@@ -3409,6 +3514,76 @@ bool TopologyCoordinator::shouldChangeSyncSourceDueToPingTime(const HostAndPort&
     return false;
 }
 
+bool TopologyCoordinator::shouldChangeSyncSourceDueToLoad(const HostAndPort& currentSource,
+                                                          const MemberState& memberState,
+                                                          const OpTime& previousOpTimeFetched,
+                                                          Date_t now,
+                                                          const ReadPreference readPreference) {
+    if (!enableLoadAwareSyncSourceSelection.load() ||
+        !_canReevaluateSyncSource(currentSource, memberState, now, readPreference) ||
+        _recentSyncSourceChanges.changedTooOftenRecently(now)) {
+        return false;
+    }
+
+    // Sync source load is only known from heartbeats, so wait for the same amount of heartbeat
+    // data as re-evaluating on ping time does.
+    int numPingsNeeded = (_memberData.size() - 1) * 5 - pingsInConfig;
+    if (numPingsNeeded > 0) {
+        return false;
+    }
+
+    const int currentSourceIndex = _rsConfig.findMemberIndexByHostAndPort(currentSource);
+    if (currentSourceIndex == -1 || _pings.count(currentSource) == 0) {
+        return false;
+    }
+
+    const auto syncSourcePingTime = _pings.at(currentSource).getMillis();
+    const auto syncSourceLoad = _numMembersSyncingFrom(currentSourceIndex);
+    const auto imbalanceThreshold = syncSourceLoadImbalanceThreshold.load();
+    const Milliseconds sameDataCenterThreshold(changeSyncSourceThresholdMillis.load());
+
+    // Look for an eligible sync source that is no further away than our current one allows for a
+    // node in the same data center, and that significantly fewer members sync from.
+    for (size_t candidateIndex = 0; candidateIndex < _memberData.size(); candidateIndex++) {
+        if (static_cast<int>(candidateIndex) == currentSourceIndex) {
+            continue;
+        }
+        const auto candidateNode = _memberData[candidateIndex].getHostAndPort();
+        if (_pings.count(candidateNode) == 0) {
+            continue;
+        }
+
+        const auto candidatePingTime = _pings.at(candidateNode).getMillis();
+        if (candidatePingTime - syncSourcePingTime > sameDataCenterThreshold) {
+            continue;
+        }
+
+        const auto candidateLoad = _numMembersSyncingFrom(candidateIndex);
+        if (syncSourceLoad - candidateLoad < imbalanceThreshold) {
+            continue;
+        }
+
+        if (_isEligibleSyncSource(candidateIndex,
+                                  now,
+                                  previousOpTimeFetched,
+                                  readPreference,
+                                  true /* firstAttempt */,
+                                  true /* shouldCheckStaleness */)) {
+            LOGV2(9393001,
+                  "Choosing new sync source because we have found another potential sync source "
+                  "in the same data center that significantly fewer members sync from",
+                  "syncSource"_attr = currentSource,
+                  "syncSourceSyncingMembers"_attr = syncSourceLoad,
+                  "syncSourceLoadImbalanceThreshold"_attr = imbalanceThreshold,
+                  "candidateNode"_attr = candidateNode,
+                  "candidateSyncingMembers"_attr = candidateLoad);
+            numSyncSourceChangesDueToLoadImbalance.increment();
+            return true;
+        }
+    }
+    return false;
+}
+
 rpc::ReplSetMetadata TopologyCoordinator::prepareReplSetMetadata(
     const OpTime& lastVisibleOpTime) const {
     return rpc::ReplSetMetadata(_term,
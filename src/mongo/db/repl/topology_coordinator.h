@@ -289,6 +289,17 @@ public:
                                              Date_t now,
                                              ReadPreference readPreference);
 
+    /**
+     * Returns true if enableLoadAwareSyncSourceSelection is set and we find an eligible sync source
+     * in the same data center as our current one that at least syncSourceLoadImbalanceThreshold
+     * fewer members sync from, going by the sync sources reported in heartbeats.
+     */
+    bool shouldChangeSyncSourceDueToLoad(const HostAndPort& currentSource,
+                                         const MemberState& memberState,
+                                         const OpTime& previousOpTimeFetched,
+                                         Date_t now,
+                                         ReadPreference readPreference);
+
     /**
      * Sets the reported mode of this node to one of RS_SECONDARY, RS_STARTUP2, RS_ROLLBACK or
      * RS_RECOVERING, when getRole() == Role::follower.  This is the interface by which the
@@ -578,6 +589,14 @@ public:
                                            Date_t now,
                                            bool isRollbackAllowed);
 
+    /*
+     * Returns the last applied optime and wall time of the member that this node's replication
+     * lag should be measured against: the current primary if one is known, otherwise the most
+     * up-to-date healthy member. Returns boost::none if this node is primary, is not a member of
+     * the current config, or has no usable heartbeat data for any other member.
+     */
+    boost::optional<OpTimeAndWallTime> getReplicationLagReferenceOpTimeAndWallTime() const;
+
     /*
      * Sets the last optimes for a node, other than this node, based on the data from a
      * replSetUpdatePosition command.
@@ -925,6 +944,22 @@ private:
                                         const OpTime& lastOpTimeFetched,
                                         ReadPreference readPreference);
 
+    // Among 'eligibleCandidates' within changeSyncSourceThresholdMillis of the closest one, returns
+    // the index of the member that the fewest other members sync from, preferring lower ping times.
+    int _chooseLeastLoadedNearbySyncSource(int closestIndex,
+                                           const std::vector<int>& eligibleCandidates);
+
+    // Returns how many other members report syncing from the member at 'memberIndex' in their
+    // latest heartbeat responses.
+    int _numMembersSyncingFrom(int memberIndex) const;
+
+    // Returns false if our sync source must not be re-evaluated now, e.g. because it was set with
+    // replSetSyncFrom, we are in initial sync or our read preference pins it.
+    bool _canReevaluateSyncSource(const HostAndPort& currentSource,
+                                  const MemberState& memberState,
+                                  Date_t now,
+                                  ReadPreference readPreference);
+
     // Does preliminary checkes to see if a new sync source should be chosen
     // * Do we have a valid configuration -- if so, we do not change sync source.
     // * Are we in initial sync -- if so, we do not change sync source.
@@ -1192,6 +1227,10 @@ private:
     ReadCommittedSupport _storageEngineSupportsReadCommitted{ReadCommittedSupport::kUnknown};
 
     RecentSyncSourceChanges _recentSyncSourceChanges;
+
+    // Whether the last re-evaluation of our sync source on ping time was skipped because we had
+    // changed sync sources too often recently.
+    bool _inSyncSourceChurnBackoff = false;
 };
 
 /**
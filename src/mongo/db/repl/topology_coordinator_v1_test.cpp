@@ -34,6 +34,7 @@
 
 #include "mongo/bson/json.h"
 #include "mongo/db/catalog/commit_quorum_options.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/repl/heartbeat_response_action.h"
 #include "mongo/db/repl/isself.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
@@ -1815,6 +1816,66 @@ TEST_F(TopoCoordTest,
     ASSERT_EQUALS(HostAndPort("h5").toString(), response2Obj["prevSyncTarget"].String());
 }
 
+TEST_F(TopoCoordTest, ReplicationLagReferenceIsPrimaryOrMostUpToDateMember) {
+    updateConfig(BSON("_id"
+                      << "rs0"
+                      << "version" << 1 << "members"
+                      << BSON_ARRAY(BSON("_id" << 10 << "host"
+                                               << "hself")
+                                    << BSON("_id" << 20 << "host"
+                                                  << "h2")
+                                    << BSON("_id" << 30 << "host"
+                                                  << "h3"))),
+                 0);
+    setSelfMemberState(MemberState::RS_SECONDARY);
+    setMyOpTime(OpTime(Timestamp(1, 0), 0));
+
+    // Without heartbeat data there is nothing to measure the lag against.
+    ASSERT_FALSE(getTopoCoord().getReplicationLagReferenceOpTimeAndWallTime());
+
+    // Without a primary, lag is measured against the most up-to-date member.
+    heartbeatFromMember(
+        HostAndPort("h2"), "rs0", MemberState::RS_SECONDARY, OpTime(Timestamp(5, 0), 0));
+    heartbeatFromMember(
+        HostAndPort("h3"), "rs0", MemberState::RS_SECONDARY, OpTime(Timestamp(10, 0), 0));
+    auto reference = getTopoCoord().getReplicationLagReferenceOpTimeAndWallTime();
+    ASSERT(reference);
+    ASSERT_EQUALS(OpTime(Timestamp(10, 0), 0), reference->opTime);
+    ASSERT_EQUALS(Date_t() + Seconds(10), reference->wallTime);
+
+    // Members that are down are not considered.
+    receiveDownHeartbeat(HostAndPort("h3"), "rs0");
+    reference = getTopoCoord().getReplicationLagReferenceOpTimeAndWallTime();
+    ASSERT(reference);
+    ASSERT_EQUALS(OpTime(Timestamp(5, 0), 0), reference->opTime);
+
+    // Once a primary is known, lag is always measured against it.
+    heartbeatFromMember(
+        HostAndPort("h3"), "rs0", MemberState::RS_SECONDARY, OpTime(Timestamp(10, 0), 0));
+    heartbeatFromMember(
+        HostAndPort("h2"), "rs0", MemberState::RS_PRIMARY, OpTime(Timestamp(8, 0), 0));
+    ASSERT_EQUALS(1, getCurrentPrimaryIndex());
+    reference = getTopoCoord().getReplicationLagReferenceOpTimeAndWallTime();
+    ASSERT(reference);
+    ASSERT_EQUALS(OpTime(Timestamp(8, 0), 0), reference->opTime);
+    ASSERT_EQUALS(Date_t() + Seconds(8), reference->wallTime);
+}
+
+TEST_F(TopoCoordTest, NoReplicationLagReferenceWhenPrimary) {
+    updateConfig(BSON("_id"
+                      << "rs0"
+                      << "version" << 1 << "members"
+                      << BSON_ARRAY(BSON("_id" << 10 << "host"
+                                               << "hself")
+                                    << BSON("_id" << 20 << "host"
+                                                  << "h2"))),
+                 0);
+    makeSelfPrimary();
+    heartbeatFromMember(
+        HostAndPort("h2"), "rs0", MemberState::RS_SECONDARY, OpTime(Timestamp(5, 0), 0));
+    ASSERT_FALSE(getTopoCoord().getReplicationLagReferenceOpTimeAndWallTime());
+}
+
 TEST_F(TopoCoordTest, ReplSetGetStatus) {
     // This test starts by configuring a TopologyCoordinator as a member of a 4 node replica
     // set, with each node in a different state.
@@ -4768,6 +4829,51 @@ TEST_F(ReevalSyncSourceTest, NoChangeWhenChangedTooManyTimesRecently) {
                                                                     ReadPreference::Nearest));
 }
 
+TEST_F(ReevalSyncSourceTest, CountChurnBackoffWindows) {
+    auto getNumChurnBackoffWindows = [] {
+        BSONObjBuilder builder;
+        globalMetricTree()->appendTo(builder);
+        return builder.obj()
+            .getFieldDotted("metrics.repl.syncSource.numChurnBackoffWindows")
+            .numberLong();
+    };
+
+    getTopoCoord().setPing_forTest(HostAndPort("host2"), pingTime);
+    getTopoCoord().setPing_forTest(HostAndPort("host3"), significantlyCloserPingTime);
+
+    auto shouldChangeSyncSource = [&](Date_t when) {
+        return getTopoCoord().shouldChangeSyncSourceDueToPingTime(HostAndPort("host2"),
+                                                                  MemberState::RS_SECONDARY,
+                                                                  lastOpTimeFetched,
+                                                                  when,
+                                                                  ReadPreference::Nearest);
+    };
+
+    auto recentSyncSourceChanges = getTopoCoord().getRecentSyncSourceChanges_forTest();
+    auto first = now();
+    recentSyncSourceChanges->addNewEntry(first);
+    recentSyncSourceChanges->addNewEntry(first);
+    recentSyncSourceChanges->addNewEntry(first);
+
+    // Only entering the backoff window is counted, however many re-evaluations it skips.
+    const auto initial = getNumChurnBackoffWindows();
+    ASSERT_FALSE(shouldChangeSyncSource(first));
+    ASSERT_FALSE(shouldChangeSyncSource(first + Minutes(1)));
+    ASSERT_EQUALS(initial + 1, getNumChurnBackoffWindows());
+
+    // Once the changes are older than an hour the window ends, and entering a new one counts again.
+    // Whether the node then changes sync sources does not matter here.
+    auto second = first + Hours(1) + Minutes(1);
+    shouldChangeSyncSource(second);
+    ASSERT_EQUALS(initial + 1, getNumChurnBackoffWindows());
+    recentSyncSourceChanges->addNewEntry(second);
+    recentSyncSourceChanges->addNewEntry(second);
+    recentSyncSourceChanges->addNewEntry(second);
+    ASSERT_FALSE(shouldChangeSyncSource(second));
+    ASSERT_FALSE(shouldChangeSyncSource(second + Minutes(1)));
+    ASSERT_EQUALS(initial + 2, getNumChurnBackoffWindows());
+}
+
 TEST_F(ReevalSyncSourceTest, ChangeWhenHaveNotChangedTooManyTimesRecently) {
     getTopoCoord().setPing_forTest(HostAndPort("host2"), pingTime);
     getTopoCoord().setPing_forTest(HostAndPort("host3"), significantlyCloserPingTime);
@@ -4879,6 +4985,128 @@ TEST_F(ReevalSyncSourceTest, NoChangeWhenSyncSourceForcedByFailPoint) {
                                                                     ReadPreference::Nearest));
 }
 
+TEST_F(ReevalSyncSourceTest, ChangeWhenEquallyCloseNodeServesFewerMembers) {
+    RAIIServerParameterControllerForTest loadAware{"enableLoadAwareSyncSourceSelection", true};
+    RAIIServerParameterControllerForTest imbalance{"syncSourceLoadImbalanceThreshold", 1};
+
+    // host3 syncs from host2, so host2 serves one more member than host3 does.
+    receiveUpHeartbeat(HostAndPort("host3"),
+                       "rs0",
+                       MemberState::RS_SECONDARY,
+                       election,
+                       syncSourceOpTime,
+                       HostAndPort("host2"));
+    getTopoCoord().setPing_forTest(HostAndPort("host2"), pingTime);
+    getTopoCoord().setPing_forTest(HostAndPort("host3"), slightlyFurtherPingTime);
+
+    ASSERT_TRUE(getTopoCoord().shouldChangeSyncSourceDueToLoad(HostAndPort("host2"),
+                                                               MemberState::RS_SECONDARY,
+                                                               lastOpTimeFetched,
+                                                               now(),
+                                                               ReadPreference::Nearest));
+
+    // Without load-aware selection, the same situation is not a reason to change.
+    RAIIServerParameterControllerForTest loadAwareOff{"enableLoadAwareSyncSourceSelection", false};
+    ASSERT_FALSE(getTopoCoord().shouldChangeSyncSourceDueToLoad(HostAndPort("host2"),
+                                                                MemberState::RS_SECONDARY,
+                                                                lastOpTimeFetched,
+                                                                now(),
+                                                                ReadPreference::Nearest));
+}
+
+TEST_F(ReevalSyncSourceTest, NoChangeDueToLoadWhenImbalanceBelowThreshold) {
+    RAIIServerParameterControllerForTest loadAware{"enableLoadAwareSyncSourceSelection", true};
+    RAIIServerParameterControllerForTest imbalance{"syncSourceLoadImbalanceThreshold", 2};
+
+    receiveUpHeartbeat(HostAndPort("host3"),
+                       "rs0",
+                       MemberState::RS_SECONDARY,
+                       election,
+                       syncSourceOpTime,
+                       HostAndPort("host2"));
+    getTopoCoord().setPing_forTest(HostAndPort("host2"), pingTime);
+    getTopoCoord().setPing_forTest(HostAndPort("host3"), pingTime);
+
+    ASSERT_FALSE(getTopoCoord().shouldChangeSyncSourceDueToLoad(HostAndPort("host2"),
+                                                                MemberState::RS_SECONDARY,
+                                                                lastOpTimeFetched,
+                                                                now(),
+                                                                ReadPreference::Nearest));
+}
+
+TEST_F(ReevalSyncSourceTest, NoChangeDueToLoadWhenLessLoadedNodeIsInAnotherDataCenter) {
+    RAIIServerParameterControllerForTest loadAware{"enableLoadAwareSyncSourceSelection", true};
+    RAIIServerParameterControllerForTest imbalance{"syncSourceLoadImbalanceThreshold", 1};
+
+    receiveUpHeartbeat(HostAndPort("host3"),
+                       "rs0",
+                       MemberState::RS_SECONDARY,
+                       election,
+                       syncSourceOpTime,
+                       HostAndPort("host2"));
+    getTopoCoord().setPing_forTest(HostAndPort("host2"), significantlyCloserPingTime);
+    getTopoCoord().setPing_forTest(HostAndPort("host3"), slightlyFurtherPingTime);
+
+    ASSERT_FALSE(getTopoCoord().shouldChangeSyncSourceDueToLoad(HostAndPort("host2"),
+                                                                MemberState::RS_SECONDARY,
+                                                                lastOpTimeFetched,
+                                                                now(),
+                                                                ReadPreference::Nearest));
+}
+
+TEST_F(TopoCoordTest, LoadAwareSelectionPrefersLessLoadedNodeInSameDataCenter) {
+    updateConfig(BSON("_id"
+                      << "rs0"
+                      << "version" << 1 << "members"
+                      << BSON_ARRAY(BSON("_id" << 10 << "host"
+                                               << "hself")
+                                    << BSON("_id" << 20 << "host"
+                                                  << "h2")
+                                    << BSON("_id" << 30 << "host"
+                                                  << "h3")
+                                    << BSON("_id" << 40 << "host"
+                                                  << "h4")
+                                    << BSON("_id" << 50 << "host"
+                                                  << "h5"))),
+                 0);
+    setSelfMemberState(MemberState::RS_SECONDARY);
+
+    // h2 and h3 are close to us, and h4 and h5 in another data center both sync from h2.
+    const OpTime lastApplied(Timestamp(1, 0), 0);
+    for (int i = 0; i < 2; ++i) {
+        receiveUpHeartbeat(HostAndPort("h2"),
+                           "rs0",
+                           MemberState::RS_SECONDARY,
+                           OpTime(),
+                           lastApplied,
+                           HostAndPort(),
+                           Milliseconds(1));
+        receiveUpHeartbeat(HostAndPort("h3"),
+                           "rs0",
+                           MemberState::RS_SECONDARY,
+                           OpTime(),
+                           lastApplied,
+                           HostAndPort(),
+                           Milliseconds(3));
+        for (auto member : {"h4", "h5"}) {
+            receiveUpHeartbeat(HostAndPort(member),
+                               "rs0",
+                               MemberState::RS_SECONDARY,
+                               OpTime(),
+                               lastApplied,
+                               HostAndPort("h2"),
+                               Milliseconds(100));
+        }
+    }
+
+    getTopoCoord().chooseNewSyncSource(now()++, OpTime(), ReadPreference::Nearest);
+    ASSERT_EQUALS(HostAndPort("h2"), getTopoCoord().getSyncSourceAddress());
+
+    RAIIServerParameterControllerForTest loadAware{"enableLoadAwareSyncSourceSelection", true};
+    getTopoCoord().chooseNewSyncSource(now()++, OpTime(), ReadPreference::Nearest);
+    ASSERT_EQUALS(HostAndPort("h3"), getTopoCoord().getSyncSourceAddress());
+}
+
 class HeartbeatResponseReconfigTestV1 : public TopoCoordTest {
 public:
     virtual void setUp() {
@@ -151,6 +151,42 @@ BENCHMARK(BM_IncrementalRefreshOfPessimalBalancedDistribution)
     ->Args({2, 250000})
     ->Args({2, 500000});
 
+/**
+ * Simulates the refresh which follows a single migration in the middle of the key space of a
+ * collection with many chunks: the migrated chunk moves to the donor's neighbour and the donor
+ * bumps the version of one of the chunks it still owns.
+ */
+void BM_IncrementalRefreshAfterMigration(benchmark::State& state) {
+    const int nShards = state.range(0);
+    const int nChunks = state.range(1);
+    auto metadata = makeChunkManagerWithOptimalBalancedDistribution(nShards, nChunks);
+
+    const int migratedChunk = nChunks / 2;
+    const auto donor = optimalShardSelector(migratedChunk, nShards, nChunks);
+    const auto recipient = ShardId(donor == ShardId("shard0") ? "shard1" : "shard0");
+
+    auto postMoveVersion = metadata.getChunkManager()->getVersion();
+    const UUID uuid = metadata.getUUID();
+    std::vector<ChunkType> newChunks;
+    postMoveVersion.incMajor();
+    newChunks.emplace_back(
+        uuid, getRangeForChunk(migratedChunk, nChunks), postMoveVersion, recipient);
+    postMoveVersion.incMinor();
+    newChunks.emplace_back(
+        uuid, getRangeForChunk(migratedChunk + 1, nChunks), postMoveVersion, donor);
+
+    for (auto keepRunning : state) {
+        benchmark::DoNotOptimize(runIncrementalUpdate(metadata, newChunks));
+    }
+}
+
+BENCHMARK(BM_IncrementalRefreshAfterMigration)
+    ->Args({2, 50000})
+    ->Args({2, 250000})
+    ->Args({2, 500000})
+    ->Args({64, 500000})
+    ->Args({64, 1000000});
+
 template <typename ShardSelectorFn>
 auto BM_FullBuildOfChunkManager(benchmark::State& state, ShardSelectorFn selectShard) {
     const int nShards = state.range(0);
@@ -358,10 +358,25 @@ Status MigrationChunkClonerSource::startClone(OperationContext* opCtx,
         opCtx->recoveryUnit()->setPrepareConflictBehavior(
             PrepareConflictBehavior::kIgnoreConflicts);
 
-        auto storeCurrentRecordIdStatus = _storeCurrentRecordId(opCtx);
+        std::vector<BSONObj> jumboSubRangeBounds;
+        auto storeCurrentRecordIdStatus = _storeCurrentRecordId(opCtx, &jumboSubRangeBounds);
         if (storeCurrentRecordIdStatus == ErrorCodes::ChunkTooBig && _forceJumbo) {
             stdx::lock_guard<Latch> sl(_mutex);
             _jumboChunkCloneState.emplace();
+
+            auto& subRanges = _jumboChunkCloneState->subRanges;
+            subRanges.resize(jumboSubRangeBounds.size() + 1);
+            for (size_t i = 0; i < jumboSubRangeBounds.size(); ++i) {
+                subRanges[i].max = jumboSubRangeBounds[i];
+                subRanges[i + 1].min = jumboSubRangeBounds[i];
+            }
+
+            LOGV2(9393400,
+                  "Cloning jumbo chunk through concurrent index scans",
+                  logAttrs(nss()),
+                  "min"_attr = getMin(),
+                  "max"_attr = getMax(),
+                  "numSubRanges"_attr = subRanges.size());
         } else if (!storeCurrentRecordIdStatus.isOK()) {
             return storeCurrentRecordIdStatus;
         }
@@ -437,7 +452,7 @@ StatusWith<BSONObj> MigrationChunkClonerSource::commitClone(OperationContext* op
                 return status;
             }
         } else {
-            invariant(PlanExecutor::IS_EOF == _jumboChunkCloneState->clonerState);
+            invariant(_jumboChunkCloneState->isEOF());
             invariant(!_cloneList.hasMore());
         }
     }
@@ -684,13 +699,40 @@ void MigrationChunkClonerSource::_nextCloneBatchFromIndexScan(OperationContext*
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
-    if (!_jumboChunkCloneState->clonerExec) {
-        auto exec = uassertStatusOK(_getIndexScanExecutor(
-            opCtx, collection, InternalPlanner::IndexScanOptions::IXSCAN_FETCH));
-        _jumboChunkCloneState->clonerExec = std::move(exec);
+    // Claim a sub-range which is neither exhausted nor being read by a concurrent _migrateClone
+    // request. Returning an empty batch when there is none is safe, because whoever holds the
+    // remaining sub-ranges will keep returning their documents until they are all exhausted.
+    JumboChunkCloneState::SubRange* subRange = nullptr;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        for (auto& candidate : _jumboChunkCloneState->subRanges) {
+            if (!candidate.inUse && candidate.clonerState != PlanExecutor::IS_EOF) {
+                candidate.inUse = true;
+                subRange = &candidate;
+                break;
+            }
+        }
+    }
+
+    if (!subRange) {
+        return;
+    }
+
+    ON_BLOCK_EXIT([&] {
+        stdx::lock_guard<Latch> lk(_mutex);
+        subRange->inUse = false;
+    });
+
+    if (!subRange->clonerExec) {
+        subRange->clonerExec = uassertStatusOK(
+            _getIndexScanExecutor(opCtx,
+                                  collection,
+                                  InternalPlanner::IndexScanOptions::IXSCAN_FETCH,
+                                  subRange->min,
+                                  subRange->max));
     } else {
-        _jumboChunkCloneState->clonerExec->reattachToOperationContext(opCtx);
-        _jumboChunkCloneState->clonerExec->restoreState(&collection);
+        subRange->clonerExec->reattachToOperationContext(opCtx);
+        subRange->clonerExec->restoreState(&collection);
     }
 
     PlanExecutor::ExecState execState;
@@ -698,10 +740,10 @@ void MigrationChunkClonerSource::_nextCloneBatchFromIndexScan(OperationContext*
         BSONObj obj;
         RecordId recordId;
         while (PlanExecutor::ADVANCED ==
-               (execState = _jumboChunkCloneState->clonerExec->getNext(&obj, nullptr))) {
+               (execState = subRange->clonerExec->getNext(&obj, nullptr))) {
 
             stdx::unique_lock<Latch> lk(_mutex);
-            _jumboChunkCloneState->clonerState = execState;
+            subRange->clonerState = execState;
             lk.unlock();
 
             opCtx->checkForInterrupt();
@@ -710,7 +752,7 @@ void MigrationChunkClonerSource::_nextCloneBatchFromIndexScan(OperationContext*
             // that we take into consideration the overhead of BSONArray indices.
             if (arrBuilder->arrSize() &&
                 (arrBuilder->len() + obj.objsize() + 1024) > BSONObjMaxUserSize) {
-                _jumboChunkCloneState->clonerExec->stashResult(obj);
+                subRange->clonerExec->stashResult(obj);
                 break;
             }
 
@@ -729,11 +771,11 @@ void MigrationChunkClonerSource::_nextCloneBatchFromIndexScan(OperationContext*
     }
 
     stdx::unique_lock<Latch> lk(_mutex);
-    _jumboChunkCloneState->clonerState = execState;
+    subRange->clonerState = execState;
     lk.unlock();
 
-    _jumboChunkCloneState->clonerExec->saveState();
-    _jumboChunkCloneState->clonerExec->detachFromOperationContext();
+    subRange->clonerExec->saveState();
+    subRange->clonerExec->detachFromOperationContext();
 }
 
 void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationContext* opCtx,
@@ -743,9 +785,15 @@ void MigrationChunkClonerSource::_nextCloneBatchFromCloneRecordIds(OperationCont
                            internalQueryExecYieldIterations.load(),
                            Milliseconds(internalQueryExecYieldPeriodMS.load()));
 
+    // Keep reading from the same RecordId sub-range for the whole batch, so that concurrent
+    // _migrateClone requests each walk their own region of the collection.
+    size_t subRange = CloneList::kNoSubRange;
+    ON_BLOCK_EXIT([&] { _cloneList.releaseSubRange(subRange); });
+
     while (true) {
         int recordsNoLongerExist = 0;
-        auto docInFlight = _cloneList.getNextDoc(opCtx, collection, &recordsNoLongerExist);
+        auto docInFlight =
+            _cloneList.getNextDoc(opCtx, collection, &recordsNoLongerExist, &subRange);
 
         if (recordsNoLongerExist) {
             stdx::lock_guard lk(_mutex);
@@ -1004,7 +1052,9 @@ StatusWith<BSONObj> MigrationChunkClonerSource::_callRecipient(OperationContext*
 StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>>
 MigrationChunkClonerSource::_getIndexScanExecutor(OperationContext* opCtx,
                                                   const CollectionPtr& collection,
-                                                  InternalPlanner::IndexScanOptions scanOption) {
+                                                  InternalPlanner::IndexScanOptions scanOption,
+                                                  const BSONObj& subRangeMin,
+                                                  const BSONObj& subRangeMax) {
     // Allow multiKey based on the invariant that shard keys must be single-valued. Therefore, any
     // multi-key index prefixed by shard key cannot be multikey over the shard key fields.
     const auto shardKeyIdx = findShardKeyPrefixedIndex(opCtx,
@@ -1020,8 +1070,12 @@ MigrationChunkClonerSource::_getIndexScanExecutor(OperationContext* opCtx,
     // Assume both min and max non-empty, append MinKey's to make them fit chosen index
     const KeyPattern kp(shardKeyIdx->keyPattern());
 
-    BSONObj min = Helpers::toKeyFormat(kp.extendRangeBound(getMin(), false));
-    BSONObj max = Helpers::toKeyFormat(kp.extendRangeBound(getMax(), false));
+    BSONObj min = subRangeMin.isEmpty()
+        ? Helpers::toKeyFormat(kp.extendRangeBound(getMin(), false))
+        : subRangeMin;
+    BSONObj max = subRangeMax.isEmpty()
+        ? Helpers::toKeyFormat(kp.extendRangeBound(getMax(), false))
+        : subRangeMax;
 
     // We can afford to yield here because any change to the base data that we might miss is already
     // being queued and will migrate in the 'transferMods' stage.
@@ -1036,7 +1090,8 @@ MigrationChunkClonerSource::_getIndexScanExecutor(OperationContext* opCtx,
                                               scanOption);
 }
 
-Status MigrationChunkClonerSource::_storeCurrentRecordId(OperationContext* opCtx) {
+Status MigrationChunkClonerSource::_storeCurrentRecordId(
+    OperationContext* opCtx, std::vector<BSONObj>* jumboSubRangeBounds) {
     AutoGetCollection collection(opCtx, nss(), MODE_IS);
     if (!collection) {
         return {ErrorCodes::NamespaceNotFound,
@@ -1073,6 +1128,25 @@ Status MigrationChunkClonerSource::_storeCurrentRecordId(OperationContext* opCtx
         maxRecsWhenFull = kMaxObjectPerChunk + 1;
     }
 
+    // The initial clone is split into as many sub-ranges as the recipient sends _migrateClone
+    // requests in parallel.
+    const size_t numSubRanges = std::max(chunkMigrationConcurrency.load(), 1);
+
+    // A jumbo chunk is cloned by scanning the shard key index rather than from the recorded ids.
+    // To split that scan into sub-ranges, keep sampling the index keys at a stride which doubles
+    // every time the samples fill up, so that they stay evenly spread over the keys scanned. The
+    // scan stops after as many keys as 'numSubRanges' full chunks would hold, so that it stays
+    // bounded however large the chunk is. This is a limit on the sampling, not only on its cost:
+    // the keys beyond it are not sampled at all, so the last sub-range covers all of them and the
+    // sub-ranges are only even for chunks up to that size. The keys are only usable as scan bounds
+    // when they are returned in index key format, which is not the case for the clustered index.
+    const bool sampleJumboSubRangeBounds =
+        _forceJumbo && numSubRanges > 1 && !collection->isClustered();
+    const size_t maxBoundSamples = 2 * numSubRanges;
+    const unsigned long long maxBoundSamplingRecs = numSubRanges * maxRecsWhenFull;
+    std::vector<BSONObj> boundSamples;
+    unsigned long long boundSamplingStride = 1;
+
     // Do a full traversal of the chunk and don't stop even if we think it is a large chunk we want
     // the number of records to better report, in that case.
     bool isLargeChunk = false;
@@ -1093,17 +1167,44 @@ Status MigrationChunkClonerSource::_storeCurrentRecordId(OperationContext* opCtx
                 recordIdSet.insert(recordId);
             }
 
+            if (sampleJumboSubRangeBounds && recCount % boundSamplingStride == 0) {
+                if (boundSamples.size() == maxBoundSamples) {
+                    for (size_t i = 0; i < maxBoundSamples / 2; ++i) {
+                        boundSamples[i] = std::move(boundSamples[2 * i]);
+                    }
+                    boundSamples.resize(maxBoundSamples / 2);
+                    boundSamplingStride *= 2;
+                }
+
+                if (recCount % boundSamplingStride == 0) {
+                    boundSamples.push_back(obj.getOwned());
+                }
+            }
+
             if (++recCount > maxRecsWhenFull) {
                 isLargeChunk = true;
 
                 if (_forceJumbo) {
                     recordIdSet.clear();
-                    break;
+                    if (!sampleJumboSubRangeBounds) {
+                        break;
+                    }
+                    if (recCount >= maxBoundSamplingRecs) {
+                        LOGV2(9393401,
+                              "Sampled the bounds of the jumbo chunk sub-ranges from its first "
+                              "documents only, the last sub-range covers all the following ones",
+                              logAttrs(nss()),
+                              "min"_attr = getMin(),
+                              "max"_attr = getMax(),
+                              "numSubRanges"_attr = numSubRanges,
+                              "numSampledDocuments"_attr = recCount);
+                        break;
+                    }
                 }
             }
         }
 
-        _cloneList.populateList(std::move(recordIdSet));
+        _cloneList.populateList(std::move(recordIdSet), numSubRanges);
     } catch (DBException& exception) {
         exception.addContext("Executor error while scanning for documents belonging to chunk");
         throw;
@@ -1128,6 +1229,17 @@ Status MigrationChunkClonerSource::_storeCurrentRecordId(OperationContext* opCtx
     }
 
     if (isLargeChunk) {
+        // Pick evenly spaced samples as the sub-range bounds, skipping the first one since it is
+        // the smallest key in the chunk. Keys may repeat when the shard key is not unique.
+        for (size_t i = 1; sampleJumboSubRangeBounds && i < numSubRanges; ++i) {
+            const auto& bound = boundSamples[i * boundSamples.size() / numSubRanges];
+            const auto& prevBound =
+                jumboSubRangeBounds->empty() ? boundSamples.front() : jumboSubRangeBounds->back();
+            if (bound.woCompare(prevBound) != 0) {
+                jumboSubRangeBounds->push_back(bound);
+            }
+        }
+
         return {
             ErrorCodes::ChunkTooBig,
             str::stream() << "Cannot move chunk: the maximum number of documents for a chunk is "
@@ -1234,8 +1346,7 @@ Status MigrationChunkClonerSource::_checkRecipientCloningStatus(OperationContext
         if (res["state"].String() == "steady" && sessionCatalogSourceInCatchupPhase &&
             estimateUntransferredSessionsSize == 0) {
             if (_cloneList.hasMore() ||
-                (_jumboChunkCloneState && _forceJumbo &&
-                 PlanExecutor::IS_EOF != _jumboChunkCloneState->clonerState)) {
+                (_jumboChunkCloneState && _forceJumbo && !_jumboChunkCloneState->isEOF())) {
                 return {ErrorCodes::OperationIncomplete,
                         str::stream() << "Unable to enter critical section because the recipient "
                                          "shard thinks all data is cloned while there are still "
@@ -1442,14 +1553,23 @@ MigrationChunkClonerSource::CloneList::InProgressReadToken::~InProgressReadToken
     _cloneList._finishedOneInProgressRead();
 }
 
-MigrationChunkClonerSource::CloneList::CloneList() {
-    _recordIdsIter = _recordIds.begin();
-}
-
-void MigrationChunkClonerSource::CloneList::populateList(RecordIdSet recordIds) {
+void MigrationChunkClonerSource::CloneList::populateList(RecordIdSet recordIds,
+                                                         size_t numSubRanges) {
     stdx::lock_guard lk(_mutex);
     _recordIds = std::move(recordIds);
-    _recordIdsIter = _recordIds.begin();
+
+    const size_t total = _recordIds.size();
+    numSubRanges = std::max<size_t>(std::min(numSubRanges, total), 1);
+
+    _subRanges.clear();
+    _subRanges.reserve(numSubRanges);
+    auto it = _recordIds.begin();
+    for (size_t i = 0; i < numSubRanges; ++i) {
+        const size_t count = total / numSubRanges + (i < total % numSubRanges ? 1 : 0);
+        auto begin = it;
+        std::advance(it, count);
+        _subRanges.push_back({begin, it, count});
+    }
 }
 
 void MigrationChunkClonerSource::CloneList::insertOverflowDoc(Snapshotted<BSONObj> doc) {
@@ -1460,38 +1580,40 @@ void MigrationChunkClonerSource::CloneList::insertOverflowDoc(Snapshotted<BSONOb
 
 bool MigrationChunkClonerSource::CloneList::hasMore() const {
     stdx::lock_guard lk(_mutex);
-    return _recordIdsIter != _recordIds.cend() && _inProgressReads > 0;
+    return _hasRemainingRecordIds(lk) && _inProgressReads > 0;
 }
 
 std::unique_ptr<MigrationChunkClonerSource::CloneList::DocumentInFlightWhileNotInLock>
 MigrationChunkClonerSource::CloneList::getNextDoc(OperationContext* opCtx,
                                                   const CollectionPtr& collection,
-                                                  int* numRecordsNoLongerExist) {
+                                                  int* numRecordsNoLongerExist,
+                                                  size_t* subRange) {
     while (true) {
         stdx::unique_lock lk(_mutex);
         invariant(_inProgressReads >= 0);
         RecordId nextRecordId;
 
         opCtx->waitForConditionOrInterrupt(_moreDocsCV, lk, [&]() {
-            return _recordIdsIter != _recordIds.end() || !_overflowDocs.empty() ||
-                _inProgressReads == 0;
+            return _hasRemainingRecordIds(lk) || !_overflowDocs.empty() || _inProgressReads == 0;
         });
 
         DocumentInFlightWithLock docInFlight(lk, *this);
 
         // One of the following must now be true (corresponding to the three if conditions):
         //   1.  There is a document in the overflow set
-        //   2.  The iterator has not reached the end of the record id set
-        //   3.  The overflow set is empty, the iterator is at the end, and
+        //   2.  Some sub-range iterator has not reached the end of its record ids
+        //   3.  The overflow set is empty, all the iterators are at their end, and
         //       no threads are holding a document.  This condition indicates
         //       that there are no more docs to return for the cloning phase.
         if (!_overflowDocs.empty()) {
             docInFlight.setDoc(std::move(_overflowDocs.front()));
             _overflowDocs.pop_front();
             return docInFlight.release();
-        } else if (_recordIdsIter != _recordIds.end()) {
-            nextRecordId = *_recordIdsIter;
-            ++_recordIdsIter;
+        } else if (auto subRangeIdx = _pickSubRange(lk, subRange)) {
+            auto& nextSubRange = _subRanges[*subRangeIdx];
+            nextRecordId = *nextSubRange.next;
+            ++nextSubRange.next;
+            --nextSubRange.remaining;
         } else {
             return docInFlight.release();
         }
@@ -1512,6 +1634,57 @@ MigrationChunkClonerSource::CloneList::getNextDoc(OperationContext* opCtx,
     }
 }
 
+void MigrationChunkClonerSource::CloneList::releaseSubRange(size_t subRange) {
+    if (subRange == kNoSubRange) {
+        return;
+    }
+
+    stdx::lock_guard lk(_mutex);
+    invariant(_subRanges[subRange].activeReaders > 0);
+    _subRanges[subRange].activeReaders--;
+}
+
+bool MigrationChunkClonerSource::CloneList::_hasRemainingRecordIds(WithLock) const {
+    return std::any_of(_subRanges.begin(), _subRanges.end(), [](const auto& subRange) {
+        return subRange.remaining > 0;
+    });
+}
+
+boost::optional<size_t> MigrationChunkClonerSource::CloneList::_pickSubRange(WithLock,
+                                                                            size_t* subRange) {
+    if (subRange && *subRange != kNoSubRange && _subRanges[*subRange].remaining > 0) {
+        return *subRange;
+    }
+
+    // Move on to the sub-range with the fewest readers, preferring the one with the most record
+    // ids left so that all the sub-ranges tend to run out at the same time.
+    boost::optional<size_t> best;
+    for (size_t i = 0; i < _subRanges.size(); ++i) {
+        const auto& candidate = _subRanges[i];
+        if (candidate.remaining == 0) {
+            continue;
+        }
+
+        if (!best || candidate.activeReaders < _subRanges[*best].activeReaders ||
+            (candidate.activeReaders == _subRanges[*best].activeReaders &&
+             candidate.remaining > _subRanges[*best].remaining)) {
+            best = i;
+        }
+    }
+
+    if (subRange) {
+        if (*subRange != kNoSubRange) {
+            _subRanges[*subRange].activeReaders--;
+        }
+        if (best) {
+            _subRanges[*best].activeReaders++;
+        }
+        *subRange = best.value_or(kNoSubRange);
+    }
+
+    return best;
+}
+
 size_t MigrationChunkClonerSource::CloneList::size() const {
     stdx::unique_lock lk(_mutex);
     return _recordIds.size();
@@ -29,11 +29,14 @@
 
 #pragma once
 
+#include <algorithm>
 #include <deque>
+#include <limits>
 #include <list>
 #include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/client/connection_string.h"
@@ -390,12 +393,17 @@ private:
             boost::optional<Snapshotted<BSONObj>> _doc;
         };
 
-        CloneList();
+        // Marks a caller of getNextDoc which does not currently hold a claimed sub-range.
+        static constexpr size_t kNoSubRange = std::numeric_limits<size_t>::max();
+
+        CloneList() = default;
 
         /**
-         * Overwrites the list of record ids to clone.
+         * Overwrites the list of record ids to clone and splits it into 'numSubRanges' contiguous
+         * sub-ranges of roughly equal size, so that concurrent _migrateClone requests can each
+         * read a disjoint region of the collection in RecordId order.
          */
-        void populateList(RecordIdSet recordIds);
+        void populateList(RecordIdSet recordIds, size_t numSubRanges = 1);
 
         /**
          * Returns a document to clone. If there are no more documents left to clone,
@@ -404,10 +412,21 @@ private:
          * numRecordsNoLonger exists is an optional parameter that can be used to track
          * the number of recordIds encountered that refers to a document that no longer
          * exists.
+         *
+         * If 'subRange' is given, record ids are served from the sub-range it designates for as
+         * long as that sub-range has any left. Once it is exhausted (or if it is kNoSubRange), the
+         * least contended remaining sub-range is claimed on behalf of the caller and 'subRange' is
+         * updated to point to it. A claimed sub-range must be handed back with releaseSubRange().
          */
         std::unique_ptr<DocumentInFlightWhileNotInLock> getNextDoc(OperationContext* opCtx,
                                                                    const CollectionPtr& collection,
-                                                                   int* numRecordsNoLongerExist);
+                                                                   int* numRecordsNoLongerExist,
+                                                                   size_t* subRange = nullptr);
+
+        /**
+         * Gives back a sub-range previously claimed through getNextDoc. No-op for kNoSubRange.
+         */
+        void releaseSubRange(size_t subRange);
 
         /**
          * Put back a document previously obtained from this CloneList instance to the overflow
@@ -436,21 +455,35 @@ private:
          */
         void _finishedOneInProgressRead();
 
+        /**
+         * Returns true if any sub-range still has record ids which were not handed out.
+         */
+        bool _hasRemainingRecordIds(WithLock) const;
+
+        /**
+         * Returns the sub-range the next record id should be read from on behalf of a caller
+         * currently holding 'subRange' (see getNextDoc), or boost::none if all record ids were
+         * handed out.
+         */
+        boost::optional<size_t> _pickSubRange(WithLock, size_t* subRange);
+
         mutable Mutex _mutex = MONGO_MAKE_LATCH("MigrationChunkClonerSource::CloneList::_mutex");
 
         RecordIdSet _recordIds;
 
-        // This iterator is a pointer into the _recordIds set.  It allows concurrent access to
-        // the _recordIds set by allowing threads servicing _migrateClone requests to do the
+        // A contiguous slice of the _recordIds set. The 'next' iterator allows concurrent access
+        // to the _recordIds set by allowing threads servicing _migrateClone requests to do the
         // following:
         //   1.  Acquire mutex "_mutex" above.
-        //   2.  Copy *_recordIdsIter into its local stack frame.
-        //   3.  Increment _recordIdsIter
+        //   2.  Copy *next of the sub-range they claimed into its local stack frame.
+        //   3.  Increment next.
         //   4.  Unlock "_mutex."
         //   5.  Do the I/O to fetch the document corresponding to this record Id.
         //
         // The purpose of this algorithm, is to allow different threads to concurrently start I/O
-        // jobs in order to more fully saturate the disk.
+        // jobs in order to more fully saturate the disk. Splitting the set into sub-ranges keeps
+        // each of those threads reading a region of the collection in RecordId order rather than
+        // interleaving with the others over the same records.
         //
         // One issue with this algorithm, is that only 16MB worth of documents can be returned in
         // response to a _migrateClone request.  But, the thread does not know the size of a
@@ -458,7 +491,17 @@ private:
         // response to _migrateClone request the document must be made available to a different
         // thread servicing a _migrateClone request. To solve this problem, the thread adds the
         // document to the below _overflowDocs deque.
-        RecordIdSet::iterator _recordIdsIter;
+        struct RecordIdSubRange {
+            RecordIdSet::iterator next;
+            RecordIdSet::iterator end;
+
+            // Number of record ids in [next, end).
+            size_t remaining;
+
+            // Number of _migrateClone requests currently reading from this sub-range.
+            size_t activeReaders{0};
+        };
+        std::vector<RecordIdSubRange> _subRanges;
 
         // This deque stores all documents that must be sent to the destination, but could not fit
         // in the response to a particular _migrateClone request.
@@ -470,8 +513,8 @@ private:
         // This integer is necessary because it gives us a condition on when all documents to be
         // sent to the destination have been exhausted.
         //
-        // If (_recordIdsIter == _recordIds.end() && _overflowDocs.empty() &&
-        //     _inProgressReads == 0) then all documents have been returned to the destination.
+        // If (!_hasRemainingRecordIds() && _overflowDocs.empty() && _inProgressReads == 0) then
+        // all documents have been returned to the destination.
         RecordIdSet::size_type _inProgressReads = 0;
 
         // This condition variable allows us to wait on the following condition:
@@ -495,10 +538,17 @@ private:
      */
     StatusWith<BSONObj> _callRecipient(OperationContext* opCtx, const BSONObj& cmdObj);
 
+    /**
+     * Returns an executor scanning the shard key index over the migrated range. If 'subRangeMin'
+     * or 'subRangeMax' are non-empty, they are used (in index key format) in place of the
+     * corresponding chunk bound, which allows scanning only a sub-range of the chunk.
+     */
     StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> _getIndexScanExecutor(
         OperationContext* opCtx,
         const CollectionPtr& collection,
-        InternalPlanner::IndexScanOptions scanOption);
+        InternalPlanner::IndexScanOptions scanOption,
+        const BSONObj& subRangeMin = BSONObj(),
+        const BSONObj& subRangeMax = BSONObj());
 
     void _nextCloneBatchFromIndexScan(OperationContext* opCtx,
                                       const CollectionPtr& collection,
@@ -512,9 +562,17 @@ private:
      * Get the recordIds that belong to the chunk migrated and sort them in _cloneRecordIds (to
      * avoid seeking disk later).
      *
+     * If the chunk turns out to be too large and is going to be cloned through index scans, the
+     * shard key index keys splitting it into sub-ranges are returned in 'jumboSubRangeBounds' so
+     * that the sub-ranges can be scanned concurrently. The bounds are only sampled from the first
+     * keys of the chunk, as many as 'chunkMigrationConcurrency' full chunks would hold: the
+     * sub-ranges split those keys evenly, and the last one also covers every key beyond them. A
+     * jumbo chunk larger than that is therefore mostly cloned by the last sub-range.
+     *
      * Returns OK or any error status otherwise.
      */
-    Status _storeCurrentRecordId(OperationContext* opCtx);
+    Status _storeCurrentRecordId(OperationContext* opCtx,
+                                 std::vector<BSONObj>* jumboSubRangeBounds);
 
     /**
      * Adds the OpTime to the list of OpTimes for oplog entries that we should consider migrating as
@@ -669,11 +727,31 @@ private:
     // False if the move chunk request specified ForceJumbo::kDoNotForce, true otherwise.
     const bool _forceJumbo;
     struct JumboChunkCloneState {
-        // Plan executor for collection scan used to clone docs.
-        std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> clonerExec;
+        // A shard key sub-range of the jumbo chunk, scanned independently of the others. Empty
+        // bounds stand for the corresponding bound of the chunk.
+        struct SubRange {
+            BSONObj min;
+            BSONObj max;
+
+            // Plan executor for the index scan used to clone docs.
+            std::unique_ptr<PlanExecutor, PlanExecutor::Deleter> clonerExec;
+
+            // The current state of 'clonerExec'.
+            PlanExecutor::ExecState clonerState{PlanExecutor::ADVANCED};
+
+            // Whether a _migrateClone request is currently reading from 'clonerExec'.
+            bool inUse{false};
+        };
+
+        // Returns true once every sub-range has been scanned to completion.
+        bool isEOF() const {
+            return std::all_of(subRanges.begin(), subRanges.end(), [](const auto& subRange) {
+                return subRange.clonerState == PlanExecutor::IS_EOF;
+            });
+        }
 
-        // The current state of 'clonerExec'.
-        PlanExecutor::ExecState clonerState;
+        // Fixed once the chunk is found to be jumbo, always holds at least one element.
+        std::vector<SubRange> subRanges;
 
         // Number docs in jumbo chunk cloned so far
         int docsCloned = 0;
@@ -28,8 +28,26 @@
  */
 
 #include <benchmark/benchmark.h>
+#include <list>
+#include <vector>
 
+#include "mongo/client/remote_command_targeter_mock.h"
+#include "mongo/db/catalog/create_collection.h"
+#include "mongo/db/catalog_raii.h"
+#include "mongo/db/client.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/s/collection_sharding_runtime.h"
 #include "mongo/db/s/migration_chunk_cloner_source.h"
+#include "mongo/db/s/operation_sharding_state.h"
+#include "mongo/db/s/shard_server_test_fixture.h"
+#include "mongo/db/session/logical_session_id_helpers.h"
+#include "mongo/db/session/session_catalog_mongod.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/s/catalog/sharding_catalog_client_mock.h"
+#include "mongo/s/catalog/type_shard.h"
+#include "mongo/s/client/shard_registry.h"
+#include "mongo/stdx/thread.h"
 
 namespace mongo {
 namespace {
@@ -73,5 +91,275 @@ void BM_xferDeletes(benchmark::State& state) {
 
 BENCHMARK(BM_xferDeletes)->ArgsProduct({{0, 25, 50, 75, 100}, {1, 1024, 2048}});
 
+const NamespaceString kNss("TestDB", "TestColl");
+const std::string kShardKey = "X";
+const BSONObj kShardKeyPattern{BSON(kShardKey << 1)};
+const ConnectionString kDonorConnStr =
+    ConnectionString::forReplicaSet("Donor",
+                                    {HostAndPort("DonorHost1:1234"),
+                                     HostAndPort{"DonorHost2:1234"},
+                                     HostAndPort{"DonorHost3:1234"}});
+const ConnectionString kRecipientConnStr =
+    ConnectionString::forReplicaSet("Recipient",
+                                    {HostAndPort("RecipientHost1:1234"),
+                                     HostAndPort("RecipientHost2:1234"),
+                                     HostAndPort("RecipientHost3:1234")});
+
+// Reusing the ShardServerTestFixture to run the initial clone phase of a chunk migration through a
+// real MigrationChunkClonerSource, set up the same way as in
+// migration_chunk_cloner_source_legacy_test.cpp. _doTest has empty implementation to honor the
+// abstract class, but it is not used in the benchmark framework.
+class BenchmarkClonerSourceFixture : public ShardServerTestFixture {
+public:
+    BenchmarkClonerSourceFixture(int numDocs, int docSizeInBytes)
+        : ShardServerTestFixture(Options{}.useMockClock(true)) {
+        ShardServerTestFixture::setUp();
+
+        auto opCtx = operationContext();
+        DBDirectClient client(opCtx);
+        client.createCollection(NamespaceString::kSessionTransactionsTableNamespace);
+        client.createIndexes(NamespaceString::kSessionTransactionsTableNamespace,
+                             {MongoDSessionCatalog::getConfigTxnPartialIndexSpec()});
+
+        replicationCoordinator()->alwaysAllowWrites(true);
+
+        for (const auto& connStr : {kDonorConnStr, kRecipientConnStr}) {
+            auto shard = uassertStatusOK(shardRegistry()->getShard(opCtx, connStr.getSetName()));
+            RemoteCommandTargeterMock::get(shard->getTargeter())
+                ->setConnectionStringReturnValue(connStr);
+            RemoteCommandTargeterMock::get(shard->getTargeter())
+                ->setFindHostReturnValue(connStr.getServers()[0]);
+        }
+
+        _lsid = makeLogicalSessionId(opCtx);
+
+        _createShardedCollection(numDocs, docSizeInBytes);
+    }
+
+    ~BenchmarkClonerSourceFixture() {
+        ShardServerTestFixture::tearDown();
+    }
+
+    /**
+     * Starts the migration of the whole collection and serves the _migrateClone requests of
+     * 'numStreams' concurrent recipient threads until the initial clone is drained. Only the
+     * requests are timed, the scan of the record ids by startClone and the cancellation of the
+     * migration are not. Returns the number of bytes cloned.
+     */
+    long long runClone(benchmark::State& state, int numStreams) {
+        state.PauseTiming();
+        ShardsvrMoveRange req(kNss);
+        req.setEpoch(OID::gen());
+        req.setFromShard(ShardId(kDonorConnStr.getSetName()));
+        req.setMaxChunkSizeBytes(1024 * 1024 * 1024);
+        req.getMoveRangeRequestBase().setToShard(ShardId(kRecipientConnStr.getSetName()));
+        req.getMoveRangeRequestBase().setMin(BSON(kShardKey << MINKEY));
+        req.getMoveRangeRequestBase().setMax(BSON(kShardKey << MAXKEY));
+
+        MigrationChunkClonerSource cloner(operationContext(),
+                                          req,
+                                          WriteConcernOptions(),
+                                          kShardKeyPattern,
+                                          kDonorConnStr,
+                                          kRecipientConnStr.getServers()[0]);
+        _callRecipient([&] {
+            uassertStatusOK(cloner.startClone(operationContext(), UUID::gen(), _lsid, _txnNumber));
+        });
+        state.ResumeTiming();
+
+        AtomicWord<long long> bytesCloned{0};
+        std::vector<stdx::thread> threads;
+        for (int i = 0; i < numStreams; ++i) {
+            threads.emplace_back(
+                [&] { bytesCloned.fetchAndAdd(_runMigrateCloneRequests(cloner)); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        state.PauseTiming();
+        _callRecipient([&] { cloner.cancelClone(operationContext()); });
+        state.ResumeTiming();
+
+        return bytesCloned.load();
+    }
+
+private:
+    void _doTest() override{};
+
+    /**
+     * Runs 'fn', which sends a single command to the recipient, and acknowledges that command.
+     */
+    template <typename Fn>
+    void _callRecipient(Fn&& fn) {
+        auto future = launchAsync([&] {
+            onCommand([](const executor::RemoteCommandRequest& request) {
+                return BSON("ok" << true);
+            });
+        });
+        fn();
+        future.default_timed_get();
+    }
+
+    /**
+     * Sends _migrateClone requests from a recipient thread until one returns no documents, and
+     * returns the number of bytes received.
+     */
+    long long _runMigrateCloneRequests(MigrationChunkClonerSource& cloner) {
+        ThreadClient tc("migrateCloneRequests", getServiceContext());
+        auto opCtx = tc->makeOperationContext();
+
+        long long bytesCloned = 0;
+        while (true) {
+            // Fill the batch the same way the _migrateClone command does, until it stops growing.
+            boost::optional<BSONArrayBuilder> arrBuilder;
+            int arrSizeAtPrevIteration = -1;
+            while (!arrBuilder || arrBuilder->arrSize() > arrSizeAtPrevIteration) {
+                AutoGetCollection autoColl(opCtx.get(), kNss, MODE_IS);
+                if (!arrBuilder) {
+                    arrBuilder.emplace(cloner.getCloneBatchBufferAllocationSize());
+                }
+                arrSizeAtPrevIteration = arrBuilder->arrSize();
+                uassertStatusOK(cloner.nextCloneBatch(
+                    opCtx.get(), autoColl.getCollection(), arrBuilder.get_ptr()));
+            }
+
+            if (arrBuilder->arrSize() == 0) {
+                return bytesCloned;
+            }
+            bytesCloned += arrBuilder->len();
+        }
+    }
+
+    /**
+     * Creates a collection sharded on kShardKeyPattern, with 'numDocs' documents holding a string
+     * of 'docSizeInBytes' bytes.
+     */
+    void _createShardedCollection(int numDocs, int docSizeInBytes) {
+        auto opCtx = operationContext();
+        {
+            OperationShardingState::ScopedAllowImplicitCollectionCreate_UNSAFE
+                unsafeCreateCollection(opCtx);
+            uassertStatusOK(createCollection(opCtx, kNss.dbName(), BSON("create" << kNss.coll())));
+        }
+
+        const auto uuid = [&] {
+            AutoGetCollection autoColl(opCtx, kNss, MODE_IX);
+            return autoColl.getCollection()->uuid();
+        }();
+
+        {
+            const OID epoch = OID::gen();
+            const Timestamp timestamp(1);
+
+            auto rt = RoutingTableHistory::makeNew(
+                kNss,
+                uuid,
+                kShardKeyPattern,
+                nullptr,
+                false,
+                epoch,
+                timestamp,
+                boost::none /* timeseriesFields */,
+                boost::none /* resharding Fields */,
+                true,
+                {ChunkType{uuid,
+                           ChunkRange{BSON(kShardKey << MINKEY), BSON(kShardKey << MAXKEY)},
+                           ChunkVersion({epoch, timestamp}, {1, 0}),
+                           ShardId("dummyShardId")}});
+
+            AutoGetDb autoDb(opCtx, kNss.dbName(), MODE_IX);
+            Lock::CollectionLock collLock(opCtx, kNss, MODE_IX);
+            CollectionShardingRuntime::assertCollectionLockedAndAcquireExclusive(opCtx, kNss)
+                ->setFilteringMetadata(
+                    opCtx,
+                    CollectionMetadata(
+                        ChunkManager(ShardId("dummyShardId"),
+                                     DatabaseVersion(UUID::gen(), Timestamp(1, 1)),
+                                     makeStandaloneRoutingTableHistory(std::move(rt)),
+                                     boost::none),
+                        ShardId("dummyShardId")));
+        }
+
+        DBDirectClient client(opCtx);
+        client.createIndex(kNss, kShardKeyPattern);
+
+        std::vector<BSONObj> batch;
+        int batchSize = 0;
+        for (int i = 0; i < numDocs; ++i) {
+            auto doc =
+                BSON("_id" << i << kShardKey << i << "Y" << std::string(docSizeInBytes, 'y'));
+            if (batchSize + doc.objsize() > BSONObjMaxUserSize) {
+                uassertStatusOK(getStatusFromWriteCommandReply(
+                    client.insertAcknowledged(kNss, std::move(batch))));
+                batch.clear();
+                batchSize = 0;
+            }
+            batchSize += doc.objsize();
+            batch.push_back(std::move(doc));
+        }
+        if (!batch.empty()) {
+            uassertStatusOK(
+                getStatusFromWriteCommandReply(client.insertAcknowledged(kNss, std::move(batch))));
+        }
+    }
+
+    std::unique_ptr<ShardingCatalogClient> makeShardingCatalogClient() override {
+        class StaticCatalogClient final : public ShardingCatalogClientMock {
+        public:
+            StaticCatalogClient() = default;
+
+            StatusWith<repl::OpTimeWith<std::vector<ShardType>>> getAllShards(
+                OperationContext* opCtx, repl::ReadConcernLevel readConcern) override {
+
+                ShardType donorShard;
+                donorShard.setName(kDonorConnStr.getSetName());
+                donorShard.setHost(kDonorConnStr.toString());
+
+                ShardType recipientShard;
+                recipientShard.setName(kRecipientConnStr.getSetName());
+                recipientShard.setHost(kRecipientConnStr.toString());
+
+                return repl::OpTimeWith<std::vector<ShardType>>({donorShard, recipientShard});
+            }
+        };
+
+        return std::make_unique<StaticCatalogClient>();
+    }
+
+    LogicalSessionId _lsid;
+    TxnNumber _txnNumber{0};
+};
+
+/**
+ * Measures the initial clone phase of a chunk migration on the donor: 'streams' recipient threads
+ * send _migrateClone requests concurrently. With 'subRanges', chunkMigrationConcurrency is set to
+ * the number of streams so that each request drains its own sub-range of the record ids, otherwise
+ * all requests share a single one.
+ */
+void BM_initialCloneThroughput(benchmark::State& state) {
+    const int numStreams = state.range(0);
+    const bool useSubRanges = state.range(1);
+
+    RAIIServerParameterControllerForTest featureFlagController(
+        "featureFlagConcurrencyInChunkMigration", true);
+    RAIIServerParameterControllerForTest migrationConcurrencyController{
+        "chunkMigrationConcurrency", useSubRanges ? numStreams : 1};
+
+    BenchmarkClonerSourceFixture fixture(20 * 1000, state.range(2));
+
+    long long totalBytes = 0;
+    for (auto _ : state) {
+        totalBytes += fixture.runClone(state, numStreams);
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+BENCHMARK(BM_initialCloneThroughput)
+    ->ArgNames({"streams", "subRanges", "docSize"})
+    ->ArgsProduct({{1, 2, 4, 8}, {0, 1}, {128, 1024}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
 }  // namespace
 }  // namespace mongo
@@ -38,6 +38,7 @@
 #include "mongo/db/s/shard_server_test_fixture.h"
 #include "mongo/db/session/logical_session_id_helpers.h"
 #include "mongo/db/session/session_catalog_mongod.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/catalog/sharding_catalog_client_mock.h"
 #include "mongo/s/catalog/type_shard.h"
 #include "mongo/s/client/shard_registry.h"
@@ -1300,5 +1301,74 @@ TEST_F(MigrationChunkClonerSourceTest, CloneShouldNotCrashWhenNextCloneBatchThro
     futureCommit.default_timed_get();
 }
 
+TEST_F(MigrationChunkClonerSourceTest, JumboChunkClonedThroughIndexScanSubRanges) {
+    RAIIServerParameterControllerForTest featureFlagController(
+        "featureFlagConcurrencyInChunkMigration", true);
+    RAIIServerParameterControllerForTest migrationConcurrencyController{
+        "chunkMigrationConcurrency", 2};
+
+    std::vector<BSONObj> contents;
+    for (int i = 100; i < 108; ++i) {
+        contents.push_back(createCollectionDocument(i));
+    }
+
+    createShardedCollection(contents);
+
+    ShardsvrMoveRange req = createMoveRangeRequest(ChunkRange(BSON("X" << 100), BSON("X" << 200)));
+    req.setMaxChunkSizeBytes(1);
+    req.setForceJumbo(ForceJumbo::kForceBalancer);
+
+    MigrationChunkClonerSource cloner(operationContext(),
+                                      req,
+                                      WriteConcernOptions(),
+                                      kShardKeyPattern,
+                                      kDonorConnStr,
+                                      kRecipientConnStr.getServers()[0]);
+
+    {
+        auto futureStartClone = launchAsync([&]() {
+            onCommand([&](const RemoteCommandRequest& request) { return BSON("ok" << true); });
+        });
+
+        ASSERT_OK(cloner.startClone(operationContext(), UUID::gen(), _lsid, _txnNumber));
+        futureStartClone.default_timed_get();
+    }
+
+    // Each batch drains one of the two shard key sub-ranges the chunk was split into. A full chunk
+    // holds 2 documents, so only the first 4 keys were scanned to sample the bounds, and the last
+    // sub-range also covers the keys beyond them.
+    {
+        AutoGetCollection autoColl(operationContext(), kNss, MODE_IS);
+
+        size_t subRangeStart = 0;
+        for (size_t subRangeSize : {2, 6}) {
+            BSONArrayBuilder arrBuilder;
+            ASSERT_OK(
+                cloner.nextCloneBatch(operationContext(), autoColl.getCollection(), &arrBuilder));
+            ASSERT_EQ(subRangeSize, arrBuilder.arrSize());
+
+            const auto arr = arrBuilder.arr();
+            for (size_t i = 0; i < subRangeSize; ++i) {
+                ASSERT_BSONOBJ_EQ(contents[subRangeStart + i], arr[i].Obj());
+            }
+            subRangeStart += subRangeSize;
+        }
+
+        {
+            BSONArrayBuilder arrBuilder;
+            ASSERT_OK(
+                cloner.nextCloneBatch(operationContext(), autoColl.getCollection(), &arrBuilder));
+            ASSERT_EQ(0, arrBuilder.arrSize());
+        }
+    }
+
+    auto futureCommit = launchAsync([&]() {
+        onCommand([&](const RemoteCommandRequest& request) { return BSON("ok" << true); });
+    });
+
+    ASSERT_OK(cloner.commitClone(operationContext()));
+    futureCommit.default_timed_get();
+}
+
 }  // namespace
 }  // namespace mongo
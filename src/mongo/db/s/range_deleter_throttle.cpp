@@ -0,0 +1,143 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/s/range_deleter_throttle.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
+#include "mongo/db/s/sharding_statistics.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/kv/kv_engine.h"
+#include "mongo/db/storage/storage_engine.h"
+#include "mongo/logv2/log.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kShardingRangeDeleter
+
+namespace mongo {
+namespace {
+
+const auto getRangeDeleterThrottle = ServiceContext::declareDecoration<RangeDeleterThrottle>();
+
+}  // namespace
+
+RangeDeleterThrottle& RangeDeleterThrottle::get(ServiceContext* serviceContext) {
+    return getRangeDeleterThrottle(serviceContext);
+}
+
+RangeDeleterThrottle& RangeDeleterThrottle::get(OperationContext* opCtx) {
+    return get(opCtx->getServiceContext());
+}
+
+RangeDeleterThrottle::Pace RangeDeleterThrottle::nextBatch(OperationContext* opCtx) {
+    // A value of 0 indicates that the system chooses the default value (INT_MAX).
+    int maxBatchSize = rangeDeleterBatchSize.load();
+    if (maxBatchSize <= 0) {
+        maxBatchSize = std::numeric_limits<int>::max();
+    }
+
+    const bool adaptive = rangeDeleterAdaptiveThrottling.load();
+    const auto pace = adaptive ? adjust(_sampleSignals(opCtx), maxBatchSize)
+                               : Pace{maxBatchSize, Milliseconds(rangeDeleterBatchDelayMS.load())};
+
+    auto& stats = ShardingStatistics::get(opCtx);
+    stats.rangeDeleterAdaptiveThrottling.store(adaptive);
+    stats.rangeDeleterBatchSize.store(pace.batchSize);
+    stats.rangeDeleterBatchDelayMillis.store(durationCount<Milliseconds>(pace.delay));
+    if (pace.backedOff) {
+        stats.countRangeDeleterBackoffs.addAndFetch(1);
+    }
+
+    return pace;
+}
+
+RangeDeleterThrottle::Pace RangeDeleterThrottle::adjust(const Signals& signals, int maxBatchSize) {
+    const double cacheDirtyRatioThreshold = rangeDeleterAdaptiveCacheDirtyRatioThreshold.load();
+    const Milliseconds lagThreshold(rangeDeleterAdaptiveReplicationLagThresholdMS.load());
+    const Milliseconds maxDelay(rangeDeleterAdaptiveMaxBatchDelayMS.load());
+
+    const bool overloaded =
+        (signals.cacheDirtyRatio && *signals.cacheDirtyRatio > cacheDirtyRatioThreshold) ||
+        signals.majorityLag > lagThreshold;
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (overloaded) {
+        _batchSize = std::max(_batchSize / 2, kMinAdaptiveBatchSize);
+        _delay = std::min(std::max(_delay * 2, Milliseconds(kMinAdaptiveBackoffDelay)), maxDelay);
+    } else if (!signals.checkpointRunning) {
+        // Ramp up by a quarter at a time, so that a single healthy sample after a back off does not
+        // immediately undo it.
+        const long long increased = _batchSize + std::max(_batchSize / 4, 1);
+        _batchSize = static_cast<int>(std::min<long long>(increased, maxBatchSize));
+        _delay = _delay / 2;
+    }
+
+    _batchSize = std::min(_batchSize, maxBatchSize);
+
+    LOGV2_DEBUG(9393500,
+                2,
+                "Adjusted range deleter pace",
+                "cacheDirtyRatio"_attr = signals.cacheDirtyRatio,
+                "checkpointRunning"_attr = signals.checkpointRunning,
+                "majorityLag"_attr = signals.majorityLag,
+                "batchSize"_attr = _batchSize,
+                "delay"_attr = _delay);
+
+    return {_batchSize, _delay, overloaded};
+}
+
+RangeDeleterThrottle::Signals RangeDeleterThrottle::_sampleSignals(OperationContext* opCtx) {
+    Signals signals;
+
+    if (auto storageEngine = opCtx->getServiceContext()->getStorageEngine()) {
+        if (auto load = storageEngine->getEngine()->getLoadStats()) {
+            signals.cacheDirtyRatio = load->cacheDirtyRatio;
+            signals.checkpointRunning = load->checkpointRunning;
+        }
+    }
+
+    auto replCoord = repl::ReplicationCoordinator::get(opCtx);
+    if (replCoord->isReplEnabled()) {
+        const auto myLastApplied = replCoord->getMyLastAppliedOpTimeAndWallTime();
+        const auto lastCommitted = replCoord->getLastCommittedOpTimeAndWallTime();
+        if (lastCommitted.wallTime < myLastApplied.wallTime) {
+            signals.majorityLag = myLastApplied.wallTime - lastCommitted.wallTime;
+        }
+    }
+
+    return signals;
+}
+
+}  // namespace mongo
@@ -0,0 +1,108 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <boost/optional.hpp>
+
+#include "mongo/platform/mutex.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+class OperationContext;
+class ServiceContext;
+
+/**
+ * Paces the batches of the range deleter.
+ *
+ * By default every batch deletes up to rangeDeleterBatchSize documents and is followed by a
+ * rangeDeleterBatchDelayMS pause. With rangeDeleterAdaptiveThrottling enabled, the batch size and
+ * the pause instead follow the load of the node: both back off multiplicatively while the storage
+ * engine cache is too dirty or the majority commit point lags behind, hold steady while a
+ * checkpoint is in progress, and ramp back up otherwise.
+ */
+class RangeDeleterThrottle {
+public:
+    // Bounds and starting point of the adaptive batch size.
+    static constexpr int kMinAdaptiveBatchSize = 16;
+    static constexpr int kInitialAdaptiveBatchSize = 128;
+
+    // Shortest pause inserted between batches once the adaptive mode starts backing off.
+    static constexpr Milliseconds kMinAdaptiveBackoffDelay{10};
+
+    /**
+     * Load of the node as seen by the adaptive mode.
+     */
+    struct Signals {
+        // Fraction of the storage engine cache holding dirty data, if the engine reports it.
+        boost::optional<double> cacheDirtyRatio;
+
+        bool checkpointRunning = false;
+
+        // How far the majority commit point is behind the last applied write of this node.
+        Milliseconds majorityLag{0};
+    };
+
+    struct Pace {
+        int batchSize;
+        Milliseconds delay;
+
+        // Whether the last adjustment backed off because the node was overloaded.
+        bool backedOff = false;
+    };
+
+    static RangeDeleterThrottle& get(ServiceContext* serviceContext);
+    static RangeDeleterThrottle& get(OperationContext* opCtx);
+
+    /**
+     * Returns the pace of the next batch of the range deleter, sampling the load of the node when
+     * running in adaptive mode, and publishes it in the sharding statistics.
+     */
+    Pace nextBatch(OperationContext* opCtx);
+
+    /**
+     * Adjusts the adaptive pace to the given load and returns it. The batch size never exceeds
+     * 'maxBatchSize'.
+     */
+    Pace adjust(const Signals& signals, int maxBatchSize);
+
+private:
+    static Signals _sampleSignals(OperationContext* opCtx);
+
+    Mutex _mutex = MONGO_MAKE_LATCH("RangeDeleterThrottle::_mutex");
+
+    int _batchSize{kInitialAdaptiveBatchSize};
+    Milliseconds _delay{0};
+};
+
+}  // namespace mongo
@@ -0,0 +1,127 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/s/range_deleter_throttle.h"
+
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+constexpr int kMaxBatchSize = 1000;
+
+RangeDeleterThrottle::Signals healthy() {
+    RangeDeleterThrottle::Signals signals;
+    signals.cacheDirtyRatio = 0.01;
+    return signals;
+}
+
+RangeDeleterThrottle::Signals dirtyCache() {
+    RangeDeleterThrottle::Signals signals;
+    signals.cacheDirtyRatio = 0.5;
+    return signals;
+}
+
+TEST(RangeDeleterThrottle, BacksOffWhenCacheIsTooDirty) {
+    RangeDeleterThrottle throttle;
+
+    auto pace = throttle.adjust(dirtyCache(), kMaxBatchSize);
+    ASSERT_TRUE(pace.backedOff);
+    ASSERT_EQ(RangeDeleterThrottle::kInitialAdaptiveBatchSize / 2, pace.batchSize);
+    ASSERT_EQ(RangeDeleterThrottle::kMinAdaptiveBackoffDelay, pace.delay);
+
+    pace = throttle.adjust(dirtyCache(), kMaxBatchSize);
+    ASSERT_EQ(RangeDeleterThrottle::kInitialAdaptiveBatchSize / 4, pace.batchSize);
+    ASSERT_EQ(RangeDeleterThrottle::kMinAdaptiveBackoffDelay * 2, pace.delay);
+}
+
+TEST(RangeDeleterThrottle, BacksOffWhenMajorityCommitPointLags) {
+    RAIIServerParameterControllerForTest lagThreshold{
+        "rangeDeleterAdaptiveReplicationLagThresholdMS", 500};
+    RangeDeleterThrottle throttle;
+
+    auto signals = healthy();
+    signals.majorityLag = Milliseconds(400);
+    ASSERT_FALSE(throttle.adjust(signals, kMaxBatchSize).backedOff);
+
+    signals.majorityLag = Milliseconds(600);
+    ASSERT_TRUE(throttle.adjust(signals, kMaxBatchSize).backedOff);
+}
+
+TEST(RangeDeleterThrottle, HoldsPaceDuringCheckpoint) {
+    RangeDeleterThrottle throttle;
+    const auto backedOff = throttle.adjust(dirtyCache(), kMaxBatchSize);
+
+    auto signals = healthy();
+    signals.checkpointRunning = true;
+    const auto pace = throttle.adjust(signals, kMaxBatchSize);
+    ASSERT_FALSE(pace.backedOff);
+    ASSERT_EQ(backedOff.batchSize, pace.batchSize);
+    ASSERT_EQ(backedOff.delay, pace.delay);
+}
+
+TEST(RangeDeleterThrottle, RampsUpUntilMaxBatchSizeWhenHealthy) {
+    RangeDeleterThrottle throttle;
+    throttle.adjust(dirtyCache(), kMaxBatchSize);
+
+    auto pace = throttle.adjust(healthy(), kMaxBatchSize);
+    ASSERT_GT(pace.batchSize, RangeDeleterThrottle::kInitialAdaptiveBatchSize / 2);
+    ASSERT_LT(pace.delay, RangeDeleterThrottle::kMinAdaptiveBackoffDelay);
+
+    for (int i = 0; i < 100; ++i) {
+        pace = throttle.adjust(healthy(), kMaxBatchSize);
+    }
+    ASSERT_EQ(kMaxBatchSize, pace.batchSize);
+    ASSERT_EQ(Milliseconds(0), pace.delay);
+}
+
+TEST(RangeDeleterThrottle, BackoffIsBounded) {
+    RAIIServerParameterControllerForTest maxDelay{"rangeDeleterAdaptiveMaxBatchDelayMS", 100};
+    RangeDeleterThrottle throttle;
+
+    RangeDeleterThrottle::Pace pace;
+    for (int i = 0; i < 100; ++i) {
+        pace = throttle.adjust(dirtyCache(), kMaxBatchSize);
+    }
+    ASSERT_EQ(RangeDeleterThrottle::kMinAdaptiveBatchSize, pace.batchSize);
+    ASSERT_EQ(Milliseconds(100), pace.delay);
+}
+
+TEST(RangeDeleterThrottle, NeverExceedsConfiguredBatchSize) {
+    RangeDeleterThrottle throttle;
+    ASSERT_EQ(10, throttle.adjust(healthy(), 10).batchSize);
+    ASSERT_EQ(10, throttle.adjust(dirtyCache(), 10).batchSize);
+}
+
+}  // namespace
+}  // namespace mongo
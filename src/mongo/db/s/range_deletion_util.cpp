@@ -49,6 +49,7 @@
 #include "mongo/db/repl/repl_client_info.h"
 #include "mongo/db/s/balancer_stats_registry.h"
 #include "mongo/db/s/operation_sharding_state.h"
+#include "mongo/db/s/range_deleter_throttle.h"
 #include "mongo/db/s/sharding_runtime_d_params_gen.h"
 #include "mongo/db/s/sharding_statistics.h"
 #include "mongo/db/service_context.h"
@@ -278,12 +279,9 @@ Status deleteRangeInBatches(OperationContext* opCtx,
     // processed.
     while (!allDocsRemoved) {
         try {
-            int numDocsToRemovePerBatch = rangeDeleterBatchSize.load();
-            if (numDocsToRemovePerBatch <= 0) {
-                numDocsToRemovePerBatch = kRangeDeleterBatchSizeDefault;
-            }
-
-            Milliseconds delayBetweenBatches(rangeDeleterBatchDelayMS.load());
+            const auto pace = RangeDeleterThrottle::get(opCtx).nextBatch(opCtx);
+            const int numDocsToRemovePerBatch = pace.batchSize;
+            const Milliseconds delayBetweenBatches = pace.delay;
 
             ensureRangeDeletionTaskStillExists(opCtx, collectionUuid, range);
 
@@ -73,6 +73,13 @@ void ShardingStatistics::report(BSONObjBuilder* builder) const {
     builder->append("countBytesClonedOnDonor", countBytesClonedOnDonor.load());
     builder->append("countRecipientMoveChunkStarted", countRecipientMoveChunkStarted.load());
     builder->append("countDocsDeletedByRangeDeleter", countDocsDeletedByRangeDeleter.load());
+    {
+        BSONObjBuilder rangeDeleterBuilder(builder->subobjStart("rangeDeleterThrottling"));
+        rangeDeleterBuilder.append("adaptive", rangeDeleterAdaptiveThrottling.load());
+        rangeDeleterBuilder.append("batchSize", rangeDeleterBatchSize.load());
+        rangeDeleterBuilder.append("batchDelayMillis", rangeDeleterBatchDelayMillis.load());
+        rangeDeleterBuilder.append("countBackoffs", countRangeDeleterBackoffs.load());
+    }
     builder->append("countDonorMoveChunkLockTimeout", countDonorMoveChunkLockTimeout.load());
     builder->append("countDonorMoveChunkAbortConflictingIndexOperation",
                     countDonorMoveChunkAbortConflictingIndexOperation.load());
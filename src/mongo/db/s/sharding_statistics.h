@@ -91,6 +91,16 @@ struct ShardingStatistics {
     // rangeDeleter.
     AtomicWord<long long> countDocsDeletedByRangeDeleter{0};
 
+    // Pace of the range deleter chosen for its last batch, and whether it was chosen adaptively
+    // (see RangeDeleterThrottle).
+    AtomicWord<bool> rangeDeleterAdaptiveThrottling{false};
+    AtomicWord<long long> rangeDeleterBatchSize{0};
+    AtomicWord<long long> rangeDeleterBatchDelayMillis{0};
+
+    // Cumulative, always-increasing counter of how many times the adaptive range deleter backed
+    // off because the node was overloaded.
+    AtomicWord<long long> countRangeDeleterBackoffs{0};
+
     // Cumulative, always-increasing counter of how many chunks this node started to receive
     // (whether the receiving succeeded or not)
     AtomicWord<long long> countRecipientMoveChunkStarted{0};
@@ -83,7 +83,7 @@ boost::optional<ShardId> ShardingWriteRouter::getReshardingDestinedRecipient(
     }
 
     auto shardKey = _reshardingKeyPattern->extractShardKeyFromDocThrows(fullDocument);
-    return _reshardingChunkMgr->findIntersectingChunkWithSimpleCollation(shardKey).getShardId();
+    return _reshardingChunkMgr->findIntersectingShardIdWithSimpleCollation(shardKey);
 }
 
 }  // namespace mongo
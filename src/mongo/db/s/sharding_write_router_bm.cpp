@@ -229,6 +229,51 @@ void BM_UnshardedDestinedRecipient(benchmark::State& state) {
     }
 }
 
+/**
+ * Measures the cost of finding the shard which owns a shard key in a routing table with many
+ * chunks, either through the chunk bounds index (which is what ShardingWriteRouter and the
+ * targeter use) or by looking up the owning chunk itself.
+ */
+template <bool useChunkBoundsIndex>
+void BM_TargetShardKey(benchmark::State& state) {
+    const size_t nShards = state.range(0);
+    const uint32_t nChunks = state.range(1);
+
+    std::vector<ShardId> shards;
+    for (size_t i = 0; i < nShards; ++i) {
+        shards.emplace_back(str::stream() << "shard" << i);
+    }
+    const auto [chunks, cm] = createChunks(nShards, nChunks, shards);
+
+    PseudoRandom random(12345);
+    std::vector<BSONObj> keys;
+    for (int i = 0; i < 4096; ++i) {
+        keys.push_back(BSON("_id" << random.nextInt64(int64_t(nChunks) * 100)));
+    }
+
+    size_t i = 0;
+    for (auto keepRunning : state) {
+        const auto& key = keys[i++ % keys.size()];
+        if constexpr (useChunkBoundsIndex) {
+            benchmark::DoNotOptimize(cm.findIntersectingShardIdWithSimpleCollation(key));
+        } else {
+            benchmark::DoNotOptimize(cm.findIntersectingChunkWithSimpleCollation(key).getShardId());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_TargetShardKey, true)
+    ->Args({4, 1000})
+    ->Args({4, 100000})
+    ->Args({64, 1000000});
+
+BENCHMARK_TEMPLATE(BM_TargetShardKey, false)
+    ->Args({4, 1000})
+    ->Args({4, 100000})
+    ->Args({64, 1000000});
+
 BENCHMARK(BM_InsertGetDestinedRecipient)
     ->Range(1, 1 << 4)
     ->ThreadRange(1, ProcessInfo::getNumAvailableCores());
@@ -59,6 +59,7 @@
 #include "mongo/db/jsobj.h"
 #include "mongo/db/logical_time_validator.h"
 #include "mongo/db/not_primary_error_tracker.h"
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/db/op_observer/op_observer.h"
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/ops/write_ops_exec.h"
@@ -70,6 +71,7 @@
 #include "mongo/db/repl/repl_client_info.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_coordinator.h"
+#include "mongo/db/repl/secondary_read_staleness.h"
 #include "mongo/db/repl/speculative_majority_read_info.h"
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/repl/tenant_migration_access_blocker_util.h"
@@ -696,7 +698,10 @@ private:
         _startOperationTime = getClientOperationTime(opCtx);
 
         rpc::readRequestMetadata(opCtx, request, command->requiresAuth());
-        _invocation = command->parse(opCtx, request);
+        {
+            ScopedOperationPhaseTimer parseTimer(opCtx, OperationPhase::kParse);
+            _invocation = command->parse(opCtx, request);
+        }
         CommandInvocation::set(opCtx, _invocation);
 
         const auto session = _execContext->getOpCtx()->getClient()->session();
@@ -1730,6 +1735,18 @@ void ExecCommandDatabase::_initiateCommand() {
     // Once API params and txn state are set on opCtx, enforce the "requireApiVersion" setting.
     enforceRequireAPIVersion(opCtx, command);
 
+    // Reads that opted in to running on a secondary are subject to the node's bounded-staleness
+    // admission policy. This must happen after the operation deadline has been set, since the
+    // admission check may wait for this node to catch up.
+    if (!opCtx->getClient()->isInDirectClient() && !iAmPrimary &&
+        !opCtx->inMultiDocumentTransaction() &&
+        command->secondaryAllowed(opCtx->getServiceContext()) ==
+            Command::AllowedOnSecondary::kOptIn &&
+        ReadPreferenceSetting::get(opCtx).canRunOnSecondary() &&
+        replCoord->getMemberState().secondary()) {
+        repl::admitSecondaryReadWithinStalenessBound(opCtx);
+    }
+
     // Check that the client has the directShardOperations role if this is a direct operation to a
     // shard.
     if (command->requiresAuth() && ShardingState::get(opCtx)->enabled() &&
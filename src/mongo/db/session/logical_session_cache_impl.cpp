@@ -32,6 +32,7 @@
 
 #include "mongo/db/session/logical_session_cache_impl.h"
 
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/operation_sharding_state.h"
@@ -58,6 +59,39 @@ void clearShardingOperationFailedStatus(OperationContext* opCtx) {
     OperationShardingState::get(opCtx).resetShardingOperationFailedStatus();
 }
 
+FTDCMetricRegistry::Metric& registerCacheMetric(StringData field) {
+    return FTDCMetricRegistry::get().registerMetric("logicalSessionRecordCache." +
+                                                    field.toString());
+}
+
+/**
+ * The logicalSessionRecordCache statistics, which FTDC records from the metric registry instead of
+ * running the serverStatus section every period.
+ */
+struct CacheMetrics {
+    FTDCMetricRegistry::Metric& activeSessionsCount = registerCacheMetric("activeSessionsCount");
+    FTDCMetricRegistry::Metric& sessionsCollectionJobCount =
+        registerCacheMetric("sessionsCollectionJobCount");
+    FTDCMetricRegistry::Metric& lastSessionsCollectionJobDurationMillis =
+        registerCacheMetric("lastSessionsCollectionJobDurationMillis");
+    FTDCMetricRegistry::Metric& lastSessionsCollectionJobTimestamp =
+        registerCacheMetric("lastSessionsCollectionJobTimestamp");
+    FTDCMetricRegistry::Metric& lastSessionsCollectionJobEntriesRefreshed =
+        registerCacheMetric("lastSessionsCollectionJobEntriesRefreshed");
+    FTDCMetricRegistry::Metric& lastSessionsCollectionJobEntriesEnded =
+        registerCacheMetric("lastSessionsCollectionJobEntriesEnded");
+    FTDCMetricRegistry::Metric& lastSessionsCollectionJobCursorsClosed =
+        registerCacheMetric("lastSessionsCollectionJobCursorsClosed");
+    FTDCMetricRegistry::Metric& transactionReaperJobCount =
+        registerCacheMetric("transactionReaperJobCount");
+    FTDCMetricRegistry::Metric& lastTransactionReaperJobDurationMillis =
+        registerCacheMetric("lastTransactionReaperJobDurationMillis");
+    FTDCMetricRegistry::Metric& lastTransactionReaperJobTimestamp =
+        registerCacheMetric("lastTransactionReaperJobTimestamp");
+    FTDCMetricRegistry::Metric& lastTransactionReaperJobEntriesCleanedUp =
+        registerCacheMetric("lastTransactionReaperJobEntriesCleanedUp");
+} cacheMetrics;
+
 }  // namespace
 
 LogicalSessionCacheImpl::LogicalSessionCacheImpl(std::unique_ptr<ServiceLiaison> service,
@@ -68,6 +102,7 @@ LogicalSessionCacheImpl::LogicalSessionCacheImpl(std::unique_ptr<ServiceLiaison>
       _reapSessionsOlderThanFn(std::move(reapSessionsOlderThanFn)) {
     _stats.setLastSessionsCollectionJobTimestamp(_service->now());
     _stats.setLastTransactionReaperJobTimestamp(_service->now());
+    _publishStats(WithLock::withoutLock());
 
     if (!disableLogicalSessionCacheRefresh) {
         _service->scheduleJob(
@@ -191,6 +226,7 @@ Status LogicalSessionCacheImpl::_reap(Client* client) {
         // Start the new run.
         _stats.setLastTransactionReaperJobTimestamp(_service->now());
         _stats.setTransactionReaperJobCount(_stats.getTransactionReaperJobCount() + 1);
+        _publishStats(lk);
     }
 
     int numReaped = 0;
@@ -216,6 +252,7 @@ Status LogicalSessionCacheImpl::_reap(Client* client) {
             stdx::lock_guard<Latch> lk(_mutex);
             auto millis = _service->now() - _stats.getLastTransactionReaperJobTimestamp();
             _stats.setLastTransactionReaperJobDurationMillis(millis.count());
+            _publishStats(lk);
         }
 
         return ex.toStatus();
@@ -226,6 +263,7 @@ Status LogicalSessionCacheImpl::_reap(Client* client) {
         auto millis = _service->now() - _stats.getLastTransactionReaperJobTimestamp();
         _stats.setLastTransactionReaperJobDurationMillis(millis.count());
         _stats.setLastTransactionReaperJobEntriesCleanedUp(numReaped);
+        _publishStats(lk);
     }
 
     return Status::OK();
@@ -247,6 +285,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     if (replCoord && replCoord->isReplEnabled() && replCoord->getMemberState().arbiter()) {
         stdx::lock_guard<Latch> lk(_mutex);
         _activeSessions.clear();
+        _publishStats(lk);
         return;
     }
 
@@ -263,6 +302,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         // Start the new run.
         _stats.setLastSessionsCollectionJobTimestamp(_service->now());
         _stats.setSessionsCollectionJobCount(_stats.getSessionsCollectionJobCount() + 1);
+        _publishStats(lk);
     }
 
     // This will finish timing _refresh for our stats no matter when we return.
@@ -270,6 +310,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         stdx::lock_guard<Latch> lk(_mutex);
         auto millis = _service->now() - _stats.getLastSessionsCollectionJobTimestamp();
         _stats.setLastSessionsCollectionJobDurationMillis(millis.count());
+        _publishStats(lk);
     });
 
     ON_BLOCK_EXIT([&opCtx] { clearShardingOperationFailedStatus(opCtx); });
@@ -285,6 +326,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         stdx::lock_guard<Latch> lk(_mutex);
         swap(explicitlyEndingSessions, _endingSessions);
         swap(activeSessions, _activeSessions);
+        _publishStats(lk);
     }
 
     // Create guards that in the case of a exception replace the ending or active sessions that
@@ -297,6 +339,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         for (const auto& it : temp) {
             member.emplace(it);
         }
+        _publishStats(lk);
     };
     ScopeGuard activeSessionsBackSwapper([&] { backSwap(_activeSessions, activeSessions); });
     auto explicitlyEndingBackSwaper =
@@ -329,6 +372,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.setLastSessionsCollectionJobEntriesRefreshed(activeSessionRecords.size());
+        _publishStats(lk);
     }
 
     // Remove the ending sessions from the sessions collection.
@@ -337,6 +381,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.setLastSessionsCollectionJobEntriesEnded(explicitlyEndingSessions.size());
+        _publishStats(lk);
     }
 
     // Find which running, but not recently active sessions, are expired, and add them
@@ -379,6 +424,7 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
     {
         stdx::lock_guard<Latch> lk(_mutex);
         _stats.setLastSessionsCollectionJobCursorsClosed(killRes.second);
+        _publishStats(lk);
     }
 }
 
@@ -398,6 +444,28 @@ LogicalSessionCacheStats LogicalSessionCacheImpl::getStats() {
     return _stats;
 }
 
+void LogicalSessionCacheImpl::_publishStats(WithLock) {
+    cacheMetrics.activeSessionsCount.set(_activeSessions.size());
+    cacheMetrics.sessionsCollectionJobCount.set(_stats.getSessionsCollectionJobCount());
+    cacheMetrics.lastSessionsCollectionJobDurationMillis.set(
+        _stats.getLastSessionsCollectionJobDurationMillis());
+    cacheMetrics.lastSessionsCollectionJobTimestamp.set(
+        _stats.getLastSessionsCollectionJobTimestamp().toMillisSinceEpoch());
+    cacheMetrics.lastSessionsCollectionJobEntriesRefreshed.set(
+        _stats.getLastSessionsCollectionJobEntriesRefreshed());
+    cacheMetrics.lastSessionsCollectionJobEntriesEnded.set(
+        _stats.getLastSessionsCollectionJobEntriesEnded());
+    cacheMetrics.lastSessionsCollectionJobCursorsClosed.set(
+        _stats.getLastSessionsCollectionJobCursorsClosed());
+    cacheMetrics.transactionReaperJobCount.set(_stats.getTransactionReaperJobCount());
+    cacheMetrics.lastTransactionReaperJobDurationMillis.set(
+        _stats.getLastTransactionReaperJobDurationMillis());
+    cacheMetrics.lastTransactionReaperJobTimestamp.set(
+        _stats.getLastTransactionReaperJobTimestamp().toMillisSinceEpoch());
+    cacheMetrics.lastTransactionReaperJobEntriesCleanedUp.set(
+        _stats.getLastTransactionReaperJobEntriesCleanedUp());
+}
+
 Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRecord record) {
     if (_activeSessions.size() >= size_t(maxSessions)) {
         Status status = {ErrorCodes::TooManyLogicalSessions,
@@ -421,6 +489,7 @@ Status LogicalSessionCacheImpl::_addToCacheIfNotFull(WithLock, LogicalSessionRec
     }
 
     _activeSessions.insert(std::make_pair(record.getId(), std::move(record)));
+    cacheMetrics.activeSessionsCount.set(_activeSessions.size());
 
     return Status::OK();
 }
@@ -101,6 +101,11 @@ private:
      */
     bool _isDead(const LogicalSessionRecord& record, Date_t now) const;
 
+    /**
+     * Publishes '_stats' and the number of active sessions to the FTDC metric registry.
+     */
+    void _publishStats(WithLock);
+
     Status _addToCacheIfNotFull(WithLock, LogicalSessionRecord record);
 
     const std::unique_ptr<ServiceLiaison> _service;
@@ -39,6 +39,7 @@
 #include "mongo/db/auth/authz_manager_external_state_mock.h"
 #include "mongo/db/auth/authz_session_external_state_mock.h"
 #include "mongo/db/auth/user_name.h"
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/service_context_test_fixture.h"
@@ -261,6 +262,24 @@ TEST_F(LogicalSessionCacheTest, EndSessions) {
     cache()->endSessions({lsids[0], lsids[1]});
 }
 
+// Test the statistics are published to the FTDC metric registry.
+TEST_F(LogicalSessionCacheTest, PublishesStatsToMetricRegistry) {
+    auto& registry = FTDCMetricRegistry::get();
+    auto& activeSessionsCount =
+        registry.registerMetric("logicalSessionRecordCache.activeSessionsCount");
+    auto& sessionsCollectionJobCount =
+        registry.registerMetric("logicalSessionRecordCache.sessionsCollectionJobCount");
+
+    ASSERT_OK(cache()->startSession(opCtx(), makeLogicalSessionRecordForTest()));
+    ASSERT_OK(cache()->startSession(opCtx(), makeLogicalSessionRecordForTest()));
+    ASSERT_EQ(2, activeSessionsCount.get());
+
+    ASSERT_OK(cache()->refreshNow(opCtx()));
+    auto stats = cache()->getStats();
+    ASSERT_EQ(stats.getActiveSessionsCount(), activeSessionsCount.get());
+    ASSERT_EQ(stats.getSessionsCollectionJobCount(), sessionsCollectionJobCount.get());
+}
+
 // Test the peekCached method.
 TEST_F(LogicalSessionCacheTest, PeekCached) {
     auto lsid0 = makeLogicalSessionIdForTest();
@@ -34,6 +34,7 @@
 
 #include <memory>
 
+#include "mongo/db/ftdc/metric_registry.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/session/logical_session_id_helpers.h"
@@ -52,6 +53,10 @@ const auto operationSessionDecoration =
 
 MONGO_FAIL_POINT_DEFINE(hangAfterIncrementingNumWaitingToCheckOut);
 
+// Reported under logicalSessionRecordCache by serverStatus, which FTDC does not run.
+auto& sessionCatalogSizeMetric = FTDCMetricRegistry::get().registerMetric(
+    "logicalSessionRecordCache.sessionCatalogSize");
+
 std::string provenanceToString(SessionCatalog::Provenance provenance) {
     switch (provenance) {
         case SessionCatalog::Provenance::kRouter:
@@ -76,6 +81,7 @@ SessionCatalog::~SessionCatalog() {
 void SessionCatalog::reset_forTest() {
     stdx::lock_guard<Latch> lg(_mutex);
     _sessions.clear();
+    sessionCatalogSizeMetric.set(0);
 }
 
 SessionCatalog* SessionCatalog::get(OperationContext* opCtx) {
@@ -260,6 +266,7 @@ LogicalSessionIdSet SessionCatalog::scanSessionsForReap(
         if (shouldReapRemaining) {
             sriToReap = std::move(sriIt->second);
             _sessions.erase(sriIt);
+            sessionCatalogSizeMetric.set(_sessions.size());
             remainingSessions.clear();
         }
 
@@ -310,6 +317,7 @@ SessionCatalog::SessionRuntimeInfo* SessionCatalog::_getOrCreateSessionRuntimeIn
     const auto& parentLsid = isParentSessionId(lsid) ? lsid : *getParentSessionId(lsid);
     auto sriIt =
         _sessions.emplace(parentLsid, std::make_unique<SessionRuntimeInfo>(parentLsid)).first;
+    sessionCatalogSizeMetric.set(_sessions.size());
     auto sri = sriIt->second.get();
 
     if (isChildSession(lsid)) {
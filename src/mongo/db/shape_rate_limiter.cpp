@@ -0,0 +1,202 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/shape_rate_limiter.h"
+
+#include <absl/hash/hash.h>
+#include <algorithm>
+#include <vector>
+
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/service_context.h"
+#include "mongo/util/hex.h"
+
+namespace mongo {
+
+namespace {
+
+const auto getShapeRateLimiter = ServiceContext::declareDecoration<ShapeRateLimiter>();
+
+// Returns the tokens of a bucket last refilled at 'lastRefill' holding 'tokens'.
+double refilledTokens(
+    double tokens, Date_t lastRefill, Date_t now, double tokensPerSecond, int burst) {
+    if (now > lastRefill) {
+        tokens += durationCount<Microseconds>(now - lastRefill) * tokensPerSecond / 1000000;
+    }
+    return std::min(tokens, static_cast<double>(burst));
+}
+
+class ShapeRateLimiterSSS : public ServerStatusSection {
+public:
+    ShapeRateLimiterSSS() : ServerStatusSection("shapeRateLimiter") {}
+
+    ~ShapeRateLimiterSSS() override = default;
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        ShapeRateLimiter::get(opCtx->getServiceContext()).appendStats(&builder, kMaxShapes);
+        return builder.obj();
+    }
+
+private:
+    static constexpr std::size_t kMaxShapes = 20;
+} shapeRateLimiterSSS;
+
+}  // namespace
+
+std::size_t ShapeRateLimiter::Shape::hash() const {
+    return absl::HashOf(absl::string_view(ns.rawData(), ns.size()),
+                        absl::string_view(command.rawData(), command.size()),
+                        queryHash.has_value(),
+                        queryHash.value_or(0));
+}
+
+ShapeRateLimiter& ShapeRateLimiter::get(ServiceContext* serviceContext) {
+    return getShapeRateLimiter(serviceContext);
+}
+
+ShapeRateLimiter::Decision ShapeRateLimiter::admit(const Shape& shape,
+                                                   Date_t now,
+                                                   double tokensPerSecond,
+                                                   int burst) {
+    const auto hash = shape.hash();
+    auto& partition = _partitions[hash % kNumPartitions];
+
+    stdx::lock_guard<Latch> lk(partition.mutex);
+    auto& bucket = _getBucket(partition, shape, hash, now, tokensPerSecond, burst);
+    bucket.tokens = refilledTokens(bucket.tokens, bucket.lastRefill, now, tokensPerSecond, burst);
+    bucket.lastRefill = std::max(bucket.lastRefill, now);
+
+    if (bucket.tokens < 1) {
+        ++bucket.suppressed;
+        ++bucket.suppressedSinceAdmitted;
+        _suppressed.fetchAndAdd(1);
+        return {false, bucket.suppressedSinceAdmitted};
+    }
+
+    bucket.tokens -= 1;
+    ++bucket.admitted;
+    _admitted.fetchAndAdd(1);
+    return {true, std::exchange(bucket.suppressedSinceAdmitted, 0)};
+}
+
+ShapeRateLimiter::Bucket& ShapeRateLimiter::_getBucket(Partition& partition,
+                                                       const Shape& shape,
+                                                       std::size_t hash,
+                                                       Date_t now,
+                                                       double tokensPerSecond,
+                                                       int burst) {
+    if (auto it = partition.buckets.find(hash); it != partition.buckets.end()) {
+        return it->second;
+    }
+
+    if (partition.buckets.size() >= kMaxShapesPerPartition && now >= partition.nextIdleShapeScan) {
+        // Forget the shapes which have been idle for long enough that their bucket is full again.
+        // The scan visits every bucket of the partition under its mutex, so while the partition
+        // stays full of active shapes, new shapes share the overflow bucket until the next scan.
+        partition.nextIdleShapeScan = now + kIdleShapeScanInterval;
+        for (auto it = partition.buckets.begin(); it != partition.buckets.end();) {
+            const auto& bucket = it->second;
+            if (bucket.suppressedSinceAdmitted == 0 &&
+                refilledTokens(bucket.tokens, bucket.lastRefill, now, tokensPerSecond, burst) >=
+                    burst) {
+                partition.buckets.erase(it++);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    if (partition.buckets.size() >= kMaxShapesPerPartition) {
+        if (partition.overflow.lastRefill == Date_t()) {
+            partition.overflow.tokens = burst;
+            partition.overflow.lastRefill = now;
+        }
+        return partition.overflow;
+    }
+
+    auto& bucket = partition.buckets[hash];
+    bucket.tokens = burst;
+    bucket.lastRefill = now;
+    bucket.ns = shape.ns.toString();
+    bucket.command = shape.command.toString();
+    bucket.queryHash = shape.queryHash;
+    return bucket;
+}
+
+void ShapeRateLimiter::appendStats(BSONObjBuilder* builder, std::size_t maxShapes) const {
+    builder->append("admitted", _admitted.load());
+    builder->append("suppressed", _suppressed.load());
+
+    std::vector<Bucket> buckets;
+    long long numShapes = 0;
+    long long overflowSuppressed = 0;
+    for (const auto& partition : _partitions) {
+        stdx::lock_guard<Latch> lk(partition.mutex);
+        numShapes += partition.buckets.size();
+        overflowSuppressed += partition.overflow.suppressed;
+        for (const auto& [hash, bucket] : partition.buckets) {
+            if (bucket.suppressed > 0) {
+                buckets.push_back(bucket);
+            }
+        }
+    }
+    builder->append("shapes", numShapes);
+    builder->append("untrackedShapesSuppressed", overflowSuppressed);
+
+    auto mostSuppressed = [](const Bucket& lhs, const Bucket& rhs) {
+        return lhs.suppressed > rhs.suppressed;
+    };
+    const auto numReported = std::min(maxShapes, buckets.size());
+    std::partial_sort(
+        buckets.begin(), buckets.begin() + numReported, buckets.end(), mostSuppressed);
+
+    BSONArrayBuilder topSuppressed(builder->subarrayStart("topSuppressed"));
+    for (std::size_t i = 0; i < numReported; ++i) {
+        const auto& bucket = buckets[i];
+        BSONObjBuilder shapeBuilder(topSuppressed.subobjStart());
+        shapeBuilder.append("ns", bucket.ns);
+        shapeBuilder.append("command", bucket.command);
+        if (bucket.queryHash) {
+            shapeBuilder.append("queryHash", zeroPaddedHex(*bucket.queryHash));
+        }
+        shapeBuilder.append("admitted", bucket.admitted);
+        shapeBuilder.append("suppressed", bucket.suppressed);
+    }
+}
+
+}  // namespace mongo
@@ -0,0 +1,137 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <array>
+#include <boost/optional.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+class ServiceContext;
+
+/**
+ * Token bucket rate limiter for slow operation logging and profiling, keyed by query shape.
+ *
+ * Generalizes the profilingRateLimit parameter, which samples fast operations uniformly: when an
+ * incident makes a single query shape slow, every execution of it would otherwise be logged and
+ * profiled, amplifying the overload. Each shape gets a bucket of 'burst' tokens that refills at
+ * 'tokensPerSecond'. An operation which would be logged or profiled takes a token, and is
+ * suppressed if there is none. The number of suppressed operations is kept per shape and reported
+ * with the next admitted one.
+ *
+ * Shapes are partitioned by hash, each partition tracking a bounded number of shapes. Operations
+ * of shapes which do not fit share a partition-wide bucket. A full partition forgets its idle
+ * shapes to make room, scanning for them at most once per kIdleShapeScanInterval.
+ */
+class ShapeRateLimiter {
+public:
+    /**
+     * Identifies the shape of an operation. The strings must outlive the call to admit().
+     */
+    struct Shape {
+        StringData ns;
+        StringData command;
+        boost::optional<uint32_t> queryHash;
+
+        std::size_t hash() const;
+    };
+
+    struct Decision {
+        bool admitted;
+        // Operations of the shape suppressed since the last admitted one, reset once admitted.
+        long long suppressedSinceAdmitted;
+    };
+
+    static constexpr std::size_t kNumPartitions = 16;
+    static constexpr std::size_t kMaxShapesPerPartition = 256;
+    static constexpr Milliseconds kIdleShapeScanInterval = Seconds(1);
+
+    static ShapeRateLimiter& get(ServiceContext* serviceContext);
+
+    /**
+     * Takes a token from the bucket of 'shape' if there is one, refilling it at 'tokensPerSecond'
+     * up to 'burst' tokens since the last call.
+     */
+    Decision admit(const Shape& shape, Date_t now, double tokensPerSecond, int burst);
+
+    /**
+     * Appends the total counters and the 'maxShapes' shapes with the most suppressed operations.
+     */
+    void appendStats(BSONObjBuilder* builder, std::size_t maxShapes) const;
+
+private:
+    struct Bucket {
+        double tokens = 0;
+        Date_t lastRefill;
+        long long admitted = 0;
+        long long suppressed = 0;
+        long long suppressedSinceAdmitted = 0;
+
+        std::string ns;
+        std::string command;
+        boost::optional<uint32_t> queryHash;
+    };
+
+    struct Partition {
+        mutable Mutex mutex = MONGO_MAKE_LATCH("ShapeRateLimiter::Partition::mutex");
+        stdx::unordered_map<std::size_t, Bucket> buckets;
+        Bucket overflow;
+        // Earliest time a full partition scans its buckets for idle shapes again.
+        Date_t nextIdleShapeScan;
+    };
+
+    // Returns the bucket of 'shape', creating it if there is room. Must hold the partition mutex.
+    Bucket& _getBucket(Partition& partition,
+                       const Shape& shape,
+                       std::size_t hash,
+                       Date_t now,
+                       double tokensPerSecond,
+                       int burst);
+
+    std::array<Partition, kNumPartitions> _partitions;
+
+    AtomicWord<long long> _admitted{0};
+    AtomicWord<long long> _suppressed{0};
+};
+
+}  // namespace mongo
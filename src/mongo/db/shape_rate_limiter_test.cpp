@@ -0,0 +1,191 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/db/shape_rate_limiter.h"
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+const ShapeRateLimiter::Shape kFindShape{"test.coll"_sd, "find"_sd, 0x1234u};
+const Date_t kStart = Date_t::fromMillisSinceEpoch(1000000);
+
+TEST(ShapeRateLimiterTest, AdmitsBurstThenSuppresses) {
+    ShapeRateLimiter limiter;
+    for (int i = 0; i < 3; ++i) {
+        auto decision = limiter.admit(kFindShape, kStart, 1, 3);
+        ASSERT_TRUE(decision.admitted);
+        ASSERT_EQ(decision.suppressedSinceAdmitted, 0);
+    }
+
+    for (int i = 1; i <= 5; ++i) {
+        auto decision = limiter.admit(kFindShape, kStart, 1, 3);
+        ASSERT_FALSE(decision.admitted);
+        ASSERT_EQ(decision.suppressedSinceAdmitted, i);
+    }
+}
+
+TEST(ShapeRateLimiterTest, RefillsAtRateAndReportsSuppressed) {
+    ShapeRateLimiter limiter;
+    ASSERT_TRUE(limiter.admit(kFindShape, kStart, 2, 1).admitted);
+    ASSERT_FALSE(limiter.admit(kFindShape, kStart, 2, 1).admitted);
+    ASSERT_FALSE(limiter.admit(kFindShape, kStart + Milliseconds(400), 2, 1).admitted);
+
+    // Two tokens per second refill one token after 500ms.
+    auto decision = limiter.admit(kFindShape, kStart + Milliseconds(500), 2, 1);
+    ASSERT_TRUE(decision.admitted);
+    ASSERT_EQ(decision.suppressedSinceAdmitted, 2);
+
+    // The bucket never holds more than the burst.
+    ASSERT_TRUE(limiter.admit(kFindShape, kStart + Seconds(60), 2, 1).admitted);
+    decision = limiter.admit(kFindShape, kStart + Seconds(60), 2, 1);
+    ASSERT_FALSE(decision.admitted);
+    ASSERT_EQ(decision.suppressedSinceAdmitted, 1);
+}
+
+TEST(ShapeRateLimiterTest, ShapesHaveSeparateBuckets) {
+    const ShapeRateLimiter::Shape otherQueryHash{"test.coll"_sd, "find"_sd, 0x5678u};
+    const ShapeRateLimiter::Shape otherCommand{"test.coll"_sd, "aggregate"_sd, 0x1234u};
+    const ShapeRateLimiter::Shape otherNs{"test.other"_sd, "find"_sd, 0x1234u};
+    const ShapeRateLimiter::Shape noQueryHash{"test.coll"_sd, "find"_sd, boost::none};
+
+    ShapeRateLimiter limiter;
+    ASSERT_TRUE(limiter.admit(kFindShape, kStart, 1, 1).admitted);
+    ASSERT_FALSE(limiter.admit(kFindShape, kStart, 1, 1).admitted);
+    for (const auto& shape : {otherQueryHash, otherCommand, otherNs, noQueryHash}) {
+        ASSERT_TRUE(limiter.admit(shape, kStart, 1, 1).admitted);
+    }
+}
+
+TEST(ShapeRateLimiterTest, UntrackedShapesShareBucket) {
+    constexpr auto kMaxShapes =
+        ShapeRateLimiter::kNumPartitions * ShapeRateLimiter::kMaxShapesPerPartition;
+
+    // No bucket refills over the test, so none of the shapes can be forgotten.
+    ShapeRateLimiter limiter;
+    std::size_t untracked = 0;
+    for (uint32_t queryHash = 0; queryHash < 2 * kMaxShapes; ++queryHash) {
+        ShapeRateLimiter::Shape shape{"test.coll"_sd, "find"_sd, queryHash};
+        if (!limiter.admit(shape, kStart, 0.001, 1).admitted) {
+            ++untracked;
+        }
+    }
+
+    // Once a partition is full, only its first untracked shape takes the shared token.
+    ASSERT_GTE(untracked, kMaxShapes - ShapeRateLimiter::kNumPartitions);
+
+    BSONObjBuilder builder;
+    limiter.appendStats(&builder, 5);
+    auto stats = builder.obj();
+    ASSERT_LTE(stats["shapes"].numberLong(), static_cast<long long>(kMaxShapes));
+    ASSERT_EQ(stats["untrackedShapesSuppressed"].numberLong(),
+              static_cast<long long>(untracked));
+}
+
+TEST(ShapeRateLimiterTest, IdleShapesAreForgotten) {
+    ShapeRateLimiter limiter;
+    for (uint32_t queryHash = 0; queryHash < 2 * ShapeRateLimiter::kNumPartitions *
+             ShapeRateLimiter::kMaxShapesPerPartition;
+         ++queryHash) {
+        // Each bucket is full again one second after its shape was last seen.
+        ShapeRateLimiter::Shape shape{"test.coll"_sd, "find"_sd, queryHash};
+        ASSERT_TRUE(limiter.admit(shape, kStart + Seconds(queryHash), 1, 1).admitted);
+    }
+}
+
+TEST(ShapeRateLimiterTest, IdleShapeScansAreRateLimited) {
+    constexpr auto kMaxShapes =
+        ShapeRateLimiter::kNumPartitions * ShapeRateLimiter::kMaxShapesPerPartition;
+
+    ShapeRateLimiter limiter;
+    auto admitShapes = [&](uint32_t firstQueryHash, std::size_t numShapes, Date_t now) {
+        for (uint32_t queryHash = firstQueryHash; queryHash < firstQueryHash + numShapes;
+             ++queryHash) {
+            ShapeRateLimiter::Shape shape{"test.coll"_sd, "find"_sd, queryHash};
+            limiter.admit(shape, now, 10, 1);
+        }
+    };
+    auto untrackedShapesSuppressed = [&] {
+        BSONObjBuilder builder;
+        limiter.appendStats(&builder, 0);
+        return builder.obj()["untrackedShapesSuppressed"].numberLong();
+    };
+
+    // Fill every partition. The partitions are scanned for idle shapes once they are full.
+    admitShapes(0, 2 * kMaxShapes, kStart);
+    const auto suppressedWhileFilling = untrackedShapesSuppressed();
+
+    // Every bucket is full again after 100ms, but the partitions were scanned too recently to
+    // forget the shapes, so new shapes are untracked.
+    admitShapes(2 * kMaxShapes, kMaxShapes / 2, kStart + Milliseconds(500));
+    const auto suppressedBeforeScan = untrackedShapesSuppressed();
+    ASSERT_GTE(suppressedBeforeScan - suppressedWhileFilling,
+               static_cast<long long>(kMaxShapes / 2 - ShapeRateLimiter::kNumPartitions));
+
+    // Once the scan interval elapsed, the idle shapes make room for new ones.
+    admitShapes(3 * kMaxShapes, kMaxShapes / 2, kStart + ShapeRateLimiter::kIdleShapeScanInterval);
+    ASSERT_EQ(untrackedShapesSuppressed(), suppressedBeforeScan);
+}
+
+TEST(ShapeRateLimiterTest, AppendStats) {
+    const ShapeRateLimiter::Shape quietShape{"test.coll"_sd, "insert"_sd, boost::none};
+
+    ShapeRateLimiter limiter;
+    for (int i = 0; i < 5; ++i) {
+        limiter.admit(kFindShape, kStart, 1, 2);
+    }
+    limiter.admit(quietShape, kStart, 1, 2);
+
+    BSONObjBuilder builder;
+    limiter.appendStats(&builder, 10);
+    auto stats = builder.obj();
+    ASSERT_EQ(stats["admitted"].numberLong(), 3);
+    ASSERT_EQ(stats["suppressed"].numberLong(), 3);
+    ASSERT_EQ(stats["shapes"].numberLong(), 2);
+
+    // Only the shapes with suppressed operations are reported.
+    auto topSuppressed = stats["topSuppressed"].Array();
+    ASSERT_EQ(topSuppressed.size(), 1U);
+    ASSERT_BSONOBJ_EQ(topSuppressed[0].Obj(),
+                      BSON("ns"
+                           << "test.coll"
+                           << "command"
+                           << "find"
+                           << "queryHash"
+                           << "00001234"
+                           << "admitted" << 2LL << "suppressed" << 3LL));
+}
+
+}  // namespace
+}  // namespace mongo
@@ -43,52 +43,44 @@ namespace mongo {
 using namespace fmt::literals;
 
 void OpCounters::_reset() {
-    _insert->store(0);
-    _query->store(0);
-    _update->store(0);
-    _delete->store(0);
-    _getmore->store(0);
-    _command->store(0);
-    _nestedAggregate->store(0);
-
-    _queryDeprecated->store(0);
-
-    _insertOnExistingDoc->store(0);
-    _updateOnMissingDoc->store(0);
-    _deleteWasEmpty->store(0);
-    _deleteFromMissingNamespace->store(0);
-    _acceptableErrorInCommand->store(0);
-}
-
-void OpCounters::_checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n) {
-    static constexpr auto maxCount = 1LL << 60;
-    auto oldValue = (this->*counter)->fetchAndAddRelaxed(n);
-    if (oldValue > maxCount) {
-        _reset();
-    }
+    _insert.reset();
+    _query.reset();
+    _update.reset();
+    _delete.reset();
+    _getmore.reset();
+    _command.reset();
+    _nestedAggregate.reset();
+
+    _queryDeprecated.reset();
+
+    _insertOnExistingDoc.reset();
+    _updateOnMissingDoc.reset();
+    _deleteWasEmpty.reset();
+    _deleteFromMissingNamespace.reset();
+    _acceptableErrorInCommand.reset();
 }
 
 BSONObj OpCounters::getObj() const {
     BSONObjBuilder b;
-    b.append("insert", _insert->loadRelaxed());
-    b.append("query", _query->loadRelaxed());
-    b.append("update", _update->loadRelaxed());
-    b.append("delete", _delete->loadRelaxed());
-    b.append("getmore", _getmore->loadRelaxed());
-    b.append("command", _command->loadRelaxed());
-
-    auto queryDep = _queryDeprecated->loadRelaxed();
+    b.append("insert", _insert.get());
+    b.append("query", _query.get());
+    b.append("update", _update.get());
+    b.append("delete", _delete.get());
+    b.append("getmore", _getmore.get());
+    b.append("command", _command.get());
+
+    auto queryDep = _queryDeprecated.get();
     if (queryDep > 0) {
         BSONObjBuilder d(b.subobjStart("deprecated"));
         d.append("query", queryDep);
     }
 
     // Append counters for constraint relaxations, only if they exist.
-    auto insertOnExistingDoc = _insertOnExistingDoc->loadRelaxed();
-    auto updateOnMissingDoc = _updateOnMissingDoc->loadRelaxed();
-    auto deleteWasEmpty = _deleteWasEmpty->loadRelaxed();
-    auto deleteFromMissingNamespace = _deleteFromMissingNamespace->loadRelaxed();
-    auto acceptableErrorInCommand = _acceptableErrorInCommand->loadRelaxed();
+    auto insertOnExistingDoc = _insertOnExistingDoc.get();
+    auto updateOnMissingDoc = _updateOnMissingDoc.get();
+    auto deleteWasEmpty = _deleteWasEmpty.get();
+    auto deleteFromMissingNamespace = _deleteFromMissingNamespace.get();
+    auto acceptableErrorInCommand = _acceptableErrorInCommand.get();
     auto totalRelaxed = insertOnExistingDoc + updateOnMissingDoc + deleteWasEmpty +
         deleteFromMissingNamespace + acceptableErrorInCommand;
 
@@ -105,68 +97,31 @@ BSONObj OpCounters::getObj() const {
 }
 
 void NetworkCounter::hitPhysicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesIn->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesIn->store(bytes);
-    } else {
-        _physicalBytesIn->fetchAndAdd(bytes);
-    }
+    _physicalBytesIn.increment(bytes);
 }
 
 void NetworkCounter::hitPhysicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _physicalBytesOut->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _physicalBytesOut->store(bytes);
-    } else {
-        _physicalBytesOut->fetchAndAdd(bytes);
-    }
+    _physicalBytesOut.increment(bytes);
 }
 
 void NetworkCounter::hitLogicalIn(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _together->logicalBytesIn.loadRelaxed() > MAX;
-
-    if (overflow) {
-        _together->logicalBytesIn.store(bytes);
-        // The requests field only gets incremented here (and not in hitPhysical) because the
-        // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
-        // functions would double-count the number of operations.
-        _together->requests.store(1);
-    } else {
-        _together->logicalBytesIn.fetchAndAdd(bytes);
-        _together->requests.fetchAndAdd(1);
-    }
+    _logicalBytesIn.increment(bytes);
+    // The requests field only gets incremented here (and not in hitPhysical) because the
+    // hitLogical and hitPhysical are each called for each operation. Incrementing it in both
+    // functions would double-count the number of operations.
+    _requests.increment();
 }
 
 void NetworkCounter::hitLogicalOut(long long bytes) {
-    static const int64_t MAX = 1ULL << 60;
-
-    // don't care about the race as its just a counter
-    const bool overflow = _logicalBytesOut->loadRelaxed() > MAX;
-
-    if (overflow) {
-        _logicalBytesOut->store(bytes);
-    } else {
-        _logicalBytesOut->fetchAndAdd(bytes);
-    }
+    _logicalBytesOut.increment(bytes);
 }
 
 void NetworkCounter::incrementNumSlowDNSOperations() {
-    _numSlowDNSOperations->fetchAndAdd(1);
+    _numSlowDNSOperations.increment();
 }
 
 void NetworkCounter::incrementNumSlowSSLOperations() {
-    _numSlowSSLOperations->fetchAndAdd(1);
+    _numSlowSSLOperations.increment();
 }
 
 void NetworkCounter::acceptedTFOIngress() {
@@ -174,13 +129,13 @@ void NetworkCounter::acceptedTFOIngress() {
 }
 
 void NetworkCounter::append(BSONObjBuilder& b) {
-    b.append("bytesIn", static_cast<long long>(_together->logicalBytesIn.loadRelaxed()));
-    b.append("bytesOut", static_cast<long long>(_logicalBytesOut->loadRelaxed()));
-    b.append("physicalBytesIn", static_cast<long long>(_physicalBytesIn->loadRelaxed()));
-    b.append("physicalBytesOut", static_cast<long long>(_physicalBytesOut->loadRelaxed()));
-    b.append("numSlowDNSOperations", static_cast<long long>(_numSlowDNSOperations->loadRelaxed()));
-    b.append("numSlowSSLOperations", static_cast<long long>(_numSlowSSLOperations->loadRelaxed()));
-    b.append("numRequests", static_cast<long long>(_together->requests.loadRelaxed()));
+    b.append("bytesIn", _logicalBytesIn.get());
+    b.append("bytesOut", _logicalBytesOut.get());
+    b.append("physicalBytesIn", _physicalBytesIn.get());
+    b.append("physicalBytesOut", _physicalBytesOut.get());
+    b.append("numSlowDNSOperations", _numSlowDNSOperations.get());
+    b.append("numSlowSSLOperations", _numSlowSSLOperations.get());
+    b.append("numRequests", _requests.get());
 
     BSONObjBuilder tfo;
 #ifdef __linux__
@@ -31,6 +31,7 @@
 
 #include <map>
 
+#include "mongo/base/counter.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/platform/atomic_word.h"
@@ -45,40 +46,41 @@ namespace mongo {
 
 /**
  * for storing operation counters
- * note: not thread safe.  ok with that for speed
+ * Counters are striped, so that operations running on different cores do not contend on the same
+ * cache lines. Reading a counter sums its stripes.
  */
 class OpCounters {
 public:
     OpCounters() = default;
 
     void gotInserts(int n) {
-        _checkWrap(&OpCounters::_insert, n);
+        _insert.increment(n);
     }
     void gotInsert() {
-        _checkWrap(&OpCounters::_insert, 1);
+        _insert.increment();
     }
     void gotQuery() {
-        _checkWrap(&OpCounters::_query, 1);
+        _query.increment();
     }
     void gotUpdate() {
-        _checkWrap(&OpCounters::_update, 1);
+        _update.increment();
     }
     void gotDelete() {
-        _checkWrap(&OpCounters::_delete, 1);
+        _delete.increment();
     }
     void gotGetMore() {
-        _checkWrap(&OpCounters::_getmore, 1);
+        _getmore.increment();
     }
     void gotCommand() {
-        _checkWrap(&OpCounters::_command, 1);
+        _command.increment();
     }
 
     void gotQueryDeprecated() {
-        _checkWrap(&OpCounters::_queryDeprecated, 1);
+        _queryDeprecated.increment();
     }
 
     void gotNestedAggregate() {
-        _checkWrap(&OpCounters::_nestedAggregate, 1);
+        _nestedAggregate.increment();
     }
 
     BSONObj getObj() const;
@@ -86,57 +88,57 @@ public:
     // These opcounters record operations that would fail if we were fully enforcing our consistency
     // constraints in steady-state oplog application mode.
     void gotInsertOnExistingDoc() {
-        _checkWrap(&OpCounters::_insertOnExistingDoc, 1);
+        _insertOnExistingDoc.increment();
     }
     void gotUpdateOnMissingDoc() {
-        _checkWrap(&OpCounters::_updateOnMissingDoc, 1);
+        _updateOnMissingDoc.increment();
     }
     void gotDeleteWasEmpty() {
-        _checkWrap(&OpCounters::_deleteWasEmpty, 1);
+        _deleteWasEmpty.increment();
     }
     void gotDeleteFromMissingNamespace() {
-        _checkWrap(&OpCounters::_deleteFromMissingNamespace, 1);
+        _deleteFromMissingNamespace.increment();
     }
     void gotAcceptableErrorInCommand() {
-        _checkWrap(&OpCounters::_acceptableErrorInCommand, 1);
+        _acceptableErrorInCommand.increment();
     }
 
     // thse are used by metrics things, do not remove
-    const AtomicWord<long long>* getInsert() const {
-        return &*_insert;
+    long long getInsert() const {
+        return _insert.get();
     }
-    const AtomicWord<long long>* getQuery() const {
-        return &*_query;
+    long long getQuery() const {
+        return _query.get();
     }
-    const AtomicWord<long long>* getUpdate() const {
-        return &*_update;
+    long long getUpdate() const {
+        return _update.get();
     }
-    const AtomicWord<long long>* getDelete() const {
-        return &*_delete;
+    long long getDelete() const {
+        return _delete.get();
     }
-    const AtomicWord<long long>* getGetMore() const {
-        return &*_getmore;
+    long long getGetMore() const {
+        return _getmore.get();
     }
-    const AtomicWord<long long>* getCommand() const {
-        return &*_command;
+    long long getCommand() const {
+        return _command.get();
     }
-    const AtomicWord<long long>* getNestedAggregate() const {
-        return &*_nestedAggregate;
+    long long getNestedAggregate() const {
+        return _nestedAggregate.get();
     }
-    const AtomicWord<long long>* getInsertOnExistingDoc() const {
-        return &*_insertOnExistingDoc;
+    long long getInsertOnExistingDoc() const {
+        return _insertOnExistingDoc.get();
     }
-    const AtomicWord<long long>* getUpdateOnMissingDoc() const {
-        return &*_updateOnMissingDoc;
+    long long getUpdateOnMissingDoc() const {
+        return _updateOnMissingDoc.get();
     }
-    const AtomicWord<long long>* getDeleteWasEmpty() const {
-        return &*_deleteWasEmpty;
+    long long getDeleteWasEmpty() const {
+        return _deleteWasEmpty.get();
     }
-    const AtomicWord<long long>* getDeleteFromMissingNamespace() const {
-        return &*_deleteFromMissingNamespace;
+    long long getDeleteFromMissingNamespace() const {
+        return _deleteFromMissingNamespace.get();
     }
-    const AtomicWord<long long>* getAcceptableErrorInCommand() const {
-        return &*_acceptableErrorInCommand;
+    long long getAcceptableErrorInCommand() const {
+        return _acceptableErrorInCommand.get();
     }
 
     // Reset all counters. To used for testing purposes only.
@@ -148,25 +150,22 @@ private:
     // Reset all counters.
     void _reset();
 
-    // Increment member `counter` by `n`, resetting all counters if it was > 2^60.
-    void _checkWrap(CacheExclusive<AtomicWord<long long>> OpCounters::*counter, int n);
+    StripedCounter64 _insert;
+    StripedCounter64 _query;
+    StripedCounter64 _update;
+    StripedCounter64 _delete;
+    StripedCounter64 _getmore;
+    StripedCounter64 _command;
+    StripedCounter64 _nestedAggregate;
 
-    CacheExclusive<AtomicWord<long long>> _insert;
-    CacheExclusive<AtomicWord<long long>> _query;
-    CacheExclusive<AtomicWord<long long>> _update;
-    CacheExclusive<AtomicWord<long long>> _delete;
-    CacheExclusive<AtomicWord<long long>> _getmore;
-    CacheExclusive<AtomicWord<long long>> _command;
-    CacheExclusive<AtomicWord<long long>> _nestedAggregate;
-
-    CacheExclusive<AtomicWord<long long>> _insertOnExistingDoc;
-    CacheExclusive<AtomicWord<long long>> _updateOnMissingDoc;
-    CacheExclusive<AtomicWord<long long>> _deleteWasEmpty;
-    CacheExclusive<AtomicWord<long long>> _deleteFromMissingNamespace;
-    CacheExclusive<AtomicWord<long long>> _acceptableErrorInCommand;
+    StripedCounter64 _insertOnExistingDoc;
+    StripedCounter64 _updateOnMissingDoc;
+    StripedCounter64 _deleteWasEmpty;
+    StripedCounter64 _deleteFromMissingNamespace;
+    StripedCounter64 _acceptableErrorInCommand;
 
     // Counter for the deprecated OP_QUERY opcode.
-    CacheExclusive<AtomicWord<long long>> _queryDeprecated;
+    StripedCounter64 _queryDeprecated;
 };
 
 extern OpCounters globalOpCounters;
@@ -207,25 +206,15 @@ public:
     void append(BSONObjBuilder& b);
 
 private:
-    CacheExclusive<AtomicWord<long long>> _physicalBytesIn{0};
-    CacheExclusive<AtomicWord<long long>> _physicalBytesOut{0};
-
-    // These two counters are always incremented at the same time, so
-    // we place them on the same cache line. We use
-    // CacheCombinedExclusive to ensure that they are combined within
-    // the scope of a constructive interference region, and protected
-    // from false sharing by padding out to destructive interference
-    // size.
-    struct Together {
-        AtomicWord<long long> logicalBytesIn{0};
-        AtomicWord<long long> requests{0};
-    };
-    CacheCombinedExclusive<Together> _together{};
+    StripedCounter64 _physicalBytesIn;
+    StripedCounter64 _physicalBytesOut;
 
-    CacheExclusive<AtomicWord<long long>> _logicalBytesOut{0};
+    StripedCounter64 _logicalBytesIn;
+    StripedCounter64 _requests;
+    StripedCounter64 _logicalBytesOut;
 
-    CacheExclusive<AtomicWord<long long>> _numSlowDNSOperations{0};
-    CacheExclusive<AtomicWord<long long>> _numSlowSSLOperations{0};
+    StripedCounter64 _numSlowDNSOperations;
+    StripedCounter64 _numSlowSSLOperations;
 
     // Counter of inbound connections at runtime.
     CacheExclusive<AtomicWord<std::int64_t>> _tfoAccepted{0};
@@ -29,6 +29,9 @@
 
 #include "mongo/platform/basic.h"
 
+#include <map>
+
+#include "mongo/db/commands.h"
 #include "mongo/db/commands/server_status.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/operation_context.h"
@@ -37,7 +40,11 @@
 namespace mongo {
 namespace {
 /**
- * Appends the global histogram to the server status.
+ * Appends the global histogram to the server status and, if requested with {byCommand: true}, the
+ * operation counts, latency totals and percentiles of every command that ran at least once.
+ *
+ * The commands are only reported on request because the fields of 'byCommand' change whenever a
+ * command runs for the first time, which would change the schema of the FTDC samples.
  */
 class GlobalHistogramServerStatusSection final : public ServerStatusSection {
 public:
@@ -51,14 +58,46 @@ public:
         BSONObjBuilder latencyBuilder;
         bool includeHistograms = false;
         bool slowBuckets = false;
+        bool byCommand = false;
         if (configElem.type() == BSONType::Object) {
             includeHistograms = configElem.Obj()["histograms"].trueValue();
             slowBuckets = configElem.Obj()["slowBuckets"].trueValue();
+            byCommand = configElem.Obj()["byCommand"].trueValue();
         }
         Top::get(opCtx->getServiceContext())
             .appendGlobalLatencyStats(includeHistograms, slowBuckets, &latencyBuilder);
+        if (byCommand) {
+            appendCommandLatencyStats(includeHistograms && !slowBuckets, &latencyBuilder);
+        }
         return latencyBuilder.obj();
     }
+
+private:
+    static void appendCommandLatencyStats(bool includeHistograms, BSONObjBuilder* builder) {
+        // Sorted so that the layout of the section only changes when a command first runs.
+        std::map<StringData, const Command*> commands;
+        for (const auto& [name, command] : globalCommandRegistry()->allCommands()) {
+            // Skip aliases, which map to the same command.
+            if (name == command->getName()) {
+                commands.emplace(command->getName(), command);
+            }
+        }
+
+        BSONObjBuilder byCommandBuilder(builder->subobjStart("byCommand"));
+        for (const auto& [name, command] : commands) {
+            HdrHistogram histogram;
+            command->mergeLatencyHistogramInto(&histogram);
+            const auto ops = histogram.count();
+            if (ops == 0) {
+                continue;
+            }
+
+            BSONObjBuilder commandBuilder(byCommandBuilder.subobjStart(name));
+            commandBuilder.append("latency", static_cast<long long>(histogram.sum()));
+            commandBuilder.append("ops", static_cast<long long>(ops));
+            histogram.append(includeHistograms, &commandBuilder);
+        }
+    }
 } globalHistogramServerStatusSection;
 }  // namespace
 }  // namespace mongo
@@ -106,7 +106,8 @@ void OperationLatencyHistogram::_append(const HistogramData& data,
     if (includeHistograms) {
         BSONArrayBuilder arrayBuilder(histogramBuilder.subarrayStart("histogram"));
         for (size_t i = 0; i < kMaxBuckets; i++) {
-            if (data.buckets[i] == 0) {
+            const uint64_t count = data.buckets[i].loadRelaxed();
+            if (count == 0) {
                 continue;
             }
 
@@ -117,13 +118,13 @@ void OperationLatencyHistogram::_append(const HistogramData& data,
                     lowestFilteredBound = kLowerBounds[i];
                 }
 
-                filteredCount += data.buckets[i];
+                filteredCount += count;
                 continue;
             }
 
             BSONObjBuilder entryBuilder(arrayBuilder.subobjStart());
             entryBuilder.append("micros", static_cast<long long>(kLowerBounds[i]));
-            entryBuilder.append("count", static_cast<long long>(data.buckets[i]));
+            entryBuilder.append("count", static_cast<long long>(count));
             entryBuilder.doneFast();
         }
 
@@ -140,10 +141,11 @@ void OperationLatencyHistogram::_append(const HistogramData& data,
         arrayBuilder.doneFast();
     }
 
-    histogramBuilder.append("latency", static_cast<long long>(data.sum));
-    histogramBuilder.append("ops", static_cast<long long>(data.entryCount));
+    histogramBuilder.append("latency", static_cast<long long>(data.sum.loadRelaxed()));
+    histogramBuilder.append("ops", static_cast<long long>(data.entryCount.loadRelaxed()));
     histogramBuilder.append("queryableEncryptionLatencyMicros",
-                            static_cast<long long>(data.sumQueryableEncryption));
+                            static_cast<long long>(data.sumQueryableEncryption.loadRelaxed()));
+    data.hdr.append(includeHistograms && !slowMSBucketsOnly, &histogramBuilder);
     histogramBuilder.doneFast();
 }
 
@@ -156,6 +158,23 @@ void OperationLatencyHistogram::append(bool includeHistograms,
     _append(_transactions, "transactions", includeHistograms, slowMSBucketsOnly, builder);
 }
 
+void OperationLatencyHistogram::_mergeData(const HistogramData& from, HistogramData* into) {
+    for (size_t i = 0; i < kMaxBuckets; i++) {
+        into->buckets[i].fetchAndAddRelaxed(from.buckets[i].loadRelaxed());
+    }
+    into->entryCount.fetchAndAddRelaxed(from.entryCount.loadRelaxed());
+    into->sum.fetchAndAddRelaxed(from.sum.loadRelaxed());
+    into->sumQueryableEncryption.fetchAndAddRelaxed(from.sumQueryableEncryption.loadRelaxed());
+    into->hdr.merge(from.hdr);
+}
+
+void OperationLatencyHistogram::merge(const OperationLatencyHistogram& other) {
+    _mergeData(other._reads, &_reads);
+    _mergeData(other._writes, &_writes);
+    _mergeData(other._commands, &_commands);
+    _mergeData(other._transactions, &_transactions);
+}
+
 // Computes the log base 2 of value, and checks for cases of split buckets.
 int OperationLatencyHistogram::_getBucket(uint64_t value) {
     // Zero is a special case since log(0) is undefined.
@@ -187,12 +206,13 @@ void OperationLatencyHistogram::_incrementData(uint64_t latency,
                                                int bucket,
                                                bool isQuerableEncryptionOperation,
                                                HistogramData* data) {
-    data->buckets[bucket]++;
-    data->entryCount++;
-    data->sum += latency;
+    data->buckets[bucket].fetchAndAddRelaxed(1);
+    data->entryCount.fetchAndAddRelaxed(1);
+    data->sum.fetchAndAddRelaxed(latency);
+    data->hdr.record(latency);
 
     if (isQuerableEncryptionOperation) {
-        data->sumQueryableEncryption += latency;
+        data->sumQueryableEncryption.fetchAndAddRelaxed(latency);
     }
 }
 
@@ -31,6 +31,8 @@
 #include <array>
 
 #include "mongo/db/commands.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/hdr_histogram.h"
 
 namespace mongo {
 
@@ -40,7 +42,12 @@ class BSONObjBuilder;
  * Stores statistics for latencies of read, write, command, and multi-document transaction
  * operations.
  *
- * Note: This class is not thread-safe.
+ * Besides the coarse buckets of kLowerBounds, every latency is also recorded in a high-resolution
+ * HdrHistogram, from which the percentiles of each operation type are reported.
+ *
+ * Increments may happen concurrently with each other and with append(). Every counter is updated
+ * independently with relaxed atomics, so an append() concurrent with increments may observe an
+ * operation in some counters but not yet in others.
  */
 class OperationLatencyHistogram {
 public:
@@ -57,19 +64,30 @@ public:
                    bool isQuerableEncryptionOperation);
 
     /**
-     * Appends the four histograms with latency totals and operation counts.
+     * Adds the bucket counts and latency totals of 'other' to this histogram. Used to combine
+     * histograms that are updated separately, e.g. per stripe, before appending them.
+     */
+    void merge(const OperationLatencyHistogram& other);
+
+    /**
+     * Appends the four histograms with latency totals, operation counts and percentiles. The
+     * high-resolution buckets are only included with 'includeHistograms' and without
+     * 'slowMSBucketsOnly'.
      */
     void append(bool includeHistograms, bool slowMSBucketsOnly, BSONObjBuilder* builder) const;
 
 private:
     struct HistogramData {
-        std::array<uint64_t, kMaxBuckets> buckets{};
-        uint64_t entryCount = 0;
-        uint64_t sum = 0;
+        std::array<AtomicWord<uint64_t>, kMaxBuckets> buckets;
+        AtomicWord<uint64_t> entryCount;
+        AtomicWord<uint64_t> sum;
         // Sum of latency time spent doing Queryable Encryption operations
-        uint64_t sumQueryableEncryption = 0;
+        AtomicWord<uint64_t> sumQueryableEncryption;
+        HdrHistogram hdr;
     };
 
+    static void _mergeData(const HistogramData& from, HistogramData* into);
+
     static int _getBucket(uint64_t latency);
 
     static uint64_t _getBucketMicros(int bucket);
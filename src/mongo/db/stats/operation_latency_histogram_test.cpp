@@ -38,6 +38,7 @@
 
 #include "mongo/db/commands.h"
 #include "mongo/db/jsobj.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/unittest.h"
 
 namespace mongo {
@@ -174,4 +175,79 @@ TEST(OperationLatencyHistogram, CheckBucketCountsAndTotalLatencyQueryableEncrypt
     }
 }
 
+TEST(OperationLatencyHistogram, MergeAddsCountsAndLatencies) {
+    OperationLatencyHistogram first, second;
+    first.increment(kLowerBounds[3], Command::ReadWriteType::kRead, false);
+    second.increment(kLowerBounds[3], Command::ReadWriteType::kRead, true);
+    second.increment(kLowerBounds[5], Command::ReadWriteType::kWrite, false);
+    first.merge(second);
+
+    BSONObjBuilder outBuilder;
+    first.append(true, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), 2);
+    ASSERT_EQUALS(static_cast<uint64_t>(out["reads"]["latency"].Long()), 2 * kLowerBounds[3]);
+    ASSERT_EQUALS(static_cast<uint64_t>(out["reads"]["queryableEncryptionLatencyMicros"].Long()),
+                  kLowerBounds[3]);
+    ASSERT_EQUALS(out["reads"]["histogram"].Array()[0].Obj()["count"].Long(), 2);
+    ASSERT_EQUALS(out["writes"]["ops"].Long(), 1);
+}
+
+TEST(OperationLatencyHistogram, AppendsHighResolutionPercentiles) {
+    OperationLatencyHistogram hist;
+    for (uint64_t latency = 1; latency <= 1000; latency++) {
+        hist.increment(latency, Command::ReadWriteType::kWrite, false);
+    }
+
+    BSONObjBuilder outBuilder;
+    hist.append(true, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    BSONObj percentiles = out["writes"]["percentiles"].Obj();
+    ASSERT_APPROX_EQUAL(percentiles["p50"].Long(), 500, 500 / 16);
+    ASSERT_APPROX_EQUAL(percentiles["p99"].Long(), 990, 990 / 16);
+    ASSERT_EQUALS(percentiles["max"].Long(), 1000);
+    ASSERT_EQUALS(out["reads"]["percentiles"]["p50"].Long(), 0);
+
+    long long bucketTotal = 0;
+    for (const auto& bucket : out["writes"]["hdrHistogram"].Array()) {
+        bucketTotal += bucket.Obj()["count"].Long();
+    }
+    ASSERT_EQUALS(bucketTotal, 1000);
+
+    // Only the percentiles are reported along with the slow buckets.
+    BSONObjBuilder slowBuilder;
+    hist.append(true, true, &slowBuilder);
+    BSONObj slow = slowBuilder.done();
+    ASSERT_EQUALS(slow["writes"]["percentiles"]["max"].Long(), 1000);
+    ASSERT(slow["writes"]["hdrHistogram"].eoo());
+}
+
+TEST(OperationLatencyHistogram, ConcurrentIncrements) {
+    const int kThreads = 8;
+    const int kIncrementsPerThread = 10000;
+    OperationLatencyHistogram hist;
+
+    std::vector<stdx::thread> threads;
+    for (int t = 0; t < kThreads; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < kIncrementsPerThread; i++) {
+                hist.increment(i % 100, Command::ReadWriteType::kRead, false);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    BSONObjBuilder outBuilder;
+    hist.append(true, false, &outBuilder);
+    BSONObj out = outBuilder.done();
+    ASSERT_EQUALS(out["reads"]["ops"].Long(), kThreads * kIncrementsPerThread);
+    long long bucketTotal = 0;
+    for (const auto& bucket : out["reads"]["histogram"].Array()) {
+        bucketTotal += bucket.Obj()["count"].Long();
+    }
+    ASSERT_EQUALS(bucketTotal, kThreads * kIncrementsPerThread);
+}
+
 }  // namespace mongo
@@ -32,6 +32,9 @@
 
 #include "mongo/db/stats/top.h"
 
+#include <limits>
+
+#include "mongo/db/catalog/collection.h"
 #include "mongo/db/curop.h"
 #include "mongo/db/jsobj.h"
 #include "mongo/db/service_context.h"
@@ -65,67 +68,116 @@ bool isQuerableEncryptionOperation(OperationContext* opCtx) {
     return false;
 }
 
-}  // namespace
+/**
+ * The Top statistics of a collection, cached on the decorations shared by all the instances of the
+ * collection.
+ */
+struct CachedCollectionData {
+    struct Entry {
+        std::string ns;
+        Top::CollectionDataHandle data;
+    };
+
+    AtomicWord<const Entry*> latest{nullptr};
+
+    Mutex mutex = MONGO_MAKE_LATCH("CachedCollectionData::mutex");
 
-Top::UsageData::UsageData(const UsageData& older, const UsageData& newer) {
-    // this won't be 100% accurate on rollovers and drop(), but at least it won't be negative
-    time = (newer.time >= older.time) ? (newer.time - older.time) : newer.time;
-    count = (newer.count >= older.count) ? (newer.count - older.count) : newer.count;
+    // Every entry resolved for the collection, since operations may still be recording into the
+    // older ones. A new entry is only resolved after the collection is renamed or its statistics
+    // are dropped from Top, so there are few of them.
+    std::vector<std::unique_ptr<Entry>> entries;
+};
+
+const auto getCachedCollectionData =
+    SharedCollectionDecorations::declareDecoration<CachedCollectionData>();
+
+// Only operations which came from a user are recorded in the latency histograms.
+bool isUserOperation(OperationContext* opCtx) {
+    Client* client = opCtx->getClient();
+    return client->isFromUserConnection() && !client->isInDirectClient();
 }
 
-Top::CollectionData::CollectionData(const CollectionData& older, const CollectionData& newer)
-    : total(older.total, newer.total),
-      readLock(older.readLock, newer.readLock),
-      writeLock(older.writeLock, newer.writeLock),
-      queries(older.queries, newer.queries),
-      getmore(older.getmore, newer.getmore),
-      insert(older.insert, newer.insert),
-      update(older.update, newer.update),
-      remove(older.remove, newer.remove),
-      commands(older.commands, newer.commands) {}
+}  // namespace
 
 // static
 Top& Top::get(ServiceContext* service) {
     return getTop(service);
 }
 
-void Top::record(OperationContext* opCtx,
-                 StringData ns,
-                 LogicalOp logicalOp,
-                 LockType lockType,
-                 long long micros,
-                 bool command,
-                 Command::ReadWriteType readWriteType) {
+Top::UsageMapShard& Top::_getShard(StringData ns) {
+    const size_t hash = UsageMap::hasher()(ns);
+    return *_usageShards[hash >> (std::numeric_limits<size_t>::digits - kUsageMapShardBits)];
+}
+
+Top::CollectionDataHandle Top::_findCollectionData(StringData ns) {
+    auto& shard = _getShard(ns);
+    stdx::lock_guard<Latch> lk(shard.mutex);
+    auto it = shard.usage.find(ns);
+    return it == shard.usage.end() ? nullptr : it->second;
+}
+
+Top::CollectionDataHandle Top::getCollectionData(StringData ns) {
     if (ns[0] == '?')
-        return;
+        return nullptr;
+
+    auto& shard = _getShard(ns);
+    stdx::lock_guard<Latch> lk(shard.mutex);
+    auto& coll = shard.usage[ns];
+    if (!coll) {
+        coll = std::make_shared<CollectionData>();
+    }
+    return coll;
+}
+
+Top::CollectionData* Top::getCollectionData(const Collection& collection) {
+    auto& cache = getCachedCollectionData(collection.getSharedDecorations());
+    const auto ns = collection.ns().ns();
+    const auto isCurrent = [&](const CachedCollectionData::Entry* entry) {
+        return entry && !entry->data->isDropped.load() && entry->ns == ns;
+    };
+
+    if (auto entry = cache.latest.load(); isCurrent(entry)) {
+        return entry->data.get();
+    }
+
+    stdx::lock_guard<Latch> lk(cache.mutex);
+    if (auto entry = cache.latest.load(); isCurrent(entry)) {
+        return entry->data.get();
+    }
 
-    auto hashedNs = UsageMap::hasher().hashed_key(ns);
-    stdx::lock_guard<Latch> lk(_lock);
+    auto data = getCollectionData(ns);
+    if (!data) {
+        return nullptr;
+    }
 
-    CollectionData& coll = _usage[hashedNs];
-    _record(opCtx, coll, logicalOp, lockType, micros, readWriteType);
+    cache.entries.push_back(
+        std::make_unique<CachedCollectionData::Entry>(CachedCollectionData::Entry{
+            ns.toString(), std::move(data)}));
+    cache.latest.store(cache.entries.back().get());
+    return cache.entries.back()->data.get();
 }
 
 void Top::record(OperationContext* opCtx,
-                 const std::set<NamespaceString>& nssSet,
+                 StringData ns,
                  LogicalOp logicalOp,
                  LockType lockType,
                  long long micros,
                  bool command,
                  Command::ReadWriteType readWriteType) {
-    for (const auto& nss : nssSet) {
-        record(opCtx, nss.ns(), logicalOp, lockType, micros, command, readWriteType);
+    if (auto coll = getCollectionData(ns)) {
+        record(opCtx, *coll, logicalOp, lockType, micros, readWriteType);
     }
 }
 
-void Top::_record(OperationContext* opCtx,
-                  CollectionData& c,
-                  LogicalOp logicalOp,
-                  LockType lockType,
-                  long long micros,
-                  Command::ReadWriteType readWriteType) {
-    if (c.isStatsRecordingAllowed) {
-        c.isStatsRecordingAllowed = !CurOp::get(opCtx)->debug().shouldOmitDiagnosticInformation;
+void Top::record(OperationContext* opCtx,
+                 CollectionData& c,
+                 LogicalOp logicalOp,
+                 LockType lockType,
+                 long long micros,
+                 Command::ReadWriteType readWriteType) {
+    if (c.isStatsRecordingAllowed.loadRelaxed() &&
+        CurOp::get(opCtx)->debug().shouldOmitDiagnosticInformation) {
+        c.isStatsRecordingAllowed.store(false);
     }
 
     _incrementHistogram(opCtx, micros, &c.opLatencyHistogram, readWriteType);
@@ -167,33 +219,37 @@ void Top::_record(OperationContext* opCtx,
 }
 
 void Top::collectionDropped(const NamespaceString& nss) {
-    stdx::lock_guard<Latch> lk(_lock);
-    _usage.erase(nss.ns());
+    auto& shard = _getShard(nss.ns());
+    stdx::lock_guard<Latch> lk(shard.mutex);
+    if (auto it = shard.usage.find(nss.ns()); it != shard.usage.end()) {
+        it->second->isDropped.store(true);
+        shard.usage.erase(it);
+    }
 }
 
 void Top::append(BSONObjBuilder& b) {
-    stdx::lock_guard<Latch> lk(_lock);
-    _appendToUsageMap(b, _usage);
-}
-
-void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
-    // pull all the names into a vector so we can sort them for the user
-
-    vector<string> names;
-    for (UsageMap::const_iterator i = map.begin(); i != map.end(); ++i) {
-        names.push_back(i->first);
+    // pull all the names into a vector so we can sort them for the user. Only the shards are
+    // locked, one at a time, and the statistics are read while operations keep recording.
+    vector<std::pair<string, CollectionDataHandle>> entries;
+    for (auto& shard : _usageShards) {
+        stdx::lock_guard<Latch> lk(shard->mutex);
+        for (const auto& [ns, coll] : shard->usage) {
+            entries.emplace_back(ns, coll);
+        }
     }
 
-    std::sort(names.begin(), names.end());
+    std::sort(entries.begin(), entries.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.first < rhs.first;
+    });
 
-    for (size_t i = 0; i < names.size(); i++) {
-        BSONObjBuilder bb(b.subobjStart(names[i]));
+    for (const auto& [name, collPtr] : entries) {
+        BSONObjBuilder bb(b.subobjStart(name));
 
-        const CollectionData& coll = map.find(names[i])->second;
-        auto pos = names[i].find('.');
-        auto nss = NamespaceString(names[i].substr(0, pos), names[i].substr(pos + 1));
+        const CollectionData& coll = *collPtr;
+        auto pos = name.find('.');
+        auto nss = NamespaceString(name.substr(0, pos), name.substr(pos + 1));
 
-        if (coll.isStatsRecordingAllowed && !nss.isFLE2StateCollection()) {
+        if (coll.isStatsRecordingAllowed.loadRelaxed() && !nss.isFLE2StateCollection()) {
             _appendStatsEntry(b, "total", coll.total);
 
             _appendStatsEntry(b, "readLock", coll.readLock);
@@ -212,18 +268,20 @@ void Top::_appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const {
 
 void Top::_appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const {
     BSONObjBuilder bb(b.subobjStart(statsName));
-    bb.appendNumber("time", map.time);
-    bb.appendNumber("count", map.count);
+    bb.appendNumber("time", map.time.loadRelaxed());
+    bb.appendNumber("count", map.count.loadRelaxed());
     bb.done();
 }
 
 void Top::appendLatencyStats(const NamespaceString& nss,
                              bool includeHistograms,
                              BSONObjBuilder* builder) {
-    auto hashedNs = UsageMap::hasher().hashed_key(nss.ns());
-    stdx::lock_guard<Latch> lk(_lock);
     BSONObjBuilder latencyStatsBuilder;
-    _usage[hashedNs].opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    if (auto coll = _findCollectionData(nss.ns())) {
+        coll->opLatencyHistogram.append(includeHistograms, false, &latencyStatsBuilder);
+    } else {
+        OperationLatencyHistogram().append(includeHistograms, false, &latencyStatsBuilder);
+    }
     builder->append("ns", NamespaceStringUtil::serialize(nss));
     builder->append("latencyStats", latencyStatsBuilder.obj());
 }
@@ -234,20 +292,24 @@ void Top::incrementGlobalLatencyStats(OperationContext* opCtx,
     if (!opCtx->shouldIncrementLatencyStats())
         return;
 
-    stdx::lock_guard<Latch> guard(_lock);
-    _incrementHistogram(opCtx, latency, &_globalHistogramStats, readWriteType);
+    _incrementHistogram(opCtx, latency, &_globalHistogramStats.local(), readWriteType);
+
+    if (auto command = CurOp::get(opCtx)->getCommand(); command && isUserOperation(opCtx)) {
+        command->recordLatency(latency);
+    }
 }
 
 void Top::appendGlobalLatencyStats(bool includeHistograms,
                                    bool slowMSBucketsOnly,
                                    BSONObjBuilder* builder) {
-    stdx::lock_guard<Latch> guard(_lock);
-    _globalHistogramStats.append(includeHistograms, slowMSBucketsOnly, builder);
+    OperationLatencyHistogram combined;
+    _globalHistogramStats.forEach(
+        [&](const OperationLatencyHistogram& stripe) { combined.merge(stripe); });
+    combined.append(includeHistograms, slowMSBucketsOnly, builder);
 }
 
 void Top::incrementGlobalTransactionLatencyStats(OperationContext* opCtx, uint64_t latency) {
-    stdx::lock_guard<Latch> guard(_lock);
-    _globalHistogramStats.increment(
+    _globalHistogramStats.local().increment(
         latency, Command::ReadWriteType::kTransaction, isQuerableEncryptionOperation(opCtx));
 }
 
@@ -255,9 +317,7 @@ void Top::_incrementHistogram(OperationContext* opCtx,
                               long long latency,
                               OperationLatencyHistogram* histogram,
                               Command::ReadWriteType readWriteType) {
-    // Only update histogram if operation came from a user.
-    Client* client = opCtx->getClient();
-    if (client->isFromUserConnection() && !client->isInDirectClient()) {
+    if (isUserOperation(opCtx)) {
         histogram->increment(latency, readWriteType, isQuerableEncryptionOperation(opCtx));
     }
 }
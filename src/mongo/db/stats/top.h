@@ -33,20 +33,30 @@
  * DB usage monitor.
  */
 
+#include <array>
 #include <boost/date_time/posix_time/posix_time.hpp>
+#include <memory>
 
+#include "mongo/base/counter.h"
 #include "mongo/db/commands.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/stats/operation_latency_histogram.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
 #include "mongo/util/concurrency/mutex.h"
 #include "mongo/util/string_map.h"
 
 namespace mongo {
 
+class Collection;
 class ServiceContext;
 
 /**
  * tracks usage by collection
+ *
+ * Recording is lock-free: the statistics of a namespace are updated with relaxed atomics, and the
+ * global latency histogram is striped per core. Only registering a namespace, which happens once
+ * per operation, takes the mutex of the shard of the usage map the namespace hashes to.
  */
 class Top {
 public:
@@ -55,24 +65,16 @@ public:
     Top() = default;
 
     struct UsageData {
-        UsageData() : time(0), count(0) {}
-        UsageData(const UsageData& older, const UsageData& newer);
-        long long time;
-        long long count;
+        AtomicWord<long long> time;
+        AtomicWord<long long> count;
 
         void inc(long long micros) {
-            count++;
-            time += micros;
+            count.fetchAndAddRelaxed(1);
+            time.fetchAndAddRelaxed(micros);
         }
     };
 
     struct CollectionData {
-        /**
-         * constructs a diff
-         */
-        CollectionData() {}
-        CollectionData(const CollectionData& older, const CollectionData& newer);
-
         UsageData total;
 
         UsageData readLock;
@@ -86,31 +88,59 @@ public:
         UsageData commands;
         OperationLatencyHistogram opLatencyHistogram;
 
-        bool isStatsRecordingAllowed{true};
+        AtomicWord<bool> isStatsRecordingAllowed{true};
+
+        // Set when the namespace is dropped from Top, so that handles cached on a collection are
+        // resolved again.
+        AtomicWord<bool> isDropped{false};
     };
 
+    /**
+     * A pre-resolved reference to the statistics of one namespace, which operations obtain once
+     * when they acquire the namespace and then record into without looking it up again. A handle
+     * outlives the drop of its namespace, but what is recorded through it afterwards is no longer
+     * reported.
+     */
+    using CollectionDataHandle = std::shared_ptr<CollectionData>;
+
     enum class LockType {
         ReadLocked,
         WriteLocked,
         NotLocked,
     };
 
-    typedef StringMap<CollectionData> UsageMap;
+    typedef StringMap<CollectionDataHandle> UsageMap;
 
 public:
+    /**
+     * Returns the statistics of namespace 'ns', registering it if necessary, or nullptr if 'ns' is
+     * not tracked.
+     */
+    CollectionDataHandle getCollectionData(StringData ns);
+
+    /**
+     * Returns the statistics of 'collection', or nullptr if its namespace is not tracked. The
+     * handle is cached on the decorations the instances of the collection share, so this neither
+     * takes a lock nor copies the handle once it is cached. The statistics live at least as long as
+     * 'collection'.
+     */
+    CollectionData* getCollectionData(const Collection& collection);
+
+    /**
+     * Records an operation against the namespace whose statistics are 'coll'.
+     */
     void record(OperationContext* opCtx,
-                StringData ns,
+                CollectionData& coll,
                 LogicalOp logicalOp,
                 LockType lockType,
                 long long micros,
-                bool command,
                 Command::ReadWriteType readWriteType);
 
     /**
-     * Same as the above, but for multiple namespaces.
+     * Same as the above, but resolves the statistics of 'ns' first.
      */
     void record(OperationContext* opCtx,
-                const std::set<NamespaceString>& nssSet,
+                StringData ns,
                 LogicalOp logicalOp,
                 LockType lockType,
                 long long micros,
@@ -119,8 +149,6 @@ public:
 
     void append(BSONObjBuilder& b);
 
-    void cloneMap(UsageMap& out) const;
-
     void collectionDropped(const NamespaceString& nss);
 
     /**
@@ -131,7 +159,8 @@ public:
                             BSONObjBuilder* builder);
 
     /**
-     * Increments the global histogram only if the operation came from a user.
+     * Increments the global histogram, and the latency histogram of the command the operation ran,
+     * only if the operation came from a user.
      */
     void incrementGlobalLatencyStats(OperationContext* opCtx,
                                      uint64_t latency,
@@ -150,25 +179,32 @@ public:
                                   BSONObjBuilder* builder);
 
 private:
-    void _appendToUsageMap(BSONObjBuilder& b, const UsageMap& map) const;
+    // The usage map is split into independently locked shards, selected by the top bits of the
+    // namespace hash so that the bits the hash table uses within a shard stay well distributed.
+    static constexpr int kUsageMapShardBits = 4;
+    static constexpr size_t kNumUsageMapShards = size_t{1} << kUsageMapShardBits;
+
+    struct UsageMapShard {
+        Mutex mutex = MONGO_MAKE_LATCH("Top::UsageMapShard::mutex");
+        UsageMap usage;
+    };
 
-    void _appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const;
+    UsageMapShard& _getShard(StringData ns);
+
+    /**
+     * Returns the statistics of 'ns' if it is registered, without registering it.
+     */
+    CollectionDataHandle _findCollectionData(StringData ns);
 
-    void _record(OperationContext* opCtx,
-                 CollectionData& c,
-                 LogicalOp logicalOp,
-                 LockType lockType,
-                 long long micros,
-                 Command::ReadWriteType readWriteType);
+    void _appendStatsEntry(BSONObjBuilder& b, const char* statsName, const UsageData& map) const;
 
     void _incrementHistogram(OperationContext* opCtx,
                              long long latency,
                              OperationLatencyHistogram* histogram,
                              Command::ReadWriteType readWriteType);
 
-    Mutex _lock = MONGO_MAKE_LATCH("Top::_lock");
-    OperationLatencyHistogram _globalHistogramStats;
-    UsageMap _usage;
+    Striped<OperationLatencyHistogram> _globalHistogramStats;
+    std::array<CacheExclusive<UsageMapShard>, kNumUsageMapShards> _usageShards;
 };
 
 }  // namespace mongo
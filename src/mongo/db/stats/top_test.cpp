@@ -30,14 +30,70 @@
 #include "mongo/platform/basic.h"
 
 #include "mongo/db/stats/top.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection_mock.h"
 #include "mongo/unittest/unittest.h"
 
 namespace {
 
 using namespace mongo;
 
+class CollectionWithSharedDecorations : public CollectionMock {
+public:
+    using CollectionMock::CollectionMock;
+
+    SharedCollectionDecorations* getSharedDecorations() const override {
+        return &_sharedDecorations;
+    }
+
+private:
+    mutable SharedCollectionDecorations _sharedDecorations;
+};
+
 TEST(TopTest, CollectionDropped) {
     Top().collectionDropped(NamespaceString::createNamespaceString_forTest("test.coll"));
 }
 
+TEST(TopTest, CollectionDataHandlesAreSharedUntilDropped) {
+    Top top;
+    auto nss = NamespaceString::createNamespaceString_forTest("test.coll");
+
+    auto handle = top.getCollectionData(nss.ns());
+    ASSERT(handle);
+    ASSERT_EQ(handle, top.getCollectionData(nss.ns()));
+    ASSERT_FALSE(top.getCollectionData("?unknown"));
+
+    handle->total.inc(10);
+    BSONObjBuilder builder;
+    top.append(builder);
+    ASSERT_EQ(builder.obj()["test.coll"]["total"]["count"].numberLong(), 1);
+
+    top.collectionDropped(nss);
+    BSONObjBuilder afterDrop;
+    top.append(afterDrop);
+    ASSERT_FALSE(afterDrop.obj().hasField("test.coll"));
+    ASSERT_NE(handle, top.getCollectionData(nss.ns()));
+}
+
+TEST(TopTest, CollectionDataIsCachedOnTheCollection) {
+    Top top;
+    auto nss = NamespaceString::createNamespaceString_forTest("test.coll");
+    CollectionWithSharedDecorations collection(nss);
+
+    auto data = top.getCollectionData(collection);
+    ASSERT(data);
+    ASSERT_EQ(data, top.getCollectionData(collection));
+    ASSERT_EQ(data, top.getCollectionData(nss.ns()).get());
+
+    // Dropping the statistics of the namespace or renaming the collection resolves them again.
+    top.collectionDropped(nss);
+    auto afterDrop = top.getCollectionData(collection);
+    ASSERT_NE(data, afterDrop);
+    ASSERT_EQ(afterDrop, top.getCollectionData(nss.ns()).get());
+
+    auto renamedNss = NamespaceString::createNamespaceString_forTest("test.renamed");
+    ASSERT_OK(collection.rename(nullptr, renamedNss, false));
+    ASSERT_EQ(top.getCollectionData(collection), top.getCollectionData(renamedNss.ns()).get());
+}
+
 }  // namespace
@@ -456,6 +456,25 @@ public:
         return 0;
     }
 
+    /**
+     * Point-in-time view of how loaded the storage engine is, used to pace background work such as
+     * the deletion of orphaned ranges.
+     */
+    struct LoadStats {
+        // Fraction of the cache occupied by dirty data.
+        double cacheDirtyRatio = 0;
+
+        // Whether a checkpoint is currently in progress.
+        bool checkpointRunning = false;
+    };
+
+    /**
+     * Returns boost::none if the storage engine does not expose load statistics.
+     */
+    virtual boost::optional<LoadStats> getLoadStats() const {
+        return boost::none;
+    }
+
     /**
      * Returns the input storage engine options, sanitized to remove options that may not apply to
      * this node, such as encryption. Might be called for both collection and index options. See
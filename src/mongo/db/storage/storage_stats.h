@@ -30,6 +30,7 @@
 #pragma once
 
 #include "mongo/bson/bsonobj.h"
+#include "mongo/util/duration.h"
 
 namespace mongo {
 
@@ -54,6 +55,14 @@ public:
 
     virtual std::unique_ptr<StorageStats> clone() const = 0;
 
+    /**
+     * Returns the time the operation spent waiting for the storage engine to read data from disk,
+     * or zero if the storage engine does not track it.
+     */
+    virtual Microseconds timeReadingStorage() const {
+        return Microseconds{0};
+    }
+
     virtual StorageStats& operator+=(const StorageStats&) = 0;
     virtual StorageStats& operator-=(const StorageStats&) = 0;
 };
@@ -4107,6 +4107,30 @@ size_t WiredTigerKVEngine::getCacheSizeMB() const {
     return _cacheSizeMB;
 }
 
+boost::optional<KVEngine::LoadStats> WiredTigerKVEngine::getLoadStats() const {
+    WiredTigerSession session(_conn);
+    auto swValues = WiredTigerUtil::getStatisticsValues(session.getSession(),
+                                                        "statistics:",
+                                                        "",
+                                                        {WT_STAT_CONN_CACHE_BYTES_MAX,
+                                                         WT_STAT_CONN_CACHE_BYTES_DIRTY,
+                                                         WT_STAT_CONN_TXN_CHECKPOINT_RUNNING});
+    if (!swValues.isOK()) {
+        return boost::none;
+    }
+
+    const auto& values = swValues.getValue();
+    const auto cacheBytesMax = values[0];
+    if (cacheBytesMax <= 0) {
+        return boost::none;
+    }
+
+    LoadStats stats;
+    stats.cacheDirtyRatio = static_cast<double>(values[1]) / cacheBytesMax;
+    stats.checkpointRunning = values[2] != 0;
+    return stats;
+}
+
 StatusWith<BSONObj> WiredTigerKVEngine::getSanitizedStorageOptionsForSecondaryReplication(
     const BSONObj& options) const {
 
@@ -423,6 +423,8 @@ public:
 
     size_t getCacheSizeMB() const override;
 
+    boost::optional<LoadStats> getLoadStats() const override;
+
     StatusWith<BSONObj> getSanitizedStorageOptionsForSecondaryReplication(
         const BSONObj& options) const override;
 
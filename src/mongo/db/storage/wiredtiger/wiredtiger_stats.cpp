@@ -121,6 +121,11 @@ std::unique_ptr<StorageStats> WiredTigerStats::clone() const {
     return std::make_unique<WiredTigerStats>(*this);
 }
 
+Microseconds WiredTigerStats::timeReadingStorage() const {
+    auto it = _stats.find(WT_STAT_SESSION_READ_TIME);
+    return Microseconds{it == _stats.end() ? 0 : it->second};
+}
+
 WiredTigerStats& WiredTigerStats::operator=(WiredTigerStats&& other) {
     _stats = std::move(other._stats);
     return *this;
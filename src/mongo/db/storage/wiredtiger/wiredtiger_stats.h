@@ -50,6 +50,8 @@ public:
 
     std::unique_ptr<StorageStats> clone() const final;
 
+    Microseconds timeReadingStorage() const final;
+
     WiredTigerStats& operator=(WiredTigerStats&&);
 
     StorageStats& operator+=(const StorageStats&) final;
@@ -495,40 +495,57 @@ StatusWith<int64_t> WiredTigerUtil::getStatisticsValue(WT_SESSION* session,
                                                        const std::string& uri,
                                                        const std::string& config,
                                                        int statisticsKey) {
+    auto swValues = getStatisticsValues(session, uri, config, {statisticsKey});
+    if (!swValues.isOK()) {
+        return swValues.getStatus();
+    }
+    return StatusWith<int64_t>(swValues.getValue().front());
+}
+
+StatusWith<std::vector<int64_t>> WiredTigerUtil::getStatisticsValues(
+    WT_SESSION* session,
+    const std::string& uri,
+    const std::string& config,
+    const std::vector<int>& statisticsKeys) {
     invariant(session);
+    invariant(!statisticsKeys.empty());
     WT_CURSOR* cursor = nullptr;
     const char* cursorConfig = config.empty() ? nullptr : config.c_str();
     int ret = session->open_cursor(session, uri.c_str(), nullptr, cursorConfig, &cursor);
     if (ret != 0) {
         // The numerical 'statisticsKey' can be located in the WT_STATS_* preprocessor macros in
         // wiredtiger.h.
-        return StatusWith<int64_t>(ErrorCodes::CursorNotFound,
-                                   str::stream() << "unable to open cursor at URI " << uri
-                                                 << " for statistic: " << statisticsKey
-                                                 << ". reason: " << wiredtiger_strerror(ret));
+        return Status(ErrorCodes::CursorNotFound,
+                      str::stream() << "unable to open cursor at URI " << uri
+                                    << " for statistic: " << statisticsKeys.front()
+                                    << ". reason: " << wiredtiger_strerror(ret));
     }
     invariant(cursor);
     ON_BLOCK_EXIT([&] { cursor->close(cursor); });
 
-    cursor->set_key(cursor, statisticsKey);
-    ret = cursor->search(cursor);
-    if (ret != 0) {
-        return StatusWith<int64_t>(ErrorCodes::NoSuchKey,
-                                   str::stream()
-                                       << "unable to find key " << statisticsKey << " at URI "
-                                       << uri << ". reason: " << wiredtiger_strerror(ret));
-    }
+    std::vector<int64_t> values;
+    values.reserve(statisticsKeys.size());
+    for (auto statisticsKey : statisticsKeys) {
+        cursor->set_key(cursor, statisticsKey);
+        ret = cursor->search(cursor);
+        if (ret != 0) {
+            return Status(ErrorCodes::NoSuchKey,
+                          str::stream() << "unable to find key " << statisticsKey << " at URI "
+                                        << uri << ". reason: " << wiredtiger_strerror(ret));
+        }
 
-    int64_t value;
-    ret = cursor->get_value(cursor, nullptr, nullptr, &value);
-    if (ret != 0) {
-        return StatusWith<int64_t>(ErrorCodes::BadValue,
-                                   str::stream() << "unable to get value for key " << statisticsKey
-                                                 << " at URI " << uri
-                                                 << ". reason: " << wiredtiger_strerror(ret));
+        int64_t value;
+        ret = cursor->get_value(cursor, nullptr, nullptr, &value);
+        if (ret != 0) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "unable to get value for key " << statisticsKey
+                                        << " at URI " << uri
+                                        << ". reason: " << wiredtiger_strerror(ret));
+        }
+        values.push_back(value);
     }
 
-    return StatusWith<int64_t>(value);
+    return std::move(values);
 }
 
 int64_t WiredTigerUtil::getIdentSize(WT_SESSION* s, const std::string& uri) {
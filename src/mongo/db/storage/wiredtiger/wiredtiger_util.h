@@ -30,6 +30,7 @@
 #pragma once
 
 #include <limits>
+#include <vector>
 #include <wiredtiger.h>
 
 #include "mongo/base/status.h"
@@ -274,6 +275,16 @@ public:
                                                   const std::string& config,
                                                   int statisticsKey);
 
+    /**
+     * Reads several statistics through a single cursor on the URI, in the order of
+     * 'statisticsKeys'. Fails as getStatisticsValue() does on the first key which cannot be read.
+     */
+    static StatusWith<std::vector<int64_t>> getStatisticsValues(
+        WT_SESSION* session,
+        const std::string& uri,
+        const std::string& config,
+        const std::vector<int>& statisticsKeys);
+
     static int64_t getEphemeralIdentSize(WT_SESSION* s, const std::string& uri);
 
     static int64_t getIdentSize(WT_SESSION* s, const std::string& uri);
@@ -379,6 +379,23 @@ TEST_F(WiredTigerUtilTest, GetStatisticsValueValidKey) {
     ASSERT_EQUALS(0U, result.getValue());
 }
 
+TEST_F(WiredTigerUtilTest, GetStatisticsValuesSingleCursor) {
+    WiredTigerUtilHarnessHelper harnessHelper("statistics=(all)");
+    WiredTigerRecoveryUnit recoveryUnit(harnessHelper.getSessionCache(),
+                                        harnessHelper.getOplogManager());
+    std::unique_ptr<OperationContext> opCtx{harnessHelper.newOperationContext()};
+    recoveryUnit.setOperationContext(opCtx.get());
+    WiredTigerSession* session = recoveryUnit.getSession();
+    auto result = WiredTigerUtil::getStatisticsValues(
+        session->getSession(),
+        "statistics:",
+        "",
+        {WT_STAT_CONN_CACHE_BYTES_MAX, WT_STAT_CONN_TXN_CHECKPOINT_RUNNING});
+    ASSERT_OK(result.getStatus());
+    ASSERT_EQUALS(2U, result.getValue().size());
+    ASSERT_GREATER_THAN(result.getValue()[0], 0);
+}
+
 TEST_F(WiredTigerUtilTest, ParseAPIMessages) {
     // Custom event handler.
     WiredTigerEventHandler eventHandler;
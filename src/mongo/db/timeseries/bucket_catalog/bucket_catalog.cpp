@@ -34,6 +34,7 @@
 #include "mongo/db/timeseries/bucket_catalog/bucket_catalog.h"
 
 #include <algorithm>
+#include <limits>
 #include <boost/iterator/transform_iterator.hpp>
 
 #include "mongo/db/catalog/database_holder.h"
@@ -49,6 +50,7 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/processinfo.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
@@ -139,6 +141,26 @@ BucketCatalog& BucketCatalog::get(OperationContext* opCtx) {
     return get(opCtx->getServiceContext());
 }
 
+std::size_t BucketCatalog::getDefaultNumberOfStripes() {
+    // Stripes are addressed by a 'StripeNumber', which bounds how many a catalog can have.
+    constexpr std::size_t kMaxStripes = std::numeric_limits<StripeNumber>::max() + 1;
+    constexpr std::size_t kMinDefaultStripes = 32;
+    constexpr std::size_t kStripesPerCore = 4;
+
+    if (gTimeseriesBucketCatalogStripes > 0) {
+        return static_cast<std::size_t>(gTimeseriesBucketCatalogStripes);
+    }
+
+    // Keep enough stripes per core that concurrent inserts for different series rarely land on
+    // the same stripe mutex.
+    auto numStripes = kMinDefaultStripes;
+    const auto target = ProcessInfo::getNumAvailableCores() * kStripesPerCore;
+    while (numStripes < target && numStripes < kMaxStripes) {
+        numStripes *= 2;
+    }
+    return numStripes;
+}
+
 BSONObj getMetadata(BucketCatalog& catalog, const BucketHandle& handle) {
     auto const& stripe = catalog.stripes[handle.stripe];
     stdx::lock_guard stripeLock{stripe.mutex};
@@ -377,6 +399,7 @@ void clear(BucketCatalog& catalog, ShouldClearFn&& shouldClear) {
         clearSetOfBuckets(catalog.bucketStateRegistry, std::move(shouldClear));
         return;
     }
+    stdx::unordered_set<NamespaceString> clearedNamespaces;
     for (auto& stripe : catalog.stripes) {
         stdx::lock_guard stripeLock{stripe.mutex};
         for (auto it = stripe.openBucketsById.begin(); it != stripe.openBucketsById.end();) {
@@ -388,6 +411,7 @@ void clear(BucketCatalog& catalog, ShouldClearFn&& shouldClear) {
                     stdx::lock_guard catalogLock{catalog.mutex};
                     catalog.executionStats.erase(bucket->bucketId.ns);
                 }
+                clearedNamespaces.insert(bucket->bucketId.ns);
                 internal::abort(catalog,
                                 stripe,
                                 stripeLock,
@@ -400,6 +424,18 @@ void clear(BucketCatalog& catalog, ShouldClearFn&& shouldClear) {
             it = nextIt;
         }
     }
+
+    // Drop the stats cached by the stripes once they are no longer in the catalog-wide map, so
+    // that no stripe can cache them again.
+    if (clearedNamespaces.empty()) {
+        return;
+    }
+    for (auto& stripe : catalog.stripes) {
+        stdx::lock_guard stripeLock{stripe.mutex};
+        for (const auto& ns : clearedNamespaces) {
+            stripe.executionStats.erase(ns);
+        }
+    }
 }
 
 void clear(BucketCatalog& catalog, const NamespaceString& ns) {
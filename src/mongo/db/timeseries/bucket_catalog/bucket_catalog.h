@@ -117,6 +117,11 @@ struct Stripe {
                         std::map<Date_t, ArchivedBucket, std::greater<Date_t>>,
                         BucketHasher>
         archivedBuckets;
+
+    // Execution stats of the namespaces inserted into through this stripe, shared with
+    // 'BucketCatalog::executionStats'. Lets inserts find their stats under the stripe lock they
+    // already hold instead of the catalog-wide mutex.
+    stdx::unordered_map<NamespaceString, std::shared_ptr<ExecutionStats>> executionStats;
 };
 
 /**
@@ -127,7 +132,14 @@ public:
     static BucketCatalog& get(ServiceContext* svcCtx);
     static BucketCatalog& get(OperationContext* opCtx);
 
-    BucketCatalog() : stripes(numberOfStripes) {}
+    /**
+     * Returns the number of stripes a default-constructed catalog uses: the value of the
+     * 'timeseriesBucketCatalogStripes' server parameter, or, if unset, a count derived from the
+     * number of available cores.
+     */
+    static std::size_t getDefaultNumberOfStripes();
+
+    BucketCatalog() : BucketCatalog(getDefaultNumberOfStripes()) {}
     BucketCatalog(size_t numberOfStripes)
         : numberOfStripes(numberOfStripes), stripes(numberOfStripes){};
     BucketCatalog(const BucketCatalog&) = delete;
@@ -139,7 +151,7 @@ public:
     // The actual buckets in the catalog are distributed across a number of 'Stripe's. Each can be
     // independently locked and operated on in parallel. The size of the stripe vector should not be
     // changed after initialization.
-    const std::size_t numberOfStripes = 32;
+    const std::size_t numberOfStripes;
     std::vector<Stripe> stripes;
 
     // Per-namespace execution stats. This map is protected by 'mutex'. Once you complete your
@@ -0,0 +1,143 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include <benchmark/benchmark.h>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/catalog_test_fixture.h"
+#include "mongo/db/catalog/create_collection.h"
+#include "mongo/db/catalog_raii.h"
+#include "mongo/db/timeseries/bucket_catalog/bucket_catalog.h"
+#include "mongo/db/timeseries/bucket_catalog/write_batch.h"
+#include "mongo/util/str.h"
+
+namespace mongo::timeseries::bucket_catalog {
+namespace {
+
+const int kMaxPerfThreads = 64;
+
+// Reusing the CatalogTestFixture for benchmarking, since inserting into the catalog needs a real
+// storage engine. _doTest has an empty implementation to honor the abstract class, but it is not
+// used in the benchmark framework.
+class BenchmarkBucketCatalogFixture : public CatalogTestFixture {
+public:
+    BenchmarkBucketCatalogFixture() {
+        CatalogTestFixture::setUp();
+
+        auto opCtx = operationContext();
+        uassertStatusOK(createCollection(
+            opCtx,
+            ns.dbName(),
+            BSON("create" << ns.coll() << "timeseries"
+                          << BSON("timeField"
+                                  << "time"
+                                  << "metaField"
+                                  << "tag"))));
+
+        AutoGetCollection autoColl(opCtx, ns.makeTimeseriesBucketsNamespace(), MODE_IS);
+        options = *autoColl->getTimeseriesOptions();
+    }
+
+    ~BenchmarkBucketCatalogFixture() {
+        CatalogTestFixture::tearDown();
+    }
+
+    const NamespaceString ns =
+        NamespaceString::createNamespaceString_forTest("bucket_catalog_bm", "t");
+    TimeseriesOptions options;
+
+private:
+    void _doTest() override{};
+};
+
+BenchmarkBucketCatalogFixture& getFixture() {
+    // Starting the storage engine dominates the cost of a run, so every benchmark and thread
+    // shares a single fixture for the lifetime of the process.
+    static auto fixture = new BenchmarkBucketCatalogFixture();
+    return *fixture;
+}
+
+/**
+ * Inserts one measurement per iteration through the full insert, prepare and finish cycle that
+ * a time-series write performs, combining with concurrent inserts into the same bucket.
+ */
+void runInserts(benchmark::State& state, const BSONObj& meta) {
+    auto& fixture = getFixture();
+    auto client = fixture.getServiceContext()->makeClient(str::stream()
+                                                          << "bucket catalog bm thread "
+                                                          << state.thread_index);
+    auto opCtx = client->makeOperationContext();
+    auto& catalog = BucketCatalog::get(opCtx.get());
+
+    // Use a single timestamp so that buckets only roll over when they reach their count limit.
+    const Date_t time = Date_t::fromMillisSinceEpoch(1'000'000);
+    BSONObjBuilder docBuilder;
+    docBuilder.append("time", time);
+    docBuilder.appendElements(meta);
+    docBuilder.append("value", 1.0);
+    const BSONObj doc = docBuilder.obj();
+
+    for (auto _ : state) {
+        auto swResult = insert(opCtx.get(),
+                               catalog,
+                               fixture.ns,
+                               nullptr,
+                               fixture.options,
+                               doc,
+                               CombineWithInsertsFromOtherClients::kAllow);
+        auto batch = uassertStatusOK(swResult).batch;
+        if (claimWriteBatchCommitRights(*batch)) {
+            uassertStatusOK(prepareCommit(catalog, batch));
+            finish(catalog, batch, {});
+        } else {
+            uassertStatusOK(getWriteBatchResult(*batch));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_InsertSingleMeta(benchmark::State& state) {
+    // Every thread writes to the same series, so all inserts contend on one stripe and bucket.
+    runInserts(state, BSON("tag"
+                           << "hot"));
+}
+
+void BM_InsertMetaPerThread(benchmark::State& state) {
+    // Every thread writes to its own series, which spreads the inserts across stripes.
+    runInserts(state, BSON("tag" << state.thread_index));
+}
+
+BENCHMARK(BM_InsertSingleMeta)->ThreadRange(1, kMaxPerfThreads);
+BENCHMARK(BM_InsertMetaPerThread)->ThreadRange(1, kMaxPerfThreads);
+
+}  // namespace
+}  // namespace mongo::timeseries::bucket_catalog
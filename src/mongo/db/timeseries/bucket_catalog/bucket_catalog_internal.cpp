@@ -626,16 +626,12 @@ StatusWith<InsertResult> insert(OperationContext* opCtx,
     auto& key = res.getValue().first;
     auto time = res.getValue().second;
 
-    ExecutionStatsController stats = getOrInitializeExecutionStats(catalog, ns);
-    updateBucketFetchAndQueryStats(bucketFindResult, stats);
-
     // Buckets are spread across independently-lockable stripes to improve parallelism. We map a
     // bucket to a stripe by hashing the BucketKey.
     auto stripeNumber = getStripeNumber(key, catalog.numberOfStripes);
 
     InsertResult result;
     result.catalogEra = getCurrentEra(catalog.bucketStateRegistry);
-    CreationInfo info{key, stripeNumber, time, options, stats, &result.closedBuckets};
     boost::optional<BucketToReopen> bucketToReopen = std::move(bucketFindResult.bucketToReopen);
 
     auto rehydratedBucket = bucketToReopen.has_value()
@@ -648,6 +644,8 @@ StatusWith<InsertResult> insert(OperationContext* opCtx,
                           &key)
         : StatusWith<std::unique_ptr<Bucket>>{ErrorCodes::BadValue, "No bucket to rehydrate"};
     if (rehydratedBucket.getStatus().code() == ErrorCodes::WriteConflict) {
+        ExecutionStatsController stats = getOrInitializeExecutionStats(catalog, ns);
+        updateBucketFetchAndQueryStats(bucketFindResult, stats);
         stats.incNumBucketReopeningsFailed();
         return rehydratedBucket.getStatus();
     }
@@ -655,6 +653,13 @@ StatusWith<InsertResult> insert(OperationContext* opCtx,
     auto& stripe = catalog.stripes[stripeNumber];
     stdx::lock_guard stripeLock{stripe.mutex};
 
+    // The stats are looked up under the stripe lock so that concurrent inserts into the same
+    // namespace do not serialize on the catalog-wide mutex.
+    ExecutionStatsController stats =
+        getOrInitializeExecutionStats(catalog, stripe, stripeLock, ns);
+    updateBucketFetchAndQueryStats(bucketFindResult, stats);
+    CreationInfo info{key, stripeNumber, time, options, stats, &result.closedBuckets};
+
     if (rehydratedBucket.isOK()) {
         invariant(mode == AllowBucketCreation::kYes);
         hangTimeseriesInsertBeforeReopeningBucket.pauseWhileSet();
@@ -1324,6 +1329,29 @@ ExecutionStatsController getOrInitializeExecutionStats(BucketCatalog& catalog,
     return {res.first->second, catalog.globalExecutionStats};
 }
 
+ExecutionStatsController getOrInitializeExecutionStats(BucketCatalog& catalog,
+                                                       Stripe& stripe,
+                                                       WithLock,
+                                                       const NamespaceString& ns) {
+    auto it = stripe.executionStats.find(ns);
+    if (it != stripe.executionStats.end()) {
+        return {it->second, catalog.globalExecutionStats};
+    }
+
+    std::shared_ptr<ExecutionStats> stats;
+    {
+        stdx::lock_guard catalogLock{catalog.mutex};
+        auto res = catalog.executionStats.try_emplace(ns);
+        if (res.second) {
+            res.first->second = std::make_shared<ExecutionStats>();
+        }
+        stats = res.first->second;
+    }
+
+    stripe.executionStats.emplace(ns, stats);
+    return {stats, catalog.globalExecutionStats};
+}
+
 std::shared_ptr<ExecutionStats> getExecutionStats(const BucketCatalog& catalog,
                                                   const NamespaceString& ns) {
     static const auto kEmptyStats{std::make_shared<ExecutionStats>()};
@@ -329,6 +329,16 @@ std::pair<RolloverAction, RolloverReason> determineRolloverAction(
 ExecutionStatsController getOrInitializeExecutionStats(BucketCatalog& catalog,
                                                        const NamespaceString& ns);
 
+/**
+ * Retrieves or initializes the execution stats for the given namespace, for writing, through the
+ * stats cached by 'stripe'. Only takes the catalog-wide mutex the first time the namespace is seen
+ * by this stripe.
+ */
+ExecutionStatsController getOrInitializeExecutionStats(BucketCatalog& catalog,
+                                                       Stripe& stripe,
+                                                       WithLock stripeLock,
+                                                       const NamespaceString& ns);
+
 /**
  * Retrieves the execution stats for the given namespace, if they have already been initialized.
  */
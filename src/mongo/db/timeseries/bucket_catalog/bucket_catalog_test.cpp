@@ -462,6 +462,22 @@ TEST_F(BucketCatalogTest, InsertThroughDifferentCatalogsIntoDifferentBuckets) {
     finish(temporaryBucketCatalog, batch2, {});
 }
 
+TEST_F(BucketCatalogTest, DefaultNumberOfStripesFollowsServerParameter) {
+    {
+        RAIIServerParameterControllerForTest stripes{"timeseriesBucketCatalogStripes", 8};
+        ASSERT_EQ(BucketCatalog::getDefaultNumberOfStripes(), 8U);
+        ASSERT_EQ(BucketCatalog().numberOfStripes, 8U);
+    }
+
+    // When derived from the core count, the stripe count is a power of two that every
+    // 'StripeNumber' can address.
+    RAIIServerParameterControllerForTest stripes{"timeseriesBucketCatalogStripes", 0};
+    auto numStripes = BucketCatalog::getDefaultNumberOfStripes();
+    ASSERT_GTE(numStripes, 32U);
+    ASSERT_LTE(numStripes, 256U);
+    ASSERT_EQ(numStripes & (numStripes - 1), 0U);
+}
+
 TEST_F(BucketCatalogTest, InsertIntoSameBucketArray) {
     auto result1 = insert(
         _opCtx,
@@ -610,6 +626,22 @@ TEST_F(BucketCatalogTest, ClearNamespaceBuckets) {
     _insertOneAndCommit(_ns2, 1);
 }
 
+TEST_F(BucketCatalogTest, ClearNamespaceResetsExecutionStats) {
+    RAIIServerParameterControllerForTest featureFlag{"featureFlagTimeseriesScalabilityImprovements",
+                                                     false};
+
+    _insertOneAndCommit(_ns1, 0);
+    ASSERT_EQ(1, _getExecutionStat(_ns1, "numBucketsOpenedDueToMetadata"));
+
+    clear(*_bucketCatalog, _ns1);
+    ASSERT_EQ(0, _getExecutionStat(_ns1, "numBucketsOpenedDueToMetadata"));
+
+    // The stats cached by the stripe were dropped along with the cleared ones, so the next insert
+    // is accounted in the stats reported for the namespace.
+    _insertOneAndCommit(_ns1, 0);
+    ASSERT_EQ(1, _getExecutionStat(_ns1, "numBucketsOpenedDueToMetadata"));
+}
+
 TEST_F(BucketCatalogTest, ClearDatabaseBuckets) {
     _insertOneAndCommit(_ns1, 0);
     _insertOneAndCommit(_ns2, 0);
@@ -29,6 +29,7 @@
 
 #include "mongo/db/timeseries/timeseries_write_util.h"
 
+#include "mongo/bson/util/bsoncolumnbuilder.h"
 #include "mongo/db/catalog/collection_write_path.h"
 #include "mongo/db/catalog/document_validation.h"
 #include "mongo/db/catalog_raii.h"
@@ -45,6 +46,16 @@
 namespace mongo::timeseries {
 namespace {
 
+// Rounds the minimum timestamp and updates the min time field.
+void roundMinTimestamp(bucket_catalog::MinMax& minmax,
+                       const TimeseriesOptions& options,
+                       const StringData::ComparatorInterface* comparator) {
+    auto minTime = roundTimestampToGranularity(
+        minmax.min().getField(options.getTimeField()).Date(), options);
+    auto controlDoc = bucket_catalog::buildControlMinTimestampDoc(options.getTimeField(), minTime);
+    minmax.update(controlDoc, /*metaField=*/boost::none, comparator);
+}
+
 // Builds the data field of a bucket document. Computes the min and max fields if necessary.
 boost::optional<bucket_catalog::MinMax> processTimeseriesMeasurements(
     const std::vector<BSONObj>& measurements,
@@ -76,13 +87,8 @@ boost::optional<bucket_catalog::MinMax> processTimeseriesMeasurements(
         ++count;
     }
 
-    // Rounds the minimum timestamp and updates the min time field.
     if (computeMinmax) {
-        auto minTime = roundTimestampToGranularity(
-            minmax.min().getField(options->getTimeField()).Date(), *options);
-        auto controlDoc =
-            bucket_catalog::buildControlMinTimestampDoc(options->getTimeField(), minTime);
-        minmax.update(controlDoc, /*metaField=*/boost::none, *comparator);
+        roundMinTimestamp(minmax, *options, *comparator);
         return minmax;
     }
 
@@ -144,6 +150,65 @@ BSONObj makeNewDocumentForWrite(
     return makeNewDocument(bucketId, metadata, minmax->min(), minmax->max(), dataBuilders);
 }
 
+BSONObj makeTruncatedCompressedDocumentForWrite(const BSONObj& compressedBucket,
+                                                const std::vector<BSONObj>& measurements,
+                                                const TimeseriesOptions& options,
+                                                const StringData::ComparatorInterface* comparator) {
+    invariant(!measurements.empty());
+
+    bucket_catalog::MinMax minmax;
+    for (const auto& doc : measurements) {
+        minmax.update(doc, options.getMetaField(), comparator);
+    }
+    roundMinTimestamp(minmax, options, comparator);
+    auto min = minmax.min();
+    auto max = minmax.max();
+    auto count = static_cast<int32_t>(measurements.size());
+
+    BSONObjBuilder builder;
+    for (auto&& elem : compressedBucket) {
+        auto fieldName = elem.fieldNameStringData();
+        if (fieldName == kBucketControlFieldName) {
+            BSONObjBuilder control(builder.subobjStart(kBucketControlFieldName));
+            for (auto&& controlField : elem.Obj()) {
+                auto controlFieldName = controlField.fieldNameStringData();
+                if (controlFieldName == kBucketControlMinFieldName) {
+                    control.append(kBucketControlMinFieldName, min);
+                } else if (controlFieldName == kBucketControlMaxFieldName) {
+                    control.append(kBucketControlMaxFieldName, max);
+                } else if (controlFieldName == kBucketControlCountFieldName) {
+                    control.append(kBucketControlCountFieldName, count);
+                } else {
+                    control.append(controlField);
+                }
+            }
+        } else if (fieldName == kBucketDataFieldName) {
+            BSONObjBuilder data(builder.subobjStart(kBucketDataFieldName));
+            BufBuilder columnBuffer;  // Reusable buffer to avoid extra allocs per column.
+            for (auto&& column : elem.Obj()) {
+                uassert(9393802,
+                        "Time-series bucket data fields must be compressed columns",
+                        column.isBinData(BinDataType::Column));
+
+                // The kept measurements may not have this field at all, drop its column then.
+                if (!min.hasField(column.fieldNameStringData())) {
+                    continue;
+                }
+
+                // Truncate the column to the kept measurements without recompressing them.
+                int size;
+                const char* binary = column.binData(size);
+                BSONColumnBuilder truncated(binary, size, count);
+                data.append(column.fieldNameStringData(), truncated.finalize());
+            }
+        } else {
+            builder.append(elem);
+        }
+    }
+
+    return builder.obj();
+}
+
 std::vector<write_ops::InsertCommandRequest> makeInsertsToNewBuckets(
     const std::vector<BSONObj>& measurements,
     const NamespaceString& nss,
@@ -164,13 +229,24 @@ std::vector<write_ops::InsertCommandRequest> makeInsertsToNewBuckets(
 }
 
 stdx::variant<write_ops::UpdateCommandRequest, write_ops::DeleteCommandRequest> makeModificationOp(
-    const OID& bucketId, const CollectionPtr& coll, const std::vector<BSONObj>& measurements) {
+    const OID& bucketId,
+    const CollectionPtr& coll,
+    const std::vector<BSONObj>& measurements,
+    const BSONObj& compressedBucket) {
     if (measurements.empty()) {
         write_ops::DeleteOpEntry deleteEntry(BSON("_id" << bucketId), false);
         write_ops::DeleteCommandRequest op(coll->ns(), {deleteEntry});
         return op;
     }
     auto timeseriesOptions = coll->getTimeseriesOptions();
+    if (!compressedBucket.isEmpty()) {
+        auto replaceBucket = makeTruncatedCompressedDocumentForWrite(
+            compressedBucket, measurements, *timeseriesOptions, coll->getDefaultCollator());
+        write_ops::UpdateModification u(replaceBucket);
+        write_ops::UpdateOpEntry updateEntry(BSON("_id" << bucketId), std::move(u));
+        write_ops::UpdateCommandRequest op(coll->ns(), {updateEntry});
+        return op;
+    }
     auto metaFieldName = timeseriesOptions->getMetaField();
     auto metadata = [&] {
         if (!metaFieldName) {  // Collection has no metadata field.
@@ -54,6 +54,17 @@ BSONObj makeNewDocumentForWrite(
     const boost::optional<TimeseriesOptions>& options,
     const boost::optional<const StringData::ComparatorInterface*>& comparator);
 
+/**
+ * Returns the document for replacing the compressed bucket 'compressedBucket' with one holding only
+ * its first 'measurements.size()' measurements, which must be 'measurements'. The data columns are
+ * truncated without decompressing and recompressing the measurements that are kept. Recalculates
+ * the min and max fields from 'measurements'.
+ */
+BSONObj makeTruncatedCompressedDocumentForWrite(const BSONObj& compressedBucket,
+                                                const std::vector<BSONObj>& measurements,
+                                                const TimeseriesOptions& options,
+                                                const StringData::ComparatorInterface* comparator);
+
 std::vector<write_ops::InsertCommandRequest> makeInsertsToNewBuckets(
     const std::vector<BSONObj>& measurements,
     const NamespaceString& nss,
@@ -63,9 +74,16 @@ std::vector<write_ops::InsertCommandRequest> makeInsertsToNewBuckets(
 /**
  * Returns an update request to the bucket when the 'measurements' is non-empty. Otherwise, returns
  * a delete request to the bucket.
+ *
+ * If 'compressedBucket' is provided, it must be the compressed bucket the 'measurements' are the
+ * leading measurements of. The bucket is then kept compressed and truncated in place instead of
+ * being rewritten uncompressed.
  */
 stdx::variant<write_ops::UpdateCommandRequest, write_ops::DeleteCommandRequest> makeModificationOp(
-    const OID& bucketId, const CollectionPtr& coll, const std::vector<BSONObj>& measurements);
+    const OID& bucketId,
+    const CollectionPtr& coll,
+    const std::vector<BSONObj>& measurements,
+    const BSONObj& compressedBucket = BSONObj());
 
 /**
  * Performs modifications atomically for a user command on a time-series collection.
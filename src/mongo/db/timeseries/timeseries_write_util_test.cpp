@@ -28,10 +28,12 @@
  */
 
 #include "mongo/bson/unordered_fields_bsonobj_comparator.h"
+#include "mongo/bson/util/bsoncolumn.h"
 #include "mongo/db/catalog/catalog_test_fixture.h"
 #include "mongo/db/catalog/collection_write_path.h"
 #include "mongo/db/catalog/create_collection.h"
 #include "mongo/db/catalog_raii.h"
+#include "mongo/db/timeseries/bucket_compression.h"
 #include "mongo/db/timeseries/timeseries_write_util.h"
 
 namespace mongo::timeseries {
@@ -181,6 +183,55 @@ TEST_F(TimeseriesWriteUtilTest, MakeNewBucketFromMeasurementsWithMeta) {
     ASSERT_EQ(0, comparator.compare(newDoc, bucketDoc));
 }
 
+TEST_F(TimeseriesWriteUtilTest, MakeTruncatedCompressedBucket) {
+    TimeseriesOptions options("time");
+    options.setGranularity(BucketGranularityEnum::Seconds);
+    const BSONObj bucketDoc = fromjson(
+        R"({"_id":{"$oid":"629e1e680958e279dc29a517"},
+            "control":{"version":1,"min":{"time":{"$date":"2022-06-06T15:34:00.000Z"},"a":1,"b":3},
+                                   "max":{"time":{"$date":"2022-06-06T15:34:32.000Z"},"a":3,"b":3}},
+            "data":{"time":{"0":{"$date":"2022-06-06T15:34:30.000Z"},
+                            "1":{"$date":"2022-06-06T15:34:31.000Z"},
+                            "2":{"$date":"2022-06-06T15:34:32.000Z"}},
+                    "a":{"0":1,"1":2,"2":3},
+                    "b":{"2":3}}})");
+    auto compressed = compressBucket(
+        bucketDoc,
+        "time"_sd,
+        NamespaceString::createNamespaceString_forTest("db_timeseries_write_util_test",
+                                                       "MakeTruncatedCompressedBucket"),
+        /*validateDecompression=*/true);
+    ASSERT_TRUE(compressed.compressedBucket);
+
+    // Keeps the first two measurements, which removes the only one with field 'b'.
+    const std::vector<BSONObj> measurements = {
+        fromjson(R"({"time":{"$date":"2022-06-06T15:34:30.000Z"},"a":1})"),
+        fromjson(R"({"time":{"$date":"2022-06-06T15:34:31.000Z"},"a":2})")};
+    auto newDoc = timeseries::makeTruncatedCompressedDocumentForWrite(
+        *compressed.compressedBucket, measurements, options, /*comparator=*/nullptr);
+
+    // Checks the control fields are recalculated and the bucket stays compressed.
+    ASSERT_EQ(newDoc["_id"].OID(), OID::createFromString("629e1e680958e279dc29a517"_sd));
+    const BSONObj control = fromjson(
+        R"({"version":2,"min":{"time":{"$date":"2022-06-06T15:34:00.000Z"},"a":1},
+                        "max":{"time":{"$date":"2022-06-06T15:34:31.000Z"},"a":2},
+                        "count":2})");
+    UnorderedFieldsBSONObjComparator comparator;
+    ASSERT_EQ(0, comparator.compare(newDoc["control"].Obj(), control));
+
+    // Checks the columns hold the kept measurements and the column for 'b' is dropped.
+    auto data = newDoc["data"].Obj();
+    ASSERT_FALSE(data.hasField("b"));
+    for (auto field : {"time"_sd, "a"_sd}) {
+        BSONColumn column(data[field]);
+        ASSERT_EQ(column.size(), measurements.size());
+        size_t i = 0;
+        for (auto&& elem : column) {
+            ASSERT(elem.binaryEqualValues(measurements[i++][field]));
+        }
+    }
+}
+
 TEST_F(TimeseriesWriteUtilTest, PerformAtomicDelete) {
     NamespaceString ns = NamespaceString::createNamespaceString_forTest(
         "db_timeseries_write_util_test", "PerformAtomicDelete");
@@ -41,10 +41,12 @@
 #include "mongo/db/client.h"
 #include "mongo/db/commands/fsync_locked.h"
 #include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/exec/delete_stage.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/op_observer/op_observer.h"
 #include "mongo/db/ops/insert.h"
 #include "mongo/db/query/internal_plans.h"
 #include "mongo/db/record_id_helpers.h"
@@ -65,6 +67,7 @@
 #include "mongo/util/assert_util.h"
 #include "mongo/util/background.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/log_with_sampling.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kIndex
@@ -80,6 +83,25 @@ bool isBatchingEnabled() {
         ttlMonitorBatchDeletes.load();
 }
 
+// Returns true if the expired documents of the clustered 'collection' can be removed with a range
+// truncate. Secondary indexes would need their keys removed document by document, pre-images and
+// orphan filtering need to see each deleted document, and capped and time-series collections
+// maintain state of their own about the records they hold. Members on an older
+// featureCompatibilityVersion may not be able to apply the 'truncateRange' oplog entry.
+bool canTruncateExpiredRange(const ScopedCollectionAcquisition& collection) {
+    if (!ttlMonitorClusteredRangeTruncate.load() ||
+        !feature_flags::gTTLClusteredRangeTruncate.isEnabled(
+            serverGlobalParams.featureCompatibility)) {
+        return false;
+    }
+
+    const auto& collectionPtr = collection.getCollectionPtr();
+    return collectionPtr->getIndexCatalog()->numIndexesTotal() == 0 &&
+        !collectionPtr->isCapped() && !collectionPtr->getTimeseriesOptions() &&
+        !collectionPtr->isChangeStreamPreAndPostImagesEnabled() &&
+        !collection.getShardingDescription().isSharded();
+}
+
 // When batching is enabled, returns BatchedDeleteStageParams that limit the amount of work done in
 // a delete such that it is possible not all expired documents will be removed. Returns nullptr
 // otherwise.
@@ -305,11 +327,32 @@ MONGO_FAIL_POINT_DEFINE(hangTTLMonitorBetweenPasses);
 CounterMetric ttlPasses("ttl.passes");
 CounterMetric ttlSubPasses("ttl.subPasses");
 CounterMetric ttlDeletedDocuments("ttl.deletedDocuments");
+CounterMetric ttlTruncatedRanges("ttl.truncatedRanges");
 
 // Counts the subpasses over TTL collections where the deletes on a collection are increased from
 // 'low' to 'normal' priority.
 CounterMetric ttlCollSubpassesIncreasedPriority("ttl.collSubpassesIncreasedPriority");
 
+namespace {
+// Reports how many collections the TTLMonitor has been unable to remove all the expired documents
+// of, and the collection which has been behind for the longest. The lag is a lower bound on the age
+// of the oldest expired document. The shape of the metric does not depend on the collections, so
+// that it does not change the FTDC schema.
+class TTLCollectionLagMetric final : public ServerStatusMetric {
+public:
+    TTLCollectionLagMetric() : ServerStatusMetric("ttl.collectionLag") {}
+
+    void appendAtLeaf(BSONObjBuilder& b) const final {
+        BSONObjBuilder lagBuilder(b.subobjStart(_leafName));
+        if (auto ttlMonitor = TTLMonitor::get(getGlobalServiceContext())) {
+            ttlMonitor->appendCollectionLag(&lagBuilder);
+        }
+    }
+};
+
+auto& ttlCollectionLagMetric = addMetricToTree(std::make_unique<TTLCollectionLagMetric>());
+}  // namespace
+
 using MtabType = TenantMigrationAccessBlocker::BlockerType;
 
 TTLMonitor::TTLMonitor()
@@ -468,6 +511,32 @@ bool TTLMonitor::_doTTLSubPass(
 
     ttlCollSubpassesIncreasedPriority.increment(numNormalPriorityCollections);
 
+    _pruneCollectionLag(work);
+
+    // With more than one TTL collection, the collections of a round may be visited concurrently.
+    // A collection is only ever visited by one worker at a time, and it gets the same batched
+    // delete budget as every other collection of the round.
+    std::unique_ptr<ThreadPool> workers;
+    if (auto maxConcurrency = ttlMonitorMaxConcurrentCollections.load();
+        maxConcurrency > 1 && work.size() > 1) {
+        ThreadPool::Options options;
+        options.poolName = "TTLMonitorWorkerThreadPool";
+        options.threadNamePrefix = "TTLMonitorWorker-";
+        options.maxThreads = std::min(static_cast<size_t>(maxConcurrency), work.size());
+        options.onCreateThread = [](const std::string& threadName) {
+            Client::initThread(threadName);
+            AuthorizationSession::get(cc())->grantInternalAuthorization(&cc());
+        };
+        workers = std::make_unique<ThreadPool>(options);
+        workers->startup();
+    }
+    ON_BLOCK_EXIT([&] {
+        if (workers) {
+            workers->shutdown();
+            workers->join();
+        }
+    });
+
     // When batching is enabled, _doTTLIndexDelete will limit the amount of work it
     // performs in both time and the number of documents it deletes. If it reaches one
     // of these limits on an index, it will return moreToDelete as true, and we will
@@ -479,20 +548,48 @@ bool TTLMonitor::_doTTLSubPass(
     Timer timer;
     do {
         TTLCollectionCache::InfoMap moreWork;
-        for (const auto& [uuid, infos] : work) {
-            // If there are multiple TTL indexes on a TTL collection, and any of those have fallen
-            // behind TTL inserts over consecutive subpasses, raising the priority to
-            // 'AdmissionContext::Priority::kNormal' for one index means the priority will be
-            // 'normal' for all indexes.
-            AdmissionContext::Priority priority = getTTLPriority(uuid, ttlPriorityMap);
-            ScopedAdmissionPriorityForLock priorityGuard(opCtx->lockState(), priority);
-
-            for (const auto& info : infos) {
-                bool moreToDelete = _doTTLIndexDelete(opCtx, &ttlCollectionCache, uuid, info);
-                if (moreToDelete) {
-                    moreWork[uuid].push_back(info);
+        if (!workers) {
+            for (const auto& [uuid, infos] : work) {
+                auto remaining = _doTTLCollectionDelete(opCtx,
+                                                        &ttlCollectionCache,
+                                                        uuid,
+                                                        infos,
+                                                        getTTLPriority(uuid, ttlPriorityMap));
+                if (!remaining.empty()) {
+                    moreWork[uuid] = std::move(remaining);
                 }
             }
+        } else {
+            Mutex roundMutex = MONGO_MAKE_LATCH("TTLMonitor::roundMutex");
+            Status roundStatus = Status::OK();
+            for (const auto& entry : work) {
+                workers->schedule([&, &entry = entry](Status status) {
+                    try {
+                        uassertStatusOK(status);
+                        auto workerOpCtx = cc().makeOperationContext();
+                        auto remaining =
+                            _doTTLCollectionDelete(workerOpCtx.get(),
+                                                   &ttlCollectionCache,
+                                                   entry.first,
+                                                   entry.second,
+                                                   getTTLPriority(entry.first, ttlPriorityMap));
+
+                        stdx::lock_guard<Latch> lk(roundMutex);
+                        if (!remaining.empty()) {
+                            moreWork[entry.first] = std::move(remaining);
+                        }
+                    } catch (const DBException& ex) {
+                        stdx::lock_guard<Latch> lk(roundMutex);
+                        if (roundStatus.isOK()) {
+                            roundStatus = ex.toStatus();
+                        }
+                    }
+                });
+            }
+            workers->waitForIdle();
+
+            // Errors escaping a collection visit concern the whole TTL pass, like interruptions.
+            uassertStatusOK(roundStatus);
         }
 
         work = moreWork;
@@ -505,6 +602,66 @@ bool TTLMonitor::_doTTLSubPass(
     return !work.empty();
 }
 
+std::vector<TTLCollectionCache::Info> TTLMonitor::_doTTLCollectionDelete(
+    OperationContext* opCtx,
+    TTLCollectionCache* ttlCollectionCache,
+    const UUID& uuid,
+    const std::vector<TTLCollectionCache::Info>& infos,
+    AdmissionContext::Priority priority) {
+    // If there are multiple TTL indexes on a TTL collection, and any of those have fallen
+    // behind TTL inserts over consecutive subpasses, raising the priority to
+    // 'AdmissionContext::Priority::kNormal' for one index means the priority will be
+    // 'normal' for all indexes.
+    ScopedAdmissionPriorityForLock priorityGuard(opCtx->lockState(), priority);
+
+    std::vector<TTLCollectionCache::Info> remaining;
+    for (const auto& info : infos) {
+        bool moreToDelete = _doTTLIndexDelete(opCtx, ttlCollectionCache, uuid, info);
+        if (moreToDelete) {
+            remaining.push_back(info);
+        }
+    }
+
+    stdx::lock_guard<Latch> lk(_lagMutex);
+    if (remaining.empty()) {
+        _collectionLag.erase(uuid);
+    } else if (_collectionLag.find(uuid) == _collectionLag.end()) {
+        if (auto nss = CollectionCatalog::get(opCtx)->lookupNSSByUUID(opCtx, uuid)) {
+            _collectionLag.emplace(uuid, CollectionLag{*nss, Date_t::now()});
+        }
+    }
+    return remaining;
+}
+
+void TTLMonitor::_pruneCollectionLag(const TTLCollectionCache::InfoMap& work) {
+    stdx::lock_guard<Latch> lk(_lagMutex);
+    for (auto it = _collectionLag.begin(); it != _collectionLag.end();) {
+        if (work.find(it->first) == work.end()) {
+            _collectionLag.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void TTLMonitor::appendCollectionLag(BSONObjBuilder* builder) const {
+    const auto now = Date_t::now();
+    stdx::lock_guard<Latch> lk(_lagMutex);
+
+    const CollectionLag* maxLag = nullptr;
+    for (const auto& [_, lag] : _collectionLag) {
+        if (!maxLag || lag.behindSince < maxLag->behindSince) {
+            maxLag = &lag;
+        }
+    }
+
+    builder->append("laggingCollections", static_cast<long long>(_collectionLag.size()));
+    builder->append("maxLagMillis",
+                    maxLag ? durationCount<Milliseconds>(now - maxLag->behindSince) : 0LL);
+    builder->append("maxLagNamespace",
+                    maxLag ? NamespaceStringUtil::serialize(maxLag->nss) : std::string());
+}
+
 bool TTLMonitor::_doTTLIndexDelete(OperationContext* opCtx,
                                    TTLCollectionCache* ttlCollectionCache,
                                    const UUID& uuid,
@@ -776,6 +933,10 @@ bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
     const auto expirationDate = safeExpirationDate(opCtx, collectionPtr, *expireAfterSeconds);
     const auto endId = makeCollScanEndBound(collectionPtr, expirationDate);
 
+    if (canTruncateExpiredRange(collection)) {
+        return _truncateExpiredRange(opCtx, collection, startId, endId);
+    }
+
     auto params = std::make_unique<DeleteStageParams>();
     params->isMulti = true;
 
@@ -827,6 +988,96 @@ bool TTLMonitor::_deleteExpiredWithCollscan(OperationContext* opCtx,
     return false;
 }
 
+bool TTLMonitor::_truncateExpiredRange(OperationContext* opCtx,
+                                       const ScopedCollectionAcquisition& collection,
+                                       const RecordIdBound& startId,
+                                       const RecordIdBound& endId) {
+    const auto& collectionPtr = collection.getCollectionPtr();
+    auto rs = collectionPtr->getRecordStore();
+    // Without batching all expired documents are removed at once, as with a collection scan.
+    const auto batchingEnabled = isBatchingEnabled();
+    const auto targetDocs = batchingEnabled ? ttlIndexDeleteTargetDocs.load() : 0;
+    const auto targetTimeMS = batchingEnabled ? ttlIndexDeleteTargetTimeMS.load() : 0;
+
+    Timer timer;
+    RecordId minRecordId;
+    RecordId maxRecordId;
+    int64_t bytesDeleted = 0;
+    int64_t docsDeleted = 0;
+    bool targetMet = false;
+    writeConflictRetry(opCtx, "TTL range truncate", collection.nss(), [&] {
+        minRecordId = RecordId();
+        maxRecordId = RecordId();
+        bytesDeleted = 0;
+        docsDeleted = 0;
+        targetMet = false;
+
+        WriteUnitOfWork wuow(opCtx);
+
+        // The truncated range is sized within the same snapshot it is truncated in, so that the
+        // size adjustments, both local and replicated, match the records actually removed.
+        // Records clustered before 'startId' have a key of another type and never expire.
+        auto cursor = rs->getCursor(opCtx, true /* forward */);
+        for (auto record = cursor->seekNear(startId.recordId()); record;
+             record = cursor->next()) {
+            if (record->id < startId.recordId()) {
+                continue;
+            }
+            if (record->id > endId.recordId()) {
+                break;
+            }
+            if (targetDocs > 0 && docsDeleted >= targetDocs) {
+                targetMet = true;
+                break;
+            }
+            // Sizing the range is what takes time, the truncate itself is cheap.
+            if (targetTimeMS > 0 && docsDeleted > 0 && timer.millis() >= targetTimeMS) {
+                targetMet = true;
+                break;
+            }
+            if (minRecordId.isNull()) {
+                minRecordId = record->id;
+            }
+            maxRecordId = record->id;
+            bytesDeleted += record->data.size();
+            ++docsDeleted;
+        }
+        cursor.reset();
+
+        if (!docsDeleted) {
+            return;
+        }
+
+        uassertStatusOK(
+            rs->rangeTruncate(opCtx, minRecordId, maxRecordId, -bytesDeleted, -docsDeleted));
+        opCtx->getServiceContext()->getOpObserver()->onTruncateRange(
+            opCtx, collectionPtr, minRecordId, maxRecordId, bytesDeleted, docsDeleted);
+        wuow.commit();
+    });
+
+    if (docsDeleted) {
+        ttlDeletedDocuments.increment(docsDeleted);
+        ttlTruncatedRanges.increment();
+    }
+
+    const auto duration = Milliseconds(timer.millis());
+    if (shouldLogSlowOpWithSampling(opCtx,
+                                    logv2::LogComponent::kIndex,
+                                    duration,
+                                    Milliseconds(serverGlobalParams.slowMS.load()))
+            .first) {
+        LOGV2(9394000,
+              "Truncated expired range of clustered collection",
+              logAttrs(collection.nss()),
+              "numDeleted"_attr = docsDeleted,
+              "bytesDeleted"_attr = bytesDeleted,
+              "duration"_attr = duration);
+    }
+
+    // A pass target met implies there may be more work to be done on the collection.
+    return targetMet;
+}
+
 void startTTLMonitor(ServiceContext* serviceContext) {
     std::unique_ptr<TTLMonitor> ttlMonitor = std::make_unique<TTLMonitor>();
     ttlMonitor->go();
@@ -29,9 +29,11 @@
 
 #pragma once
 
+#include "mongo/db/query/record_id_bound.h"
 #include "mongo/db/shard_role.h"
 #include "mongo/db/ttl_collection_cache.h"
 #include "mongo/util/background.h"
+#include "mongo/util/concurrency/admission_context.h"
 
 namespace mongo {
 
@@ -76,6 +78,13 @@ public:
 
     void updateSleepSeconds(Seconds newSeconds);
 
+    /**
+     * Appends the number of collections whose expired documents could not all be removed by their
+     * last visit, and for how long and on which collection the TTLMonitor has continuously been
+     * behind the longest.
+     */
+    void appendCollectionLag(BSONObjBuilder* builder) const;
+
     long long getTTLPasses_forTest();
     long long getTTLSubPasses_forTest();
 
@@ -104,6 +113,26 @@ private:
     bool _doTTLSubPass(OperationContext* opCtx,
                        stdx::unordered_map<UUID, long long, UUID::Hash>& collSubpassHistory);
 
+    /**
+     * Removes expired documents through each of the TTL indexes 'infos' of the collection 'uuid',
+     * with TTL deletes executed at 'priority'. Records whether the collection is behind on TTL
+     * deletes afterwards.
+     *
+     * Returns the TTL indexes through which there are more expired documents to delete.
+     */
+    std::vector<TTLCollectionCache::Info> _doTTLCollectionDelete(
+        OperationContext* opCtx,
+        TTLCollectionCache* ttlCollectionCache,
+        const UUID& uuid,
+        const std::vector<TTLCollectionCache::Info>& infos,
+        AdmissionContext::Priority priority);
+
+    /**
+     * Stops reporting the lag of the collections which are not part of the sub-pass 'work', such
+     * as dropped collections or collections whose TTL indexes were dropped.
+     */
+    void _pruneCollectionLag(const TTLCollectionCache::InfoMap& work);
+
     /**
      * Given a TTL index, attempts to delete all expired documents through the index until
      * - hitting the batched delete document or time limit for a single TTL index
@@ -156,6 +185,20 @@ private:
                                     TTLCollectionCache* ttlCollectionCache,
                                     const ScopedCollectionAcquisition& collection);
 
+    /*
+     * Removes the expired records of a clustered collection in [startId, endId] with a single
+     * range truncate of its record store, replicated as one 'truncateRange' oplog entry. At most
+     * 'ttlIndexDeleteTargetDocs' records are removed per call, and the range stops growing once
+     * 'ttlIndexDeleteTargetTimeMS' has elapsed.
+     *
+     * Returns true if there are more expired documents to delete through the clustered index at
+     * this time. False otherwise.
+     */
+    bool _truncateExpiredRange(OperationContext* opCtx,
+                               const ScopedCollectionAcquisition& collection,
+                               const RecordIdBound& startId,
+                               const RecordIdBound& endId);
+
     // Protects the state below.
     mutable Mutex _stateMutex = MONGO_MAKE_LATCH("TTLMonitorStateMutex");
 
@@ -168,6 +211,17 @@ private:
 
     bool _shuttingDown = false;
     Seconds _ttlMonitorSleepSecs;
+
+    struct CollectionLag {
+        NamespaceString nss;
+        Date_t behindSince;
+    };
+
+    // Protects '_collectionLag'. Collections may be visited concurrently by the TTL workers.
+    mutable Mutex _lagMutex = MONGO_MAKE_LATCH("TTLMonitorLagMutex");
+
+    // Collections which still had expired documents after their last visit, and since when.
+    stdx::unordered_map<UUID, CollectionLag, UUID::Hash> _collectionLag;
 };
 
 }  // namespace mongo
@@ -100,6 +100,12 @@ protected:
         return ttlMonitor->getTTLSubPasses_forTest();
     }
 
+    BSONObj getCollectionLag() {
+        BSONObjBuilder builder;
+        TTLMonitor::get(getGlobalServiceContext())->appendCollectionLag(&builder);
+        return builder.obj();
+    }
+
     // Bypasses the need for a two-phase index build with a commit quorum through DBClient.
     void createIndex(const NamespaceString& nss,
                      const BSONObj& keyPattern,
@@ -167,6 +173,17 @@ public:
         _client.createCollection(nss);
     }
 
+    void createClusteredCollection(const NamespaceString& nss, Seconds expireAfterSeconds) {
+        BSONObj result;
+        ASSERT(_client.runCommand(
+            nss.dbName(),
+            BSON("create" << nss.coll() << "clusteredIndex"
+                          << BSON("key" << BSON("_id" << 1) << "unique" << true)
+                          << "expireAfterSeconds" << durationCount<Seconds>(expireAfterSeconds)),
+            result))
+            << result;
+    }
+
 private:
     DBDirectClient _client;
     OperationContext* _opCtx;
@@ -250,6 +267,161 @@ TEST_F(TTLTest, TTLPassMultipCollectionsPass) {
     ASSERT_EQ(getTTLPasses(), initTTLPasses + 1);
 }
 
+TEST_F(TTLTest, TTLPassMultipleCollectionsConcurrently) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+    RAIIServerParameterControllerForTest ttlMaxConcurrentCollectionsController(
+        "ttlMonitorMaxConcurrentCollections", 3);
+
+    // Require several rounds of batched deletes on the larger collections.
+    RAIIServerParameterControllerForTest ttlIndexDeleteTargetDocsController(
+        "ttlIndexDeleteTargetDocs", 20);
+
+    SimpleClient client(opCtx());
+
+    std::vector<NamespaceString> namespaces;
+    for (int i = 0; i < 4; ++i) {
+        namespaces.push_back(NamespaceString::createNamespaceString_forTest(
+            "testDB.concurrentColl" + std::to_string(i)));
+        client.createCollection(namespaces.back());
+        createIndex(namespaces.back(), BSON("x" << 1), "testIndexX", Seconds(1));
+        client.insertExpiredDocs(namespaces.back(), "x", 5 + 50 * i);
+    }
+
+    auto initTTLPasses = getTTLPasses();
+
+    stdx::thread thread([&]() {
+        // TTLMonitor::doTTLPass creates a new OperationContext, which cannot be done on the
+        // current client because the OperationContext already exists.
+        ThreadClient threadClient(getGlobalServiceContext());
+        doTTLPassForTest();
+    });
+    thread.join();
+
+    // All expired documents are removed and no collection is left behind.
+    for (const auto& nss : namespaces) {
+        ASSERT_EQ(client.count(nss), 0);
+    }
+    ASSERT_EQ(getCollectionLag()["laggingCollections"].numberLong(), 0);
+    ASSERT_EQ(getTTLPasses(), initTTLPasses + 1);
+}
+
+TEST_F(TTLTest, TTLCollectionLagReportedUntilCaughtUp) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+
+    // Visit each collection once per sub-pass.
+    RAIIServerParameterControllerForTest ttlMonitorSubPassTargetSecsController(
+        "ttlMonitorSubPassTargetSecs", 0);
+    RAIIServerParameterControllerForTest ttlIndexDeleteTargetDocsController(
+        "ttlIndexDeleteTargetDocs", 20);
+
+    SimpleClient client(opCtx());
+
+    NamespaceString nssBehind = NamespaceString::createNamespaceString_forTest("testDB.behind");
+    NamespaceString nssCaughtUp = NamespaceString::createNamespaceString_forTest("testDB.caughtUp");
+    client.createCollection(nssBehind);
+    client.createCollection(nssCaughtUp);
+    createIndex(nssBehind, BSON("x" << 1), "testIndexX", Seconds(1));
+    createIndex(nssCaughtUp, BSON("x" << 1), "testIndexX", Seconds(1));
+    client.insertExpiredDocs(nssBehind, "x", 50);
+    client.insertExpiredDocs(nssCaughtUp, "x", 5);
+
+    // Only the collection whose expired documents could not all be removed is reported.
+    ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+    auto lag = getCollectionLag();
+    ASSERT_EQ(lag["laggingCollections"].numberLong(), 1);
+    ASSERT_GTE(lag["maxLagMillis"].numberLong(), 0);
+    ASSERT_EQ(lag["maxLagNamespace"].str(), NamespaceStringUtil::serialize(nssBehind));
+
+    while (doTTLSubPassForTest(opCtx())) {
+    }
+    ASSERT_EQ(client.count(nssBehind), 0);
+    ASSERT_BSONOBJ_EQ(
+        getCollectionLag(),
+        BSON("laggingCollections" << 0LL << "maxLagMillis" << 0LL << "maxLagNamespace" << ""));
+}
+
+TEST_F(TTLTest, TTLCollectionLagPrunedWhenTTLIndexRemoved) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+
+    // Visit each collection once per sub-pass.
+    RAIIServerParameterControllerForTest ttlMonitorSubPassTargetSecsController(
+        "ttlMonitorSubPassTargetSecs", 0);
+    RAIIServerParameterControllerForTest ttlIndexDeleteTargetDocsController(
+        "ttlIndexDeleteTargetDocs", 20);
+
+    SimpleClient client(opCtx());
+
+    NamespaceString nssBehind = NamespaceString::createNamespaceString_forTest("testDB.behind");
+    NamespaceString nssOther = NamespaceString::createNamespaceString_forTest("testDB.other");
+    client.createCollection(nssBehind);
+    client.createCollection(nssOther);
+    createIndex(nssBehind, BSON("x" << 1), "testIndexX", Seconds(1));
+    createIndex(nssOther, BSON("x" << 1), "testIndexX", Seconds(1));
+    client.insertExpiredDocs(nssBehind, "x", 50);
+
+    ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+    ASSERT_EQ(getCollectionLag()["laggingCollections"].numberLong(), 1);
+
+    // The collection is no longer part of the next sub-pass, so its lag is no longer reported.
+    auto uuid = [&] {
+        AutoGetCollection collection(opCtx(), nssBehind, MODE_IS);
+        return collection->uuid();
+    }();
+    TTLCollectionCache::get(getGlobalServiceContext())
+        .deregisterTTLIndexByName(uuid, "testIndexX");
+
+    ASSERT_FALSE(doTTLSubPassForTest(opCtx()));
+    ASSERT_EQ(getCollectionLag()["laggingCollections"].numberLong(), 0);
+    ASSERT_EQ(client.count(nssBehind), 30);
+}
+
+TEST_F(TTLTest, TTLPassTruncatesExpiredClusteredRange) {
+    RAIIServerParameterControllerForTest featureFlagController("featureFlagBatchMultiDeletes",
+                                                               true);
+    RAIIServerParameterControllerForTest ttlBatchDeletesController("ttlMonitorBatchDeletes", true);
+    RAIIServerParameterControllerForTest rangeTruncateFeatureFlagController(
+        "featureFlagTTLClusteredRangeTruncate", true);
+    RAIIServerParameterControllerForTest rangeTruncateController(
+        "ttlMonitorClusteredRangeTruncate", true);
+    RAIIServerParameterControllerForTest targetDocsController("ttlIndexDeleteTargetDocs", 20);
+
+    // Visit the collection only once per sub-pass.
+    RAIIServerParameterControllerForTest ttlMonitorSubPassTargetSecsController(
+        "ttlMonitorSubPassTargetSecs", 0);
+
+    SimpleClient client(opCtx());
+
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("testDB.clustered");
+    client.createClusteredCollection(nss, Seconds(1));
+
+    // Documents clustered by a key that is not a date never expire, and neither do the ones that
+    // are not old enough yet.
+    client.insertExpiredDocs(nss, "_id", 50);
+    client.insert(nss, BSON("_id" << 1));
+    client.insert(nss, BSON("_id" << Date_t::now() + Hours(1)));
+    ASSERT_EQ(client.count(nss), 52);
+
+    // Each sub-pass truncates at most 'ttlIndexDeleteTargetDocs' documents in a single range.
+    ASSERT_TRUE(doTTLSubPassForTest(opCtx()));
+    ASSERT_EQ(client.count(nss), 32);
+
+    stdx::thread thread([&]() {
+        // TTLMonitor::doTTLPass creates a new OperationContext, which cannot be done on the
+        // current client because the OperationContext already exists.
+        ThreadClient threadClient(getGlobalServiceContext());
+        doTTLPassForTest();
+    });
+    thread.join();
+
+    ASSERT_EQ(client.count(nss), 2);
+}
+
 // Demonstrate sub-pass behavior when all expired documents are drained before the sub-pass reaches
 // its time limit.
 TEST_F(TTLTest, TTLSingleSubPass) {
@@ -239,6 +239,11 @@ OpTime ReplicationCoordinatorEmbedded::getMyLastAppliedOpTime() const {
     UASSERT_NOT_IMPLEMENTED;
 }
 
+boost::optional<ReplicationCoordinator::ReplicationLagEstimate>
+ReplicationCoordinatorEmbedded::estimateReplicationLag() const {
+    return boost::none;
+}
+
 OpTimeAndWallTime ReplicationCoordinatorEmbedded::getMyLastDurableOpTimeAndWallTime() const {
     UASSERT_NOT_IMPLEMENTED;
 }
@@ -144,6 +144,8 @@ public:
     repl::OpTimeAndWallTime getMyLastAppliedOpTimeAndWallTime(
         bool rollbackSafe = false) const override;
 
+    boost::optional<ReplicationLagEstimate> estimateReplicationLag() const override;
+
     repl::OpTime getMyLastDurableOpTime() const override;
     repl::OpTimeAndWallTime getMyLastDurableOpTimeAndWallTime() const override;
 
@@ -29,17 +29,31 @@
 
 #include "mongo/logv2/file_rotate_sink.h"
 
+#include <algorithm>
+#include <bit>
 #include <boost/exception/diagnostic_information.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/iterator/filter_iterator.hpp>
 #include <boost/iterator/transform_iterator.hpp>
+#include <boost/log/attributes/value_extraction.hpp>
 #include <boost/make_shared.hpp>
 #include <fmt/format.h>
 #include <fstream>
+#include <functional>
+#include <vector>
 
+#include "mongo/logv2/attributes.h"
 #include "mongo/logv2/json_formatter.h"
 #include "mongo/logv2/log_detail.h"
+#include "mongo/logv2/log_severity.h"
 #include "mongo/logv2/shared_access_fstream.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/aligned.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/duration.h"
 #include "mongo/util/exit_code.h"
 #include "mongo/util/quick_exit.h"
 #include "mongo/util/stacktrace.h"
@@ -71,12 +85,258 @@ StatusWith<boost::shared_ptr<stream_t>> openFile(const std::string& filename, bo
         file->put('\n');
     return file;
 }
+
+/**
+ * Bounded queue of log lines with a single producer and a single consumer, which takes no locks.
+ *
+ * The producer is the thread in FileRotateSink::consume(), which CompositeBackend serializes with
+ * its per-backend mutex, and the consumer is the writer thread. The producer copies its line into
+ * the slot at the tail before publishing it by advancing the tail, and the consumer hands slots
+ * back by advancing the head. Slots keep the capacity of their strings, so pushing a line does not
+ * allocate once the queue has warmed up.
+ */
+class LogLineQueue {
+public:
+    explicit LogLineQueue(std::size_t capacity)
+        : _mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1), _lines(_mask + 1) {}
+
+    /**
+     * Returns false without waiting if the queue is full. Must only be called by the producer.
+     */
+    bool tryPush(StringData line) {
+        const auto tail = _tail->loadRelaxed();
+        if (tail - _head->load() == _lines.size()) {
+            return false;
+        }
+        _lines[tail & _mask].assign(line.rawData(), line.size());
+        _tail->store(tail + 1);
+        return true;
+    }
+
+    /**
+     * Swaps up to lines->size() published lines into 'lines' and returns how many were taken. Must
+     * only be called by the consumer.
+     */
+    std::size_t popBatch(std::vector<std::string>* lines) {
+        const auto head = _head->loadRelaxed();
+        const auto count = std::min<std::uint64_t>(_tail->load() - head, lines->size());
+        for (std::size_t i = 0; i < count; ++i) {
+            std::swap((*lines)[i], _lines[(head + i) & _mask]);
+        }
+        _head->store(head + count);
+        return count;
+    }
+
+    /**
+     * Returns whether a line is published for the consumer. Must only be called by the consumer.
+     */
+    bool hasPublished() const {
+        return _tail->load() != _head->loadRelaxed();
+    }
+
+    /**
+     * Returns the number of lines ever pushed.
+     */
+    std::uint64_t pushed() const {
+        return _tail->load();
+    }
+
+private:
+    const std::uint64_t _mask;
+    std::vector<std::string> _lines;
+
+    // Only advanced by the producer.
+    CacheExclusive<AtomicWord<std::uint64_t>> _tail;
+
+    // Only advanced by the consumer.
+    CacheExclusive<AtomicWord<std::uint64_t>> _head;
+};
+
+/**
+ * Counters over all the asynchronous writers of the process, see FileRotateSink::asyncWriteStats.
+ */
+struct AsyncWriteCounters {
+    AtomicWord<long long> queuedLines{0};
+    AtomicWord<long long> writtenLines{0};
+    AtomicWord<long long> droppedLines{0};
+    AtomicWord<long long> blockedWrites{0};
+};
+
+AsyncWriteCounters asyncWriteCounters;
+
+std::string formatDroppedLines(std::uint64_t dropped, LogTimestampFormat timestampFormat) {
+    DynamicAttributes attrs;
+    attrs.add("droppedLines", static_cast<long long>(dropped));
+
+    fmt::memory_buffer buffer;
+    JSONFormatter(nullptr, timestampFormat)
+        .format(buffer,
+                LogSeverity::Warning(),
+                LogComponent::kControl,
+                Date_t::now(),
+                9394900,
+                getThreadName(),
+                "Dropped log lines because the asynchronous log queue was full",
+                TypeErasedAttributeStorage(attrs),
+                LogTag::kNone,
+                std::string() /* tenantID */,
+                LogTruncation::Disabled);
+    // Commented out log line below to get validation of the log id with the errorcodes linter
+    // LOGV2_WARNING(9394900, "Dropped log lines because the asynchronous log queue was full");
+    return std::string(buffer.data(), buffer.size());
+}
+
+/**
+ * Thread which writes the lines queued by the logging threads, see
+ * FileRotateSink::enableAsyncWrites.
+ */
+class AsyncLogWriter {
+public:
+    using WriteFn = std::function<void(const std::string* lines, std::size_t count)>;
+
+    AsyncLogWriter(std::size_t queueSize,
+                   LogOverflowPolicy overflowPolicy,
+                   LogTimestampFormat timestampFormat,
+                   WriteFn write)
+        : _queue(queueSize),
+          _overflowPolicy(overflowPolicy),
+          _timestampFormat(timestampFormat),
+          _write(std::move(write)),
+          _thread([this] { _run(); }) {}
+
+    ~AsyncLogWriter() {
+        {
+            stdx::lock_guard lk(_mutex);
+            _stopping = true;
+            _wakeWriter.notify_one();
+        }
+        _thread.join();
+    }
+
+    /**
+     * Must be called with the lock which serializes FileRotateSink::consume(), which makes this the
+     * only producer of the queue.
+     */
+    void push(StringData line) {
+        if (!_queue.tryPush(line)) {
+            if (_overflowPolicy == LogOverflowPolicy::kDrop) {
+                _dropped.fetchAndAdd(1);
+                asyncWriteCounters.droppedLines.fetchAndAdd(1);
+                return;
+            }
+
+            asyncWriteCounters.blockedWrites.fetchAndAdd(1);
+            _waiters.fetchAndAdd(1);
+            do {
+                stdx::unique_lock lk(_mutex);
+                _wakeWriter.notify_one();
+                _progress.wait_for(lk, kRetryInterval.toSystemDuration());
+            } while (!_queue.tryPush(line));
+            _waiters.fetchAndSubtract(1);
+        }
+        asyncWriteCounters.queuedLines.fetchAndAdd(1);
+
+        // The writer marks itself idle before checking the queue a last time, so either it sees
+        // the line or this sees it idle.
+        if (_writerIdle.load()) {
+            stdx::lock_guard lk(_mutex);
+            _wakeWriter.notify_one();
+        }
+    }
+
+    /**
+     * Waits until the lines pushed so far have been written.
+     */
+    void drain() {
+        const auto target = _queue.pushed();
+        if (_written.load() >= target || stdx::this_thread::get_id() == _thread.get_id()) {
+            return;
+        }
+
+        _waiters.fetchAndAdd(1);
+        {
+            stdx::unique_lock lk(_mutex);
+            _wakeWriter.notify_one();
+            while (_written.load() < target) {
+                _progress.wait_for(lk, kRetryInterval.toSystemDuration());
+            }
+        }
+        _waiters.fetchAndSubtract(1);
+    }
+
+private:
+    void _run() {
+        setThreadName("LogWriter");
+
+        std::vector<std::string> batch(kMaxBatchSize);
+        std::uint64_t reportedDropped = 0;
+        while (true) {
+            const auto count = _queue.popBatch(&batch);
+            if (count != 0) {
+                _write(batch.data(), count);
+                _written.fetchAndAdd(count);
+                asyncWriteCounters.writtenLines.fetchAndAdd(count);
+                if (_waiters.load()) {
+                    stdx::lock_guard lk(_mutex);
+                    _progress.notify_all();
+                }
+            }
+
+            if (auto dropped = _dropped.load(); dropped != reportedDropped) {
+                auto line = formatDroppedLines(dropped - reportedDropped, _timestampFormat);
+                _write(&line, 1);
+                reportedDropped = dropped;
+            }
+
+            if (count == kMaxBatchSize) {
+                continue;
+            }
+
+            stdx::unique_lock lk(_mutex);
+            _writerIdle.store(true);
+            if (!_queue.hasPublished()) {
+                if (_stopping) {
+                    break;
+                }
+                _wakeWriter.wait_for(lk, kIdleInterval.toSystemDuration());
+            }
+            _writerIdle.store(false);
+        }
+    }
+
+    static constexpr std::size_t kMaxBatchSize = 256;
+    static constexpr Milliseconds kRetryInterval{1};
+    static constexpr Milliseconds kIdleInterval{100};
+
+    LogLineQueue _queue;
+    const LogOverflowPolicy _overflowPolicy;
+    const LogTimestampFormat _timestampFormat;
+    const WriteFn _write;
+
+    stdx::mutex _mutex;  // NOLINT(mongo-mutex-check)
+    stdx::condition_variable _wakeWriter;
+    stdx::condition_variable _progress;
+    bool _stopping{false};
+
+    AtomicWord<bool> _writerIdle{false};
+    AtomicWord<int> _waiters{0};
+    AtomicWord<std::uint64_t> _written{0};
+    AtomicWord<std::uint64_t> _dropped{0};
+
+    stdx::thread _thread;
+};
 }  // namespace
 
 struct FileRotateSink::Impl {
     Impl(LogTimestampFormat tsFormat) : timestampFormat(tsFormat) {}
     StringMap<boost::shared_ptr<stream_t>> files;
     LogTimestampFormat timestampFormat;
+
+    // Serializes the writes of the async writer thread with the other accesses to the files.
+    stdx::mutex streamMutex;  // NOLINT(mongo-mutex-check)
+
+    // Declared last so that its thread is joined before the files are destroyed.
+    std::unique_ptr<AsyncLogWriter> asyncWriter;
 };
 
 FileRotateSink::FileRotateSink(LogTimestampFormat timestampFormat)
@@ -84,6 +344,7 @@ FileRotateSink::FileRotateSink(LogTimestampFormat timestampFormat)
 FileRotateSink::~FileRotateSink() {}
 
 Status FileRotateSink::addFile(const std::string& filename, bool append) {
+    stdx::lock_guard lk(_impl->streamMutex);
     auto statusWithFile = openFile(filename, append);
     if (statusWithFile.isOK()) {
         add_stream(statusWithFile.getValue());
@@ -93,6 +354,7 @@ Status FileRotateSink::addFile(const std::string& filename, bool append) {
     return statusWithFile.getStatus().withContext("Can't initialize rotatable log file");
 }
 void FileRotateSink::removeFile(const std::string& filename) {
+    stdx::lock_guard lk(_impl->streamMutex);
     auto it = _impl->files.find(filename);
     if (it != _impl->files.cend()) {
         remove_stream(it->second);
@@ -103,6 +365,12 @@ void FileRotateSink::removeFile(const std::string& filename) {
 Status FileRotateSink::rotate(bool rename,
                               StringData renameSuffix,
                               std::function<void(Status)> onMinorError) {
+    // Lines logged before the rotation go to the rotated file.
+    if (_impl->asyncWriter) {
+        _impl->asyncWriter->drain();
+    }
+    stdx::lock_guard lk(_impl->streamMutex);
+
     for (auto& file : _impl->files) {
         const std::string& filename = file.first;
         if (rename) {
@@ -162,12 +430,70 @@ Status FileRotateSink::rotate(bool rename,
     return Status::OK();
 }
 
+void FileRotateSink::enableAsyncWrites(std::size_t queueSize, LogOverflowPolicy overflowPolicy) {
+    invariant(!_impl->asyncWriter);
+    _impl->asyncWriter = std::make_unique<AsyncLogWriter>(
+        queueSize,
+        overflowPolicy,
+        _impl->timestampFormat,
+        [this](const std::string* lines, std::size_t count) {
+            stdx::lock_guard lk(_impl->streamMutex);
+            _writeLines(lines, count);
+        });
+}
+
+FileRotateSink::AsyncWriteStats FileRotateSink::asyncWriteStats() {
+    return {asyncWriteCounters.queuedLines.load(),
+            asyncWriteCounters.writtenLines.load(),
+            asyncWriteCounters.droppedLines.load(),
+            asyncWriteCounters.blockedWrites.load()};
+}
+
 void FileRotateSink::consume(const boost::log::record_view& rec,
                              const string_type& formatted_string) {
+    if (_impl->asyncWriter) {
+        auto severity = boost::log::extract<LogSeverity>(attributes::severity(), rec);
+        if (!severity || severity.get() < LogSeverity::Error()) {
+            _impl->asyncWriter->push(formatted_string);
+            return;
+        }
+
+        _impl->asyncWriter->drain();
+        stdx::lock_guard lk(_impl->streamMutex);
+        boost::log::sinks::text_ostream_backend::consume(rec, formatted_string);
+        _abortIfWriteFailed();
+        return;
+    }
+
+    boost::log::sinks::text_ostream_backend::consume(rec, formatted_string);
+    _abortIfWriteFailed();
+}
+
+void FileRotateSink::flush() {
+    if (_impl->asyncWriter) {
+        _impl->asyncWriter->drain();
+    }
+    stdx::lock_guard lk(_impl->streamMutex);
+    boost::log::sinks::text_ostream_backend::flush();
+}
+
+void FileRotateSink::_writeLines(const std::string* lines, std::size_t count) {
+    for (auto& file : _impl->files) {
+        for (std::size_t i = 0; i < count; ++i) {
+            *file.second << lines[i];
+            if (lines[i].empty() || lines[i].back() != '\n') {
+                file.second->put('\n');
+            }
+        }
+        file.second->flush();
+    }
+    _abortIfWriteFailed();
+}
+
+void FileRotateSink::_abortIfWriteFailed() {
     auto isFailed = [](const auto& file) {
         return file.second->fail();
     };
-    boost::log::sinks::text_ostream_backend::consume(rec, formatted_string);
     if (std::any_of(_impl->files.begin(), _impl->files.end(), isFailed)) {
         try {
             auto failedBegin =
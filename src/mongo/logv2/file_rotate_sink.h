@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/log/sinks/text_ostream_backend.hpp>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -50,9 +51,52 @@ public:
 
     Status rotate(bool rename, StringData renameSuffix, std::function<void(Status)> onMinorError);
 
+    /**
+     * Writes log lines on a dedicated writer thread instead of the logging threads. consume() then
+     * only copies the formatted line into a lock-free queue of 'queueSize' lines, which the writer
+     * thread drains in batches, flushing the files once per batch. 'overflowPolicy' decides
+     * whether a logging thread which finds the queue full waits for space or drops its line. The
+     * writer thread logs how many lines were dropped.
+     *
+     * consume() is serialized by the lock of the composite backend holding this sink, so the
+     * logging threads still take turns to enqueue, and a thread waiting for space under kBlock
+     * holds up every other thread logging to the file until the writer catches up.
+     *
+     * Lines of Error severity or above are written synchronously once the queue has been drained,
+     * so that they reach the files before the process terminates.
+     *
+     * Must be called before the sink is attached to the logging core, or under the lock that
+     * serializes calls to consume().
+     */
+    void enableAsyncWrites(std::size_t queueSize, LogOverflowPolicy overflowPolicy);
+
     void consume(const boost::log::record_view& rec, const string_type& formatted_string);
 
+    struct AsyncWriteStats {
+        long long queuedLines;
+        long long writtenLines;
+        long long droppedLines;
+        // Number of lines whose logging thread had to wait for space in the queue.
+        long long blockedWrites;
+    };
+
+    /**
+     * Returns counters summed over the asynchronous writers of all sinks in this process.
+     */
+    static AsyncWriteStats asyncWriteStats();
+
+    /**
+     * Waits until the lines consumed so far have been written, then flushes the files.
+     */
+    void flush();
+
 private:
+    // Writes the lines to all files and flushes them. Must hold the stream mutex.
+    void _writeLines(const std::string* lines, std::size_t count);
+
+    // Aborts the process if writing to any of the files failed.
+    void _abortIfWriteFailed();
+
     struct Impl;
     std::unique_ptr<Impl> _impl;
 };
@@ -79,6 +79,7 @@ struct LogDomainGlobal::Impl {
     Impl(LogDomainGlobal& parent);
     Status configure(LogDomainGlobal::ConfigurationOptions const& options);
     Status rotate(bool rename, StringData renameSuffix, std::function<void(Status)> onMinorError);
+    void startAsyncFileWriter();
 
     const ConfigurationOptions& config() const;
 
@@ -96,6 +97,7 @@ struct LogDomainGlobal::Impl {
     AtomicWord<int32_t> activeSourceThreadLocals{0};
     LogSource shutdownLogSource{&_parent, true};
     bool isInShutdown{false};
+    bool asyncFileWriterStarted{false};
 };
 
 LogDomainGlobal::Impl::Impl(LogDomainGlobal& parent) : _parent(parent) {
@@ -171,6 +173,10 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
             boost::make_shared<RamLogSink>(RamLog::get("global")),
             boost::make_shared<RamLogSink>(RamLog::get("startupWarnings")),
             boost::make_shared<UserAssertSink>());
+        if (options.fileAsyncQueueSize != 0 && asyncFileWriterStarted) {
+            backend->lockedBackend<0>()->enableAsyncWrites(options.fileAsyncQueueSize,
+                                                           options.fileAsyncOverflowPolicy);
+        }
         Status ret = backend->lockedBackend<0>()->addFile(
             options.filePath,
             options.fileOpenMode == ConfigurationOptions::OpenMode::kAppend ? true : false);
@@ -271,6 +277,16 @@ Status LogDomainGlobal::Impl::rotate(bool rename,
     return result;
 }
 
+void LogDomainGlobal::Impl::startAsyncFileWriter() {
+    if (asyncFileWriterStarted)
+        return;
+    asyncFileWriterStarted = true;
+    if (!_rotatableFileSink || _config.fileAsyncQueueSize == 0)
+        return;
+    _rotatableFileSink->locked_backend()->lockedBackend<0>()->enableAsyncWrites(
+        _config.fileAsyncQueueSize, _config.fileAsyncOverflowPolicy);
+}
+
 LogSource& LogDomainGlobal::Impl::source() {
     // Use a thread_local logger so we don't need to have locking. thread_locals are destroyed
     // before statics so keep track of number of thread_locals we have active and if this code
@@ -326,6 +342,10 @@ Status LogDomainGlobal::rotate(bool rename,
     return _impl->rotate(rename, renameSuffix, onMinorError);
 }
 
+void LogDomainGlobal::startAsyncFileWriter() {
+    _impl->startAsyncFileWriter();
+}
+
 LogComponentSettings& LogDomainGlobal::settings() {
     return _impl->_settings;
 }
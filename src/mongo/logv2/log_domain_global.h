@@ -45,6 +45,10 @@ public:
         std::string filePath;
         RotationMode fileRotationMode{RotationMode::kRename};
         OpenMode fileOpenMode{OpenMode::kTruncate};
+        // Number of lines queued for the asynchronous file writer, 0 writes synchronously. The
+        // writer thread only starts once startAsyncFileWriter() has been called.
+        std::size_t fileAsyncQueueSize{0};
+        LogOverflowPolicy fileAsyncOverflowPolicy{LogOverflowPolicy::kBlock};
         LogTimestampFormat timestampFormat{LogTimestampFormat::kISO8601UTC};
         bool syslogEnabled{false};
         int syslogFacility{-1};  // invalid facility by default, must be set
@@ -64,6 +68,12 @@ public:
     Status configure(ConfigurationOptions const& options);
     Status rotate(bool rename, StringData renameSuffix, std::function<void(Status)> onMinorError);
 
+    /**
+     * Starts the asynchronous file writer if the configuration asks for one, and makes later
+     * configurations start theirs right away. Must be called once the process may create threads.
+     */
+    void startAsyncFileWriter();
+
     const ConfigurationOptions& config() const;
 
     LogComponentSettings& settings();
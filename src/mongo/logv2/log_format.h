@@ -33,5 +33,6 @@ namespace mongo::logv2 {
 
 enum class LogFormat { kDefault, kJson, kPlain };
 enum class LogTimestampFormat { kISO8601UTC, kISO8601Local };
+enum class LogOverflowPolicy { kBlock, kDrop };
 
 }  // namespace mongo::logv2
@@ -30,7 +30,11 @@
 
 #include "mongo/logv2/log_util.h"
 
+#include <boost/log/core/core.hpp>
+
 #include "mongo/logv2/log.h"
+#include "mongo/logv2/log_domain_global.h"
+#include "mongo/logv2/log_manager.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/time_support.h"
 
@@ -52,6 +56,14 @@ void addLogRotator(StringData logType, LogRotateCallback cb) {
     logRotateCallbacks.emplace(logType, std::move(cb));
 }
 
+void startAsyncFileWriter() {
+    LogManager::global().getGlobalDomainInternal().startAsyncFileWriter();
+}
+
+void flushLogs() {
+    boost::log::core::get()->flush();
+}
+
 void LogRotateErrorAppender::append(const Status& err) {
     if (_combined.isOK()) {
         _combined = err;
@@ -49,6 +49,19 @@ using LogRotateCallback = std::function<Status(bool, StringData, std::function<v
  */
 void addLogRotator(StringData logType, LogRotateCallback cb);
 
+/**
+ * Starts the writer thread of the server log file if logging is configured to write it
+ * asynchronously. Must be called after multithreading is allowed and the signal processing thread
+ * has started, so that the writer thread inherits its signal mask.
+ */
+void startAsyncFileWriter();
+
+/**
+ * Writes out the log lines still queued by asynchronous sinks and flushes all sinks. Call before
+ * exiting the process without running destructors.
+ */
+void flushLogs();
+
 /**
  * Class that combines error Status objects into a single Status object.
  */
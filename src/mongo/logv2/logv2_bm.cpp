@@ -35,6 +35,7 @@
 #include "mongo/platform/basic.h"
 
 #include <benchmark/benchmark.h>
+#include <boost/filesystem/operations.hpp>
 #include <boost/iostreams/device/null.hpp>
 #include <boost/iostreams/stream.hpp>
 #include <boost/log/sinks/sync_frontend.hpp>
@@ -98,6 +99,42 @@ private:
     bool _shouldInit;
 };
 
+// RAII style helper class to log to a temporary file through the global domain, like a server
+// started with --logpath does. state.range(0) is the queue size of the asynchronous file writer,
+// 0 writes synchronously, and state.range(1) the LogOverflowPolicy.
+class ScopedFileLogV2Bench {
+public:
+    ScopedFileLogV2Bench(benchmark::State& state) {
+        _shouldInit = state.thread_index == 0;
+        if (_shouldInit) {
+            _path = boost::filesystem::temp_directory_path() /
+                boost::filesystem::unique_path("logv2_bm_%%%%-%%%%-%%%%.log");
+
+            logv2::LogDomainGlobal::ConfigurationOptions config;
+            config.makeDisabled();
+            config.fileEnabled = true;
+            config.filePath = _path.string();
+            config.fileAsyncQueueSize = state.range(0);
+            config.fileAsyncOverflowPolicy = static_cast<logv2::LogOverflowPolicy>(state.range(1));
+            auto& domain = logv2::LogManager::global().getGlobalDomainInternal();
+            invariant(domain.configure(config).isOK());
+            domain.startAsyncFileWriter();
+        }
+    }
+
+    ~ScopedFileLogV2Bench() {
+        if (_shouldInit) {
+            invariant(logv2::LogManager::global().getGlobalDomainInternal().configure({}).isOK());
+            boost::system::error_code ec;
+            boost::filesystem::remove(_path, ec);
+        }
+    }
+
+private:
+    boost::filesystem::path _path;
+    bool _shouldInit;
+};
+
 // "Expensive" way to create a string.
 std::string createLongString() {
     return std::string(1000, 'a') + std::string(1000, 'b') + std::string(1000, 'c') +
@@ -151,6 +188,20 @@ void BM_EnabledLogV2ManySmallArg(benchmark::State& state) {
     }
 }
 
+void BM_FileLogV2(benchmark::State& state) {
+    ScopedFileLogV2Bench init(state);
+
+    for (auto _ : state)
+        LOGV2(9394901, "file log {}", "str"_attr = "str"_sd);
+}
+
+void BM_FileLogV2ExpensiveArg(benchmark::State& state) {
+    ScopedFileLogV2Bench init(state);
+
+    for (auto _ : state)
+        LOGV2(9394902, "file log {}", "str"_attr = createLongString());
+}
+
 void ThreadCounts(benchmark::internal::Benchmark* b) {
     int tc[] = {1, 2, 4, 8};
     for (int t : tc)
@@ -163,5 +214,18 @@ BENCHMARK(BM_EnabledLogV2)->Apply(ThreadCounts);
 BENCHMARK(BM_EnabledLogV2ExpensiveArg)->Apply(ThreadCounts);
 BENCHMARK(BM_EnabledLogV2ManySmallArg)->Apply(ThreadCounts);
 
+void FileWriteModes(benchmark::internal::Benchmark* b) {
+    const auto kBlock = static_cast<int64_t>(logv2::LogOverflowPolicy::kBlock);
+    const auto kDrop = static_cast<int64_t>(logv2::LogOverflowPolicy::kDrop);
+    b->ArgNames({"queueSize", "overflowPolicy"});
+    b->Args({0, kBlock});
+    b->Args({16384, kBlock});
+    b->Args({16384, kDrop});
+    ThreadCounts(b);
+}
+
+BENCHMARK(BM_FileLogV2)->Apply(FileWriteModes);
+BENCHMARK(BM_FileLogV2ExpensiveArg)->Apply(FileWriteModes);
+
 }  // namespace
 }  // namespace mongo
@@ -45,6 +45,7 @@
 #include "mongo/logv2/component_settings_filter.h"
 #include "mongo/logv2/composite_backend.h"
 #include "mongo/logv2/constants.h"
+#include "mongo/logv2/file_rotate_sink.h"
 #include "mongo/logv2/json_formatter.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_capture_backend.h"
@@ -1884,6 +1885,118 @@ TEST_F(LogV2Test, FileLogging) {
     ASSERT(before_rotation == after_rotation);
 }
 
+std::vector<std::string> readLogFile(const std::string& filename) {
+    std::vector<std::string> lines;
+    std::ifstream file(filename);
+    for (std::string line; std::getline(file, line, '\n');)
+        lines.push_back(std::move(line));
+    return lines;
+}
+
+TEST_F(LogV2Test, FileLoggingAsync) {
+    auto logv2_dir = std::make_unique<mongo::unittest::TempDir>("logv2");
+    std::string file_name = logv2_dir->path() + "/file.log";
+
+    // A small queue makes the logging threads wait for the writer thread.
+    auto backend = boost::make_shared<FileRotateSink>(LogTimestampFormat::kISO8601UTC);
+    backend->enableAsyncWrites(8, LogOverflowPolicy::kBlock);
+    ASSERT_OK(backend->addFile(file_name, false));
+
+    auto sink = wrapInSynchronousSink(backend);
+    applyDefaultFilterToSink(sink);
+    sink->set_formatter(PlainFormatter());
+    attachSink(sink);
+
+    constexpr int kNumThreads = 4;
+    constexpr int kNumPerThread = 1000;
+    std::vector<stdx::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([t] {
+            for (int i = 0; i < kNumPerThread; ++i)
+                LOGV2(9394903, "{thread} {line}", "thread"_attr = t, "line"_attr = i);
+        });
+    }
+    for (auto&& thread : threads) {
+        thread.join();
+    }
+
+    // Lines are in the file once flushed, each thread's lines in the order they were logged.
+    sink->flush();
+    auto lines = readLogFile(file_name);
+    ASSERT_EQ(lines.size(), static_cast<size_t>(kNumThreads * kNumPerThread));
+
+    std::vector<int> next(kNumThreads, 0);
+    for (auto&& line : lines) {
+        int t, i;
+        std::istringstream(line) >> t >> i;
+        ASSERT_EQ(i, next[t]++);
+    }
+
+    // Lines of Error severity are written before the logging thread continues.
+    LOGV2_ERROR(9394904, "error");
+    ASSERT_EQ(readLogFile(file_name).back(), "error");
+}
+
+TEST_F(LogV2Test, FileLoggingAsyncRotate) {
+    auto logv2_dir = std::make_unique<mongo::unittest::TempDir>("logv2");
+    std::string file_name = logv2_dir->path() + "/file.log";
+
+    auto backend = boost::make_shared<FileRotateSink>(LogTimestampFormat::kISO8601UTC);
+    backend->enableAsyncWrites(1024, LogOverflowPolicy::kBlock);
+    ASSERT_OK(backend->addFile(file_name, false));
+
+    auto sink = wrapInSynchronousSink(backend);
+    applyDefaultFilterToSink(sink);
+    sink->set_formatter(PlainFormatter());
+    attachSink(sink);
+
+    LOGV2(9394905, "before rotation");
+    ASSERT_OK(sink->locked_backend()->rotate(true, "-rotated", [](Status s) { ASSERT_OK(s); }));
+    LOGV2(9394906, "after rotation");
+    sink->flush();
+
+    ASSERT_EQ(readLogFile(file_name + "-rotated").back(), "before rotation");
+    auto lines = readLogFile(file_name);
+    ASSERT_EQ(lines.size(), 1U);
+    ASSERT_EQ(lines.front(), "after rotation");
+}
+
+TEST_F(LogV2Test, FileLoggingAsyncDrop) {
+    auto logv2_dir = std::make_unique<mongo::unittest::TempDir>("logv2");
+    std::string file_name = logv2_dir->path() + "/file.log";
+
+    auto backend = boost::make_shared<FileRotateSink>(LogTimestampFormat::kISO8601UTC);
+    backend->enableAsyncWrites(2, LogOverflowPolicy::kDrop);
+    ASSERT_OK(backend->addFile(file_name, false));
+
+    auto sink = wrapInSynchronousSink(backend);
+    applyDefaultFilterToSink(sink);
+    sink->set_formatter(PlainFormatter());
+    attachSink(sink);
+
+    constexpr int kNumLines = 10000;
+    for (int i = 0; i < kNumLines; ++i)
+        LOGV2(9394907, "drop");
+
+    // Destroying the sink joins the writer thread, which reports the lines it had to drop.
+    popSink();
+    sink.reset();
+    backend.reset();
+
+    int written = 0;
+    long long dropped = 0;
+    for (auto&& line : readLogFile(file_name)) {
+        if (line == "drop") {
+            ++written;
+        } else {
+            auto obj = fromjson(line);
+            ASSERT_EQ(obj[constants::kIdFieldName].Int(), 9394900);
+            dropped += obj[constants::kAttributesFieldName].Obj()["droppedLines"].numberLong();
+        }
+    }
+    ASSERT_EQ(written + dropped, kNumLines);
+}
+
 TEST_F(LogV2Test, UserAssert) {
     std::vector<std::string> lines;
     auto sink = wrapInSynchronousSink(wrapInCompositeBackend(
@@ -0,0 +1,179 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/s/chunk_bounds_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+#include "mongo/base/data_type_endian.h"
+#include "mongo/base/data_view.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+namespace {
+
+uint64_t keyStringPrefix(StringData keyString) {
+    char prefix[sizeof(uint64_t)] = {};
+    if (!keyString.empty()) {
+        std::memcpy(prefix, keyString.rawData(), std::min(keyString.size(), sizeof(prefix)));
+    }
+    return ConstDataView(prefix).read<BigEndian<uint64_t>>();
+}
+
+/**
+ * Binary search which returns the index of the first element of 'values' for which
+ * 'isBefore(value)' is false. The search does not branch on the result of the comparisons, which
+ * the compiler turns into conditional moves, so that it does not suffer from branch mispredictions
+ * on random keys.
+ */
+template <typename IsBefore>
+size_t branchFreeSearch(const std::vector<uint64_t>& values, IsBefore isBefore) {
+    if (values.empty()) {
+        return 0;
+    }
+
+    const uint64_t* base = values.data();
+    size_t n = values.size();
+    while (n > 1) {
+        const size_t half = n / 2;
+        base = isBefore(base[half]) ? base + half : base;
+        n -= half;
+    }
+    return (base - values.data()) + (isBefore(*base) ? 1 : 0);
+}
+
+}  // namespace
+
+ChunkBoundsIndex::ChunkBoundsIndex(std::string minKeyString, size_t expectedNumChunks)
+    : _minKeyString(std::move(minKeyString)) {
+    _maxKeyOffsets.reserve(expectedNumChunks + 1);
+    _maxKeyPrefixes.reserve(expectedNumChunks);
+    _shardIndexes.reserve(expectedNumChunks);
+}
+
+void ChunkBoundsIndex::append(StringData maxKeyString, const ShardId& shardId) {
+    invariant(_maxKeyData.size() + maxKeyString.size() <= std::numeric_limits<uint32_t>::max());
+    _maxKeyData.append(maxKeyString.rawData(), maxKeyString.size());
+    _maxKeyOffsets.push_back(_maxKeyData.size());
+    _maxKeyPrefixes.push_back(keyStringPrefix(maxKeyString));
+
+    auto [it, inserted] = _shardIndexById.try_emplace(shardId, _shardIds.size());
+    if (inserted) {
+        invariant(_shardIds.size() < std::numeric_limits<uint16_t>::max());
+        _shardIds.push_back(shardId);
+    }
+    _shardIndexes.push_back(it->second);
+}
+
+ChunkBoundsIndex ChunkBoundsIndex::makeUpdated(const std::vector<Splice>& splices) const {
+    ChunkBoundsIndex updated(_minKeyString, size() + splices.size());
+    updated._shardIds = _shardIds;
+    updated._shardIndexById = _shardIndexById;
+
+    size_t unchangedBegin = 0;
+    for (const auto& splice : splices) {
+        invariant(unchangedBegin <= splice.begin && splice.begin <= splice.end &&
+                  splice.end <= size());
+        updated._appendRange(*this, unchangedBegin, splice.begin);
+        updated.append(splice.maxKeyString, splice.shardId);
+        unchangedBegin = splice.end;
+    }
+    updated._appendRange(*this, unchangedBegin, size());
+
+    return updated;
+}
+
+void ChunkBoundsIndex::_appendRange(const ChunkBoundsIndex& other, size_t begin, size_t end) {
+    if (begin >= end) {
+        return;
+    }
+
+    const uint32_t otherDataBegin = other._maxKeyOffsets[begin];
+    const uint32_t otherDataEnd = other._maxKeyOffsets[end];
+    const size_t dataBegin = _maxKeyData.size();
+    invariant(dataBegin + (otherDataEnd - otherDataBegin) <= std::numeric_limits<uint32_t>::max());
+
+    _maxKeyData.append(other._maxKeyData, otherDataBegin, otherDataEnd - otherDataBegin);
+    for (size_t i = begin + 1; i <= end; ++i) {
+        _maxKeyOffsets.push_back(dataBegin + (other._maxKeyOffsets[i] - otherDataBegin));
+    }
+    _maxKeyPrefixes.insert(_maxKeyPrefixes.end(),
+                           other._maxKeyPrefixes.begin() + begin,
+                           other._maxKeyPrefixes.begin() + end);
+    _shardIndexes.insert(_shardIndexes.end(),
+                         other._shardIndexes.begin() + begin,
+                         other._shardIndexes.begin() + end);
+}
+
+std::pair<size_t, size_t> ChunkBoundsIndex::_equalPrefixRange(StringData keyString) const {
+    const auto prefix = keyStringPrefix(keyString);
+    return {branchFreeSearch(_maxKeyPrefixes, [&](uint64_t value) { return value < prefix; }),
+            branchFreeSearch(_maxKeyPrefixes, [&](uint64_t value) { return value <= prefix; })};
+}
+
+size_t ChunkBoundsIndex::upperBound(StringData keyString) const {
+    auto [begin, end] = _equalPrefixRange(keyString);
+    while (begin < end) {
+        const size_t mid = begin + (end - begin) / 2;
+        if (keyString < _maxKeyString(mid)) {
+            end = mid;
+        } else {
+            begin = mid + 1;
+        }
+    }
+    return begin;
+}
+
+size_t ChunkBoundsIndex::lowerBound(StringData keyString) const {
+    auto [begin, end] = _equalPrefixRange(keyString);
+    while (begin < end) {
+        const size_t mid = begin + (end - begin) / 2;
+        if (_maxKeyString(mid) < keyString) {
+            begin = mid + 1;
+        } else {
+            end = mid;
+        }
+    }
+    return begin;
+}
+
+boost::optional<size_t> ChunkBoundsIndex::findIntersectingChunk(StringData keyString) const {
+    const auto chunkIndex = upperBound(keyString);
+    if (chunkIndex == size() || keyString < StringData(_minKeyString)) {
+        return boost::none;
+    }
+    return chunkIndex;
+}
+
+}  // namespace mongo
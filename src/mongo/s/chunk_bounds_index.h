@@ -0,0 +1,156 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/db/shard_id.h"
+#include "mongo/stdx/unordered_map.h"
+
+namespace mongo {
+
+/**
+ * Compact, read-only index of the upper bounds of the chunks of a routing table, used to find the
+ * shard which owns a shard key without dereferencing the ChunkInfo of every chunk visited by the
+ * search.
+ *
+ * The KeyString-encoded max of each chunk is stored back to back in a single buffer and the first
+ * eight bytes of each of them are kept in a separate contiguous array, which is binary searched
+ * first. The full keys are only compared for the (usually very few) chunks whose max has the same
+ * first eight bytes as the searched key. The shard owning each chunk is interned as a small
+ * integer.
+ *
+ * Chunks must be appended in ascending order of their max, must be contiguous and must start at
+ * the min passed to the constructor.
+ */
+class ChunkBoundsIndex {
+public:
+    /**
+     * Replacement of the chunks [begin, end) of an index by a single chunk, see makeUpdated().
+     */
+    struct Splice {
+        size_t begin;
+        size_t end;
+        StringData maxKeyString;
+        ShardId shardId;
+    };
+
+    ChunkBoundsIndex() = default;
+    ChunkBoundsIndex(std::string minKeyString, size_t expectedNumChunks);
+
+    void append(StringData maxKeyString, const ShardId& shardId);
+
+    /**
+     * Returns a copy of this index in which each of 'splices', which must be ordered and must not
+     * overlap each other, is applied. The chunks in between are copied in bulk, without encoding
+     * their bounds or interning their shards again. The shards of the replaced chunks stay
+     * interned, so numShards() may count shards which no longer own any chunk.
+     */
+    ChunkBoundsIndex makeUpdated(const std::vector<Splice>& splices) const;
+
+    size_t size() const {
+        return _shardIndexes.size();
+    }
+
+    size_t numShards() const {
+        return _shardIds.size();
+    }
+
+    /**
+     * Returns the index of the first chunk whose max is greater than 'keyString', or size() if
+     * there is none.
+     */
+    size_t upperBound(StringData keyString) const;
+
+    /**
+     * Returns the index of the first chunk whose max is greater than or equal to 'keyString', or
+     * size() if there is none.
+     */
+    size_t lowerBound(StringData keyString) const;
+
+    /**
+     * Returns the index of the chunk which contains 'keyString', or boost::none if the key is
+     * outside of the bounds of the routing table.
+     */
+    boost::optional<size_t> findIntersectingChunk(StringData keyString) const;
+
+    /**
+     * Returns the interned index, in [0, numShards()), of the shard which owns the given chunk.
+     */
+    uint16_t getShardIndex(size_t chunkIndex) const {
+        return _shardIndexes[chunkIndex];
+    }
+
+    const ShardId& getShardId(size_t chunkIndex) const {
+        return _shardIds[getShardIndex(chunkIndex)];
+    }
+
+    const ShardId& getShardIdByIndex(uint16_t shardIndex) const {
+        return _shardIds[shardIndex];
+    }
+
+private:
+    StringData _maxKeyString(size_t chunkIndex) const {
+        return StringData(_maxKeyData.data() + _maxKeyOffsets[chunkIndex],
+                          _maxKeyOffsets[chunkIndex + 1] - _maxKeyOffsets[chunkIndex]);
+    }
+
+    // The range of chunks whose max has the same eight byte prefix as 'keyString'.
+    std::pair<size_t, size_t> _equalPrefixRange(StringData keyString) const;
+
+    // Appends the chunks [begin, end) of 'other', whose shards must be interned the same way as
+    // in this index.
+    void _appendRange(const ChunkBoundsIndex& other, size_t begin, size_t end);
+
+    std::string _minKeyString;
+
+    // The max of every chunk, in order, and the offset at which each of them starts in
+    // '_maxKeyData'. There is one more offset than chunks, so that chunk i spans
+    // [_maxKeyOffsets[i], _maxKeyOffsets[i + 1]).
+    std::string _maxKeyData;
+    std::vector<uint32_t> _maxKeyOffsets{0};
+
+    // The first eight bytes of the max of every chunk, big-endian and zero-padded, so that they
+    // sort in the same order as the keys themselves.
+    std::vector<uint64_t> _maxKeyPrefixes;
+
+    std::vector<uint16_t> _shardIndexes;
+    std::vector<ShardId> _shardIds;
+    stdx::unordered_map<ShardId, uint16_t, ShardId::Hasher> _shardIndexById;
+};
+
+}  // namespace mongo
@@ -0,0 +1,174 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/s/chunk_bounds_index.h"
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/s/shard_key_pattern.h"
+#include "mongo/unittest/unittest.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+namespace {
+
+std::string toKeyString(const BSONObj& key) {
+    return ShardKeyPattern::toKeyString(key);
+}
+
+/**
+ * Builds an index over the chunks [MinKey, bounds[0]), [bounds[0], bounds[1]), ...,
+ * [bounds[n - 1], MaxKey) of a collection sharded on {a: 1}, whose chunks are owned in turn by
+ * 'numShards' shards.
+ */
+ChunkBoundsIndex makeIndex(const std::vector<BSONObj>& bounds, int numShards) {
+    ChunkBoundsIndex index(toKeyString(BSON("a" << MINKEY)), bounds.size() + 1);
+    for (size_t i = 0; i < bounds.size(); ++i) {
+        index.append(toKeyString(bounds[i]), ShardId(str::stream() << "shard" << i % numShards));
+    }
+    index.append(toKeyString(BSON("a" << MAXKEY)),
+                 ShardId(str::stream() << "shard" << bounds.size() % numShards));
+    return index;
+}
+
+TEST(ChunkBoundsIndexTest, FindsChunkContainingKey) {
+    const auto index = makeIndex({BSON("a" << 0), BSON("a" << 100), BSON("a" << 200)}, 4);
+    ASSERT_EQ(index.size(), 4);
+    ASSERT_EQ(index.numShards(), 4);
+
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << MINKEY))), 0);
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << -1))), 0);
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << 0))), 1);
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << 99))), 1);
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << 100))), 2);
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << 1000))), 3);
+    ASSERT_EQ(index.getShardId(2), ShardId("shard2"));
+
+    // MaxKey is not contained in the last chunk.
+    ASSERT_FALSE(index.findIntersectingChunk(toKeyString(BSON("a" << MAXKEY))));
+}
+
+TEST(ChunkBoundsIndexTest, UpperAndLowerBoundDifferOnlyOnChunkBoundaries) {
+    const auto index = makeIndex({BSON("a" << 0), BSON("a" << 100)}, 2);
+
+    ASSERT_EQ(index.upperBound(toKeyString(BSON("a" << 100))), 2);
+    ASSERT_EQ(index.lowerBound(toKeyString(BSON("a" << 100))), 1);
+    ASSERT_EQ(index.upperBound(toKeyString(BSON("a" << 50))), 1);
+    ASSERT_EQ(index.lowerBound(toKeyString(BSON("a" << 50))), 1);
+    ASSERT_EQ(index.lowerBound(toKeyString(BSON("a" << MAXKEY))), 2);
+    ASSERT_EQ(index.upperBound(toKeyString(BSON("a" << MAXKEY))), 3);
+}
+
+TEST(ChunkBoundsIndexTest, InternsShardIds) {
+    std::vector<BSONObj> bounds;
+    for (int i = 0; i < 1000; ++i) {
+        bounds.push_back(BSON("a" << i));
+    }
+    const auto index = makeIndex(bounds, 3);
+
+    ASSERT_EQ(index.size(), 1001);
+    ASSERT_EQ(index.numShards(), 3);
+    for (size_t i = 0; i < index.size(); ++i) {
+        ASSERT_EQ(index.getShardIndex(i), i % 3);
+        ASSERT_EQ(index.getShardId(i), ShardId(str::stream() << "shard" << i % 3));
+    }
+}
+
+TEST(ChunkBoundsIndexTest, ResolvesKeysSharingLongPrefixes) {
+    // All the bounds share a prefix much longer than the eight bytes kept in the prefix array, so
+    // every lookup has to fall back to comparing the full keys.
+    const std::string prefix(64, 'x');
+    std::vector<BSONObj> bounds;
+    for (int i = 0; i < 100; ++i) {
+        bounds.push_back(BSON("a" << (prefix + std::to_string(1000 + i * 10))));
+    }
+    const auto index = makeIndex(bounds, 5);
+
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << prefix))), 0);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(*index.findIntersectingChunk(
+                      toKeyString(BSON("a" << (prefix + std::to_string(1000 + i * 10))))),
+                  i + 1);
+        ASSERT_EQ(*index.findIntersectingChunk(
+                      toKeyString(BSON("a" << (prefix + std::to_string(1005 + i * 10))))),
+                  i + 1);
+    }
+}
+
+TEST(ChunkBoundsIndexTest, MakeUpdatedSplicesChangedChunks) {
+    std::vector<BSONObj> bounds;
+    for (int i = 0; i < 10; ++i) {
+        bounds.push_back(BSON("a" << i * 10));
+    }
+    const auto index = makeIndex(bounds, 3);
+
+    // Merge the chunks ending at 20, 30 and 40 into one owned by a new shard, and split the chunk
+    // [60, 70) in two.
+    const auto merged = toKeyString(BSON("a" << 40));
+    const auto splitLow = toKeyString(BSON("a" << 65));
+    const auto splitHigh = toKeyString(BSON("a" << 70));
+    const auto updated = index.makeUpdated({{2, 5, merged, ShardId("shard7")},
+                                            {7, 8, splitLow, ShardId("shard0")},
+                                            {8, 8, splitHigh, ShardId("shard1")}});
+
+    const std::vector<std::pair<BSONObj, std::string>> expected = {{BSON("a" << 0), "shard0"},
+                                                                   {BSON("a" << 10), "shard1"},
+                                                                   {BSON("a" << 40), "shard7"},
+                                                                   {BSON("a" << 50), "shard2"},
+                                                                   {BSON("a" << 60), "shard0"},
+                                                                   {BSON("a" << 65), "shard0"},
+                                                                   {BSON("a" << 70), "shard1"},
+                                                                   {BSON("a" << 80), "shard2"},
+                                                                   {BSON("a" << 90), "shard0"},
+                                                                   {BSON("a" << MAXKEY), "shard1"}};
+    ASSERT_EQ(updated.size(), expected.size());
+    ASSERT_EQ(updated.numShards(), 4);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(updated.lowerBound(toKeyString(expected[i].first)), i);
+        ASSERT_EQ(updated.getShardId(i), ShardId(expected[i].second));
+    }
+    ASSERT_EQ(*updated.findIntersectingChunk(toKeyString(BSON("a" << 25))), 2);
+    ASSERT_EQ(*updated.findIntersectingChunk(toKeyString(BSON("a" << 67))), 6);
+
+    // The index it was updated from is left as is.
+    ASSERT_EQ(index.size(), 11);
+    ASSERT_EQ(*index.findIntersectingChunk(toKeyString(BSON("a" << 25))), 3);
+}
+
+TEST(ChunkBoundsIndexTest, EmptyIndexFindsNothing) {
+    const ChunkBoundsIndex index;
+    ASSERT_EQ(index.size(), 0);
+    ASSERT_EQ(index.upperBound(toKeyString(BSON("a" << 1))), 0);
+    ASSERT_FALSE(index.findIntersectingChunk(toKeyString(BSON("a" << 1))));
+}
+
+}  // namespace
+}  // namespace mongo
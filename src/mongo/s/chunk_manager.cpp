@@ -112,19 +112,17 @@ void validateChunkIsNotOlderThan(const std::shared_ptr<ChunkInfo>& chunk,
 
 }  // namespace
 
-ChunkMap::ChunkMap(OID epoch, const Timestamp& timestamp, size_t initialCapacity)
-    : _collectionPlacementVersion({epoch, timestamp}, {0, 0}) {
-    _chunkMap.reserve(initialCapacity);
-}
+ChunkMap::ChunkMap(OID epoch, const Timestamp& timestamp)
+    : _collectionPlacementVersion({epoch, timestamp}, {0, 0}) {}
 
 ShardPlacementVersionMap ChunkMap::constructShardPlacementVersionMap() const {
     ShardPlacementVersionMap placementVersions;
-    ChunkVector::const_iterator current = _chunkMap.cbegin();
+    ChunkVector::const_iterator current = _chunkMap.begin();
 
     boost::optional<BSONObj> firstMin = boost::none;
     boost::optional<BSONObj> lastMax = boost::none;
 
-    while (current != _chunkMap.cend()) {
+    while (current != _chunkMap.end()) {
         const auto& firstChunkInRange = *current;
         const auto& currentRangeShardId = firstChunkInRange->getShardIdAt(boost::none);
 
@@ -144,7 +142,7 @@ ShardPlacementVersionMap ChunkMap::constructShardPlacementVersionMap() const {
 
         current =
             std::find_if(current,
-                         _chunkMap.cend(),
+                         _chunkMap.end(),
                          [&currentRangeShardId, &maxPlacementVersion](const auto& currentChunk) {
                              if (currentChunk->getShardIdAt(boost::none) != currentRangeShardId)
                                  return true;
@@ -196,12 +194,17 @@ ShardPlacementVersionMap ChunkMap::constructShardPlacementVersionMap() const {
     return placementVersions;
 }
 
-void ChunkMap::appendChunk(const std::shared_ptr<ChunkInfo>& chunk) {
-    appendChunkTo(_chunkMap, chunk);
-    const auto chunkVersion = chunk->getLastmod();
-    if (_collectionPlacementVersion.isOlderThan(chunkVersion)) {
-        _collectionPlacementVersion = chunkVersion;
+ChunkBoundsIndex ChunkMap::constructChunkBoundsIndex() const {
+    if (_chunkMap.empty()) {
+        return ChunkBoundsIndex();
+    }
+
+    ChunkBoundsIndex index(ShardKeyPattern::toKeyString(_chunkMap.front()->getMin()),
+                           _chunkMap.size());
+    for (const auto& chunk : _chunkMap) {
+        index.append(chunk->getMaxKeyString(), chunk->getShardIdAt(boost::none));
     }
+    return index;
 }
 
 std::shared_ptr<ChunkInfo> ChunkMap::findIntersectingChunk(const BSONObj& shardKey) const {
@@ -213,37 +216,61 @@ std::shared_ptr<ChunkInfo> ChunkMap::findIntersectingChunk(const BSONObj& shardK
     return std::shared_ptr<ChunkInfo>();
 }
 
-ChunkMap ChunkMap::createMerged(
-    const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks) const {
-    size_t chunkMapIndex = 0;
-    size_t changedChunkIndex = 0;
-
-    ChunkMap updatedChunkMap(
-        getVersion().epoch(), getVersion().getTimestamp(), _chunkMap.size() + changedChunks.size());
+ChunkMap ChunkMap::createMerged(const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks,
+                                std::vector<std::pair<size_t, size_t>>* replacedRanges) const {
+    ChunkMap updatedChunkMap(*this);
+    if (changedChunks.empty()) {
+        return updatedChunkMap;
+    }
 
-    while (chunkMapIndex < _chunkMap.size() || changedChunkIndex < changedChunks.size()) {
-        if (chunkMapIndex >= _chunkMap.size()) {
-            validateChunkIsNotOlderThan(changedChunks[changedChunkIndex], getVersion());
-            updatedChunkMap.appendChunk(changedChunks[changedChunkIndex++]);
-            continue;
+    // Splice each changed chunk in place of the chunks of this map that it overlaps. Every chunk
+    // that is left out of the new map is overlapped by a changed chunk that is not older than the
+    // collection placement version, and so not older than the chunk it replaces. The new
+    // collection placement version is therefore the greater of the current one and the versions
+    // of the changed chunks.
+    ChunkVector merged;
+    size_t unchangedBegin = 0;
+    for (const auto& changedChunk : changedChunks) {
+        validateChunkIsNotOlderThan(changedChunk, getVersion());
+
+        // The chunks in [unchangedBegin, overlapBegin) end at or before the changed chunk's min.
+        const auto changedMinKeyString = ShardKeyPattern::toKeyString(changedChunk->getMin());
+        const size_t overlapBegin =
+            std::upper_bound(_chunkMap.begin() + unchangedBegin,
+                             _chunkMap.end(),
+                             changedMinKeyString,
+                             [](const std::string& keyString, const auto& chunk) {
+                                 return keyString < chunk->getMaxKeyString();
+                             }) -
+            _chunkMap.begin();
+
+        // The chunks that end at or before the changed chunk's max overlap it, as does the chunk
+        // after them if it starts before the changed chunk's max.
+        size_t overlapEnd = std::upper_bound(_chunkMap.begin() + overlapBegin,
+                                             _chunkMap.end(),
+                                             changedChunk->getMaxKeyString(),
+                                             [](const std::string& keyString, const auto& chunk) {
+                                                 return keyString < chunk->getMaxKeyString();
+                                             }) -
+            _chunkMap.begin();
+        if (overlapEnd < _chunkMap.size() &&
+            _chunkMap[overlapEnd]->getRange().overlaps(changedChunk->getRange())) {
+            ++overlapEnd;
         }
 
-        if (changedChunkIndex >= changedChunks.size()) {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
-            continue;
+        merged = std::move(merged) +
+            _chunkMap.drop(unchangedBegin).take(overlapBegin - unchangedBegin);
+        merged = std::move(merged).push_back(changedChunk);
+        unchangedBegin = overlapEnd;
+        if (replacedRanges) {
+            replacedRanges->emplace_back(overlapBegin, overlapEnd);
         }
 
-        auto overlap = _chunkMap[chunkMapIndex]->getRange().overlaps(
-            changedChunks[changedChunkIndex]->getRange());
-
-        if (overlap) {
-            auto& changedChunk = changedChunks[changedChunkIndex++];
-            validateChunkIsNotOlderThan(changedChunk, getVersion());
-            updatedChunkMap.appendChunk(changedChunk);
-        } else {
-            updatedChunkMap.appendChunk(_chunkMap[chunkMapIndex++]);
+        if (updatedChunkMap._collectionPlacementVersion.isOlderThan(changedChunk->getLastmod())) {
+            updatedChunkMap._collectionPlacementVersion = changedChunk->getLastmod();
         }
     }
+    updatedChunkMap._chunkMap = std::move(merged) + _chunkMap.drop(unchangedBegin);
 
     return updatedChunkMap;
 }
@@ -328,7 +355,22 @@ RoutingTableHistory::RoutingTableHistory(
       _reshardingFields(std::move(reshardingFields)),
       _allowMigrations(allowMigrations),
       _chunkMap(std::move(chunkMap)),
-      _placementVersions(_chunkMap.constructShardPlacementVersionMap()) {}
+      _placementVersions(_chunkMap.constructShardPlacementVersionMap()),
+      _chunkBoundsIndex(std::make_unique<LazyChunkBoundsIndex>()) {}
+
+void RoutingTableHistory::LazyChunkBoundsIndex::set(ChunkBoundsIndex builtIndex) {
+    std::call_once(built, [&] {
+        index = std::move(builtIndex);
+        isBuilt.store(true);
+    });
+}
+
+const ChunkBoundsIndex& RoutingTableHistory::getChunkBoundsIndex() const {
+    if (!_chunkBoundsIndex->isBuilt.load()) {
+        _chunkBoundsIndex->set(_chunkMap.constructChunkBoundsIndex());
+    }
+    return _chunkBoundsIndex->index;
+}
 
 void RoutingTableHistory::setShardStale(const ShardId& shardId) {
     if (gEnableFinerGrainedCatalogCacheRefresh) {
@@ -347,9 +389,9 @@ void RoutingTableHistory::setAllShardsRefreshed() {
     }
 }
 
-Chunk ChunkManager::findIntersectingChunk(const BSONObj& shardKey,
-                                          const BSONObj& collation,
-                                          bool bypassIsFieldHashedCheck) const {
+void ChunkManager::_checkShardKeyIsTargetable(const BSONObj& shardKey,
+                                              const BSONObj& collation,
+                                              bool bypassIsFieldHashedCheck) const {
     const bool hasSimpleCollation = (collation.isEmpty() && !_rt->optRt->getDefaultCollator()) ||
         SimpleBSONObjComparator::kInstance.evaluate(collation == CollationSpec::kSimpleSpec);
     if (!hasSimpleCollation) {
@@ -372,6 +414,12 @@ Chunk ChunkManager::findIntersectingChunk(const BSONObj& shardKey,
                         (!isFieldHashed || bypassIsFieldHashedCheck));
         }
     }
+}
+
+Chunk ChunkManager::findIntersectingChunk(const BSONObj& shardKey,
+                                          const BSONObj& collation,
+                                          bool bypassIsFieldHashedCheck) const {
+    _checkShardKeyIsTargetable(shardKey, collation, bypassIsFieldHashedCheck);
 
     auto chunkInfo = _rt->optRt->findIntersectingChunk(shardKey);
 
@@ -383,10 +431,37 @@ Chunk ChunkManager::findIntersectingChunk(const BSONObj& shardKey,
     return Chunk(*chunkInfo, _clusterTime);
 }
 
+ShardId ChunkManager::findIntersectingShardId(const BSONObj& shardKey,
+                                              const BSONObj& collation,
+                                              bool bypassIsFieldHashedCheck) const {
+    if (_clusterTime) {
+        return findIntersectingChunk(shardKey, collation, bypassIsFieldHashedCheck).getShardId();
+    }
+
+    _checkShardKeyIsTargetable(shardKey, collation, bypassIsFieldHashedCheck);
+
+    const auto& index = _rt->optRt->getChunkBoundsIndex();
+    const auto chunkIndex = index.findIntersectingChunk(ShardKeyPattern::toKeyString(shardKey));
+
+    uassert(ErrorCodes::ShardKeyNotFound,
+            str::stream() << "Cannot target single shard using key " << shardKey
+                          << " for namespace " << _rt->optRt->nss().toStringForErrorMsg(),
+            chunkIndex);
+
+    return index.getShardId(*chunkIndex);
+}
+
 bool ChunkManager::keyBelongsToShard(const BSONObj& shardKey, const ShardId& shardId) const {
     if (shardKey.isEmpty())
         return false;
 
+    if (!_clusterTime) {
+        const auto& index = _rt->optRt->getChunkBoundsIndex();
+        const auto chunkIndex =
+            index.findIntersectingChunk(ShardKeyPattern::toKeyString(shardKey));
+        return chunkIndex && index.getShardId(*chunkIndex) == shardId;
+    }
+
     auto chunkInfo = _rt->optRt->findIntersectingChunk(shardKey);
     if (!chunkInfo)
         return false;
@@ -413,6 +488,26 @@ void ChunkManager::getShardIdsForRange(const BSONObj& min,
         }
     }
 
+    if (!_clusterTime && !chunkRanges) {
+        // Scan the owning shards of the overlapping chunks in the compact chunk bounds index,
+        // which does not need to visit the chunks themselves.
+        const auto& index = _rt->optRt->getChunkBoundsIndex();
+        const auto begin = index.upperBound(ShardKeyPattern::toKeyString(min));
+        const auto end = std::min(index.upperBound(ShardKeyPattern::toKeyString(max)) + 1,
+                                  index.size());
+
+        const auto numOwningShards = _rt->optRt->getNShardsOwningChunks();
+        std::vector<bool> seenShards(index.numShards());
+        for (auto i = begin; i < end && shardIds->size() < numOwningShards; ++i) {
+            const auto shardIndex = index.getShardIndex(i);
+            if (!seenShards[shardIndex]) {
+                seenShards[shardIndex] = true;
+                shardIds->insert(index.getShardIdByIndex(shardIndex));
+            }
+        }
+        return;
+    }
+
     _rt->optRt->forEachOverlappingChunk(min, max, true, [&](auto& chunkInfo) {
         shardIds->insert(chunkInfo->getShardIdAt(_clusterTime));
         if (chunkRanges) {
@@ -587,20 +682,38 @@ RoutingTableHistory RoutingTableHistory::makeUpdated(
     const std::vector<ChunkType>& changedChunks) const {
 
     auto changedChunkInfos = flatten(changedChunks);
-    auto chunkMap = _chunkMap.createMerged(changedChunkInfos);
+    std::vector<std::pair<size_t, size_t>> replacedRanges;
+    auto chunkMap = _chunkMap.createMerged(changedChunkInfos, &replacedRanges);
 
     // Only update the same collection.
     invariant(getVersion().isSameCollection(chunkMap.getVersion()));
 
-    return RoutingTableHistory(_nss,
-                               _uuid,
-                               getShardKeyPattern().getKeyPattern(),
-                               CollatorInterface::cloneCollator(getDefaultCollator()),
-                               isUnique(),
-                               std::move(timeseriesFields),
-                               std::move(reshardingFields),
-                               allowMigrations,
-                               std::move(chunkMap));
+    RoutingTableHistory updated(_nss,
+                                _uuid,
+                                getShardKeyPattern().getKeyPattern(),
+                                CollatorInterface::cloneCollator(getDefaultCollator()),
+                                isUnique(),
+                                std::move(timeseriesFields),
+                                std::move(reshardingFields),
+                                allowMigrations,
+                                std::move(chunkMap));
+
+    // A routing table which was targeted is likely to be targeted again after the refresh, so
+    // splice the changed chunks into its chunk bounds index here rather than rebuilding the whole
+    // index on the first lookup.
+    if (_chunkBoundsIndex->isBuilt.load() && _chunkBoundsIndex->index.size() > 0) {
+        std::vector<ChunkBoundsIndex::Splice> splices;
+        splices.reserve(changedChunkInfos.size());
+        for (size_t i = 0; i < changedChunkInfos.size(); ++i) {
+            splices.push_back({replacedRanges[i].first,
+                               replacedRanges[i].second,
+                               changedChunkInfos[i]->getMaxKeyString(),
+                               changedChunkInfos[i]->getShardIdAt(boost::none)});
+        }
+        updated._chunkBoundsIndex->set(_chunkBoundsIndex->index.makeUpdated(splices));
+    }
+
+    return updated;
 }
 
 AtomicWord<uint64_t> ComparableChunkVersion::_epochDisambiguatingSequenceNumSource{1ULL};
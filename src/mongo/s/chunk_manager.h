@@ -29,19 +29,25 @@
 
 #pragma once
 
+#include <immer/flex_vector.hpp>
+#include <memory>
+#include <mutex>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/s/chunk.h"
+#include "mongo/s/chunk_bounds_index.h"
 #include "mongo/s/database_version.h"
 #include "mongo/s/resharding/type_collection_fields_gen.h"
 #include "mongo/s/shard_key_pattern.h"
 #include "mongo/s/shard_version.h"
 #include "mongo/s/type_collection_common_types_gen.h"
 #include "mongo/stdx/unordered_map.h"
+#include "mongo/util/immutable/details/memory_policy.h"
 #include "mongo/util/read_through_cache.h"
 
 namespace mongo {
@@ -69,11 +75,14 @@ using ShardPlacementVersionMap =
  * underlying implementation.
  */
 class ChunkMap {
-    // Vector of chunks ordered by max key.
-    using ChunkVector = std::vector<std::shared_ptr<ChunkInfo>>;
+    // Vector of chunks ordered by max key. It is persistent, so that a map created by
+    // createMerged() shares all the unchanged parts of the vector with the map it was created
+    // from, rather than copying every chunk.
+    using ChunkVector =
+        immer::flex_vector<std::shared_ptr<ChunkInfo>, immutable::detail::MemoryPolicy>;
 
 public:
-    ChunkMap(OID epoch, const Timestamp& timestamp, size_t initialCapacity = 0);
+    ChunkMap(OID epoch, const Timestamp& timestamp);
 
     size_t size() const {
         return _chunkMap.size();
@@ -107,11 +116,19 @@ public:
     }
 
     ShardPlacementVersionMap constructShardPlacementVersionMap() const;
+    ChunkBoundsIndex constructChunkBoundsIndex() const;
     std::shared_ptr<ChunkInfo> findIntersectingChunk(const BSONObj& shardKey) const;
 
-    void appendChunk(const std::shared_ptr<ChunkInfo>& chunk);
-
-    ChunkMap createMerged(const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks) const;
+    /**
+     * Returns a new map in which 'changedChunks', which must be sorted by max key and must not
+     * overlap each other, replace the chunks they overlap in this map. Takes time logarithmic in
+     * the size of this map for each changed chunk.
+     *
+     * If 'replacedRanges' is given, the range of the chunks of this map replaced by each changed
+     * chunk is returned in it, in the same order as 'changedChunks'.
+     */
+    ChunkMap createMerged(const std::vector<std::shared_ptr<ChunkInfo>>& changedChunks,
+                          std::vector<std::pair<size_t, size_t>>* replacedRanges = nullptr) const;
 
     BSONObj toBSON() const;
 
@@ -254,6 +271,12 @@ public:
         return _chunkMap.findIntersectingChunk(shardKey);
     }
 
+    /**
+     * Returns the compact chunk bounds index of this routing table, building it on first use. The
+     * routing table of a refresh gets its index updated from the previous one if that was built.
+     */
+    const ChunkBoundsIndex& getChunkBoundsIndex() const;
+
     /**
      * Returns the ids of all shards on which the collection has any chunks.
      */
@@ -347,6 +370,20 @@ private:
     // If a shard does not exist, it will not have an entry in the map. Note: this declaration must
     // not be moved before _chunkMap since it is initialized by using the _chunkMap instance.
     ShardPlacementVersionMap _placementVersions;
+
+    // Compact index of the bounds and owning shards of the chunks in _chunkMap, used for targeting
+    // at the latest cluster time. Building it is linear in the number of chunks, so it is only
+    // built on the first lookup of a routing table which was never targeted. A refresh of a
+    // routing table which was targeted updates the previous index instead, off the targeting path.
+    // It is held by pointer so that the routing table stays movable.
+    struct LazyChunkBoundsIndex {
+        void set(ChunkBoundsIndex builtIndex);
+
+        std::once_flag built;
+        AtomicWord<bool> isBuilt{false};
+        ChunkBoundsIndex index;
+    };
+    std::unique_ptr<LazyChunkBoundsIndex> _chunkBoundsIndex;
 };
 
 /**
@@ -607,6 +644,22 @@ public:
         return findIntersectingChunk(shardKey, CollationSpec::kSimpleSpec);
     }
 
+    /**
+     * Same as findIntersectingChunk, but only returns the id of the shard which owns the chunk.
+     * Unless this is a point-in-time view of the routing table, the lookup is served by the
+     * compact chunk bounds index of the routing table.
+     */
+    ShardId findIntersectingShardId(const BSONObj& shardKey,
+                                    const BSONObj& collation,
+                                    bool bypassIsFieldHashedCheck = false) const;
+
+    /**
+     * Same as findIntersectingShardId, but assumes the simple collation.
+     */
+    ShardId findIntersectingShardIdWithSimpleCollation(const BSONObj& shardKey) const {
+        return findIntersectingShardId(shardKey, CollationSpec::kSimpleSpec);
+    }
+
     /**
      * Finds the shard id of the shard that owns the chunk minKey belongs to, assuming the simple
      * collation because shard keys do not support non-simple collations.
@@ -683,6 +736,14 @@ public:
     }
 
 private:
+    /**
+     * Throws ShardKeyNotFound if 'shardKey' cannot be used to target a single shard under the
+     * given collation.
+     */
+    void _checkShardKeyIsTargetable(const BSONObj& shardKey,
+                                    const BSONObj& collation,
+                                    bool bypassIsFieldHashedCheck) const;
+
     ShardId _dbPrimary;
     DatabaseVersion _dbVersion;
 
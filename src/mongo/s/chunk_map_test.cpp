@@ -167,4 +167,57 @@ TEST_F(ChunkMapTest, TestEnumerateOverlappingChunks) {
     ASSERT_EQ(count, 3);
 }
 
+TEST_F(ChunkMapTest, TestMergeReplacesOnlyOverlappedChunks) {
+    const OID epoch = OID::gen();
+    ChunkVersion version({epoch, Timestamp(1, 1)}, {1, 0});
+
+    std::vector<std::shared_ptr<ChunkInfo>> initialChunks;
+    auto lastMax = getShardKeyPattern().globalMin();
+    for (int i = 0; i < 100; ++i) {
+        auto max = i == 99 ? getShardKeyPattern().globalMax() : BSON("a" << i * 10);
+        version.incMinor();
+        initialChunks.push_back(std::make_shared<ChunkInfo>(
+            ChunkType{uuid(), ChunkRange{lastMax, max}, version, kThisShard}));
+        lastMax = max;
+    }
+
+    auto chunkMap = ChunkMap{epoch, Timestamp(1, 1)}.createMerged(initialChunks);
+    ASSERT_EQ(chunkMap.size(), 100);
+
+    // Split the chunk [490, 500) in two and merge the chunks [600, 700) into a single one.
+    version.incMajor();
+    auto splitLow = std::make_shared<ChunkInfo>(ChunkType{
+        uuid(), ChunkRange{BSON("a" << 490), BSON("a" << 495)}, version, kThisShard});
+    version.incMinor();
+    auto splitHigh = std::make_shared<ChunkInfo>(ChunkType{
+        uuid(), ChunkRange{BSON("a" << 495), BSON("a" << 500)}, version, kThisShard});
+    version.incMinor();
+    auto merged = std::make_shared<ChunkInfo>(ChunkType{
+        uuid(), ChunkRange{BSON("a" << 600), BSON("a" << 700)}, version, kThisShard});
+
+    auto newChunkMap = chunkMap.createMerged({splitLow, splitHigh, merged});
+    ASSERT_EQ(newChunkMap.size(), 100 + 1 - 9);
+    ASSERT_EQ(newChunkMap.getVersion(), version);
+
+    ASSERT_EQ(newChunkMap.findIntersectingChunk(BSON("a" << 492)), splitLow);
+    ASSERT_EQ(newChunkMap.findIntersectingChunk(BSON("a" << 495)), splitHigh);
+    ASSERT_EQ(newChunkMap.findIntersectingChunk(BSON("a" << 650)), merged);
+
+    // Chunks which were not changed are shared with the original map, which is left untouched.
+    ASSERT_EQ(newChunkMap.findIntersectingChunk(BSON("a" << 5)),
+              chunkMap.findIntersectingChunk(BSON("a" << 5)));
+    ASSERT_EQ(newChunkMap.findIntersectingChunk(BSON("a" << 995)),
+              chunkMap.findIntersectingChunk(BSON("a" << 995)));
+    ASSERT_EQ(chunkMap.size(), 100);
+    ASSERT_NE(chunkMap.findIntersectingChunk(BSON("a" << 650)), merged);
+
+    auto prevMax = getShardKeyPattern().globalMin();
+    newChunkMap.forEach([&](const auto& chunkInfo) {
+        ASSERT_BSONOBJ_EQ(chunkInfo->getMin(), prevMax);
+        prevMax = chunkInfo->getMax();
+        return true;
+    });
+    ASSERT_BSONOBJ_EQ(prevMax, getShardKeyPattern().globalMax());
+}
+
 }  // namespace mongo
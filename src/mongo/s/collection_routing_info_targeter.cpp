@@ -676,10 +676,14 @@ StatusWith<std::vector<ShardEndpoint>> CollectionRoutingInfoTargeter::_targetQue
 StatusWith<ShardEndpoint> CollectionRoutingInfoTargeter::_targetShardKey(
     const BSONObj& shardKey, const BSONObj& collation, std::set<ChunkRange>* chunkRanges) const {
     try {
-        auto chunk = _cri.cm.findIntersectingChunk(shardKey, collation);
-        if (chunkRanges) {
-            chunkRanges->insert(chunk.getRange());
+        if (!chunkRanges) {
+            auto shardId = _cri.cm.findIntersectingShardId(shardKey, collation);
+            auto shardVersion = _cri.getShardVersion(shardId);
+            return ShardEndpoint(std::move(shardId), std::move(shardVersion), boost::none);
         }
+
+        auto chunk = _cri.cm.findIntersectingChunk(shardKey, collation);
+        chunkRanges->insert(chunk.getRange());
         return ShardEndpoint(
             chunk.getShardId(), _cri.getShardVersion(chunk.getShardId()), boost::none);
     } catch (const DBException& ex) {
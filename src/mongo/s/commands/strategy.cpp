@@ -52,6 +52,7 @@
 #include "mongo/db/matcher/extensions_callback_noop.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/not_primary_error_tracker.h"
+#include "mongo/db/operation_phase_timer.h"
 #include "mongo/db/operation_time_tracker.h"
 #include "mongo/db/ops/write_ops.h"
 #include "mongo/db/query/find_common.h"
@@ -567,7 +568,10 @@ void ParseAndRunCommand::_parseCommand() {
 
     rpc::readRequestMetadata(opCtx, request, command->requiresAuth());
 
-    _invocation = command->parse(opCtx, request);
+    {
+        ScopedOperationPhaseTimer parseTimer(opCtx, OperationPhase::kParse);
+        _invocation = command->parse(opCtx, request);
+    }
     CommandInvocation::set(opCtx, _invocation);
 
     // Set the logical optype, command object and namespace as soon as we identify the command. If
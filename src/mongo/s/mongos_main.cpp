@@ -70,6 +70,7 @@
 #include "mongo/executor/task_executor_pool.h"
 #include "mongo/idl/cluster_server_parameter_refresher.h"
 #include "mongo/logv2/log.h"
+#include "mongo/logv2/log_util.h"
 #include "mongo/platform/process_id.h"
 #include "mongo/rpc/metadata/egress_metadata_hook_list.h"
 #include "mongo/s/balancer_configuration.h"
@@ -1040,6 +1041,7 @@ ExitCode mongos_main(int argc, char* argv[]) {
             return ExitCode::abrupt;
 
         startSignalProcessingThread();
+        logv2::startAsyncFileWriter();
 
         return main(service);
     } catch (const DBException& e) {
@@ -144,7 +144,8 @@ void ClusterClientCursorImpl::kill(OperationContext* opCtx) {
                                      _queryStatsStoreKey,
                                      std::move(_queryStatsRequestShapifier),
                                      _metrics.executionTime.value_or(Microseconds{0}).count(),
-                                     _metrics.nreturned.value_or(0));
+                                     _metrics.nreturned.value_or(0),
+                                     _metrics.phaseTimes);
     }
 
     _root->kill(opCtx);
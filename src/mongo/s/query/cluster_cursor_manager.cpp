@@ -595,22 +595,30 @@ void collectQueryStatsMongos(OperationContext* opCtx,
                              std::unique_ptr<query_stats::RequestShapifier> requestShapifier) {
     // If we haven't registered a cursor to prepare for getMore requests, we record
     // queryStats directly.
+    // The router does not read from storage, so its breakdown has no storage read time. The
+    // shards record their own in their query stats.
     auto&& opDebug = CurOp::get(opCtx)->debug();
+    opDebug.additiveMetrics.phaseTimes = OperationPhaseTimers::get(opCtx)->snapshot();
     query_stats::writeQueryStats(
         opCtx,
         opDebug.queryStatsStoreKeyHash,
         opDebug.queryStatsStoreKey,
         std::move(requestShapifier),
         opDebug.additiveMetrics.executionTime.value_or(Microseconds{0}).count(),
-        opDebug.additiveMetrics.nreturned.value_or(0));
+        opDebug.additiveMetrics.nreturned.value_or(0),
+        opDebug.additiveMetrics.phaseTimes);
 }
 
 void collectQueryStatsMongos(OperationContext* opCtx, ClusterClientCursorGuard& cursor) {
-    cursor->incrementCursorMetrics(CurOp::get(opCtx)->debug().additiveMetrics);
+    auto&& opDebug = CurOp::get(opCtx)->debug();
+    opDebug.additiveMetrics.phaseTimes = OperationPhaseTimers::get(opCtx)->snapshot();
+    cursor->incrementCursorMetrics(opDebug.additiveMetrics);
 }
 
 void collectQueryStatsMongos(OperationContext* opCtx, ClusterCursorManager::PinnedCursor& cursor) {
-    cursor->incrementCursorMetrics(CurOp::get(opCtx)->debug().additiveMetrics);
+    auto&& opDebug = CurOp::get(opCtx)->debug();
+    opDebug.additiveMetrics.phaseTimes = OperationPhaseTimers::get(opCtx)->snapshot();
+    cursor->incrementCursorMetrics(opDebug.additiveMetrics);
 }
 
 }  // namespace mongo
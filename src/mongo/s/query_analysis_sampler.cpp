@@ -178,11 +178,11 @@ double QueryAnalysisSampler::QueryStats::_calculateExponentialMovingAverage(
 void QueryAnalysisSampler::QueryStats::refreshTotalCount() {
     long long newTotalCount = [&] {
         if (isMongos() || serverGlobalParams.clusterRole.has(ClusterRole::None)) {
-            return globalOpCounters.getUpdate()->load() + globalOpCounters.getDelete()->load() +
-                _lastFindAndModifyQueriesCount + globalOpCounters.getQuery()->load() +
+            return globalOpCounters.getUpdate() + globalOpCounters.getDelete() +
+                _lastFindAndModifyQueriesCount + globalOpCounters.getQuery() +
                 _lastAggregateQueriesCount + _lastCountQueriesCount + _lastDistinctQueriesCount;
         } else if (serverGlobalParams.clusterRole.has(ClusterRole::ShardServer)) {
-            return globalOpCounters.getNestedAggregate()->load();
+            return globalOpCounters.getNestedAggregate();
         }
         MONGO_UNREACHABLE;
     }();
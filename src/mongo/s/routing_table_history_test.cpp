@@ -242,6 +242,69 @@ TEST_F(RoutingTableHistoryTest, TestSplits) {
     ASSERT_EQ(v2, rt2.getVersion(kThisShard));
 }
 
+TEST_F(RoutingTableHistoryTest, ChunkBoundsIndexUpdatedOnRefresh) {
+    const UUID uuid = UUID::gen();
+    const OID epoch = OID::gen();
+    const Timestamp timestamp(1);
+    const ShardId otherShard("otherShard");
+
+    auto rt = RoutingTableHistory::makeNew(
+        kNss,
+        uuid,
+        getShardKeyPattern(),
+        nullptr,
+        false,
+        epoch,
+        timestamp,
+        boost::none /* timeseriesFields */,
+        boost::none /* reshardingFields */,
+        true,
+        {ChunkType{uuid,
+                   ChunkRange{getShardKeyPattern().globalMin(), BSON("a" << 0)},
+                   ChunkVersion({epoch, timestamp}, {1, 0}),
+                   kThisShard},
+         ChunkType{uuid,
+                   ChunkRange{BSON("a" << 0), getShardKeyPattern().globalMax()},
+                   ChunkVersion({epoch, timestamp}, {1, 1}),
+                   kThisShard}});
+    ASSERT_EQ(rt.getChunkBoundsIndex().size(), 2);
+
+    // Split the upper chunk and move one half, then merge the lower chunks back.
+    auto rt1 = rt.makeUpdated(boost::none /* timeseriesFields */,
+                              boost::none /* reshardingFields */,
+                              true,
+                              {ChunkType{uuid,
+                                         ChunkRange{BSON("a" << 0), BSON("a" << 10)},
+                                         ChunkVersion({epoch, timestamp}, {2, 0}),
+                                         otherShard},
+                               ChunkType{uuid,
+                                         ChunkRange{BSON("a" << 10),
+                                                    getShardKeyPattern().globalMax()},
+                                         ChunkVersion({epoch, timestamp}, {2, 1}),
+                                         kThisShard}});
+    auto rt2 = rt1.makeUpdated(boost::none /* timeseriesFields */,
+                               boost::none /* reshardingFields */,
+                               true,
+                               {ChunkType{uuid,
+                                          ChunkRange{getShardKeyPattern().globalMin(),
+                                                     BSON("a" << 10)},
+                                          ChunkVersion({epoch, timestamp}, {3, 0}),
+                                          otherShard}});
+
+    for (const auto* updated : {&rt1, &rt2}) {
+        const auto& index = updated->getChunkBoundsIndex();
+        ASSERT_EQ(index.size(), updated->numChunks());
+        for (int a : {-100, -1, 0, 5, 9, 10, 100}) {
+            const auto shardKey = BSON("a" << a);
+            const auto chunkIndex =
+                index.findIntersectingChunk(ShardKeyPattern::toKeyString(shardKey));
+            ASSERT(chunkIndex);
+            ASSERT_EQ(index.getShardId(*chunkIndex),
+                      updated->findIntersectingChunk(shardKey)->getShardIdAt(boost::none));
+        }
+    }
+}
+
 TEST_F(RoutingTableHistoryTest, TestReplaceEmptyChunk) {
     const UUID uuid = UUID::gen();
     const OID epoch = OID::gen();
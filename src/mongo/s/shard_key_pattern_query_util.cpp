@@ -435,12 +435,15 @@ void getShardIdsForQuery(boost::intrusive_ptr<ExpressionContext> expCtx,
     auto shardKeyToFind = extractShardKeyFromQuery(cm.getShardKeyPattern(), *cq);
     if (!shardKeyToFind.isEmpty()) {
         try {
+            if (!info) {
+                shardIds->insert(cm.findIntersectingShardId(shardKeyToFind, collation));
+                return;
+            }
+
             auto chunk = cm.findIntersectingChunk(shardKeyToFind, collation);
             shardIds->insert(chunk.getShardId());
-            if (info) {
-                info->desc = QueryTargetingInfo::Description::kSingleKey;
-                info->chunkRanges.insert(chunk.getRange());
-            }
+            info->desc = QueryTargetingInfo::Description::kSingleKey;
+            info->chunkRanges.insert(chunk.getRange());
             return;
         } catch (const DBException&) {
             // The query uses multiple shards
@@ -37,6 +37,7 @@
 #include "mongo/bson/util/builder.h"
 #include "mongo/client/connection_string.h"
 #include "mongo/client/remote_command_targeter.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/error_labels.h"
 #include "mongo/db/internal_transactions_feature_flag_gen.h"
 #include "mongo/db/session/logical_session_id_helpers.h"
@@ -109,6 +110,13 @@ bool hasTransientTransactionError(const BatchedCommandResponse& response) {
 // applies when no writes are occurring and metadata is not changing on reload.
 const int kMaxRoundsWithoutProgress(5);
 
+// Track the number of write batches executed and the total number of rounds of child batches they
+// required, from which the average number of rounds per batch can be derived, as well as the number
+// of batches which needed more than one round.
+CounterMetric batchWritesExecutedCount("sharding.batchWrites.batches");
+CounterMetric batchWriteRoundsCount("sharding.batchWrites.rounds");
+CounterMetric batchWritesWithMultipleRoundsCount("sharding.batchWrites.batchesWithMultipleRounds");
+
 // Helper to parse all of the childBatches and construct the proper requests to send using the
 // AsyncRequestSender.
 std::vector<AsyncRequestsSender::Request> constructARSRequestsToSend(
@@ -283,6 +291,135 @@ bool processErrorResponseFromLocal(OperationContext* opCtx,
     return false;
 }
 
+// Remember that we successfully wrote to this shard.
+// NOTE: This will record lastOps for shards where we actually didn't update or delete any
+// documents, which preserves old behavior but is conservative.
+void noteSuccessfulWriteAt(const HostAndPort& shardHostAndPort,
+                           const BatchedCommandResponse& response,
+                           BatchWriteExecStats* stats) {
+    stats->noteWriteAt(shardHostAndPort,
+                       response.isLastOpSet() ? response.getLastOp() : repl::OpTime(),
+                       response.isElectionIdSet() ? response.getElectionId() : OID());
+}
+
+// Receives the responses to child batches of pipelined ordered writes (see
+// BatchWriteOp::pipelinesOrderedWrites) and notes them as if the writes had been executed one shard
+// at a time. The shards may each have failed a write, or succeeded writes which follow a write
+// failed on another shard, so only the error of the first failed write in the client batch is
+// noted, along with the writes which precede it. The returned boolean dictates if we should abort
+// the rest of the batch.
+bool processPipelinedOrderedResponses(OperationContext* opCtx,
+                                      NSTargeter& targeter,
+                                      MultiStatementTransactionRequestsSender& ars,
+                                      TargetedBatchMap& pendingBatches,
+                                      BatchWriteOp& batchOp,
+                                      BatchWriteExecStats* stats) {
+    struct ChildResponse {
+        TargetedWriteBatch* batch;
+        ShardId shardInfo;
+        boost::optional<HostAndPort> shardHostAndPort;
+        Status status;
+        BatchedCommandResponse response;
+        // Index in the client batch of the first write of the child batch which failed.
+        boost::optional<int> firstFailedWriteIndex;
+    };
+
+    std::vector<ChildResponse> childResponses;
+    boost::optional<int> firstFailedWriteIndex;
+    while (!ars.done()) {
+        auto response = ars.next();
+
+        dassert(pendingBatches.find(response.shardId) != pendingBatches.end());
+        TargetedWriteBatch* batch = pendingBatches.find(response.shardId)->second.get();
+
+        ChildResponse child{batch,
+                            response.shardHostAndPort ? response.shardHostAndPort->toString()
+                                                      : batch->getShardId(),
+                            response.shardHostAndPort,
+                            response.swResponse.getStatus()};
+        if (child.status.isOK()) {
+            std::string errMsg;
+            if (!child.response.parseBSON(response.swResponse.getValue().data, &errMsg)) {
+                child.status = {ErrorCodes::FailedToParse, errMsg};
+            }
+        }
+
+        // Each child batch is ordered, so none of its writes after the first error was executed.
+        const auto& writes = batch->getWrites();
+        if (!child.status.isOK() || !child.response.getOk()) {
+            child.firstFailedWriteIndex = writes.front()->writeOpRef.first;
+        } else if (child.response.isErrDetailsSet()) {
+            const auto& errors = child.response.getErrDetails();
+            const auto& firstError = *std::min_element(
+                errors.begin(), errors.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.getIndex() < rhs.getIndex();
+                });
+            child.firstFailedWriteIndex = writes[firstError.getIndex()]->writeOpRef.first;
+        }
+
+        if (child.firstFailedWriteIndex &&
+            (!firstFailedWriteIndex || *child.firstFailedWriteIndex < *firstFailedWriteIndex)) {
+            firstFailedWriteIndex = child.firstFailedWriteIndex;
+        }
+        childResponses.push_back(std::move(child));
+    }
+
+    // Note the writes of the other child batches which precede the first failed write before its
+    // error aborts the batch. They all succeeded, and each accounts for exactly one inserted
+    // document.
+    ChildResponse* failedChild = nullptr;
+    for (auto& child : childResponses) {
+        if (firstFailedWriteIndex) {
+            if (child.firstFailedWriteIndex == firstFailedWriteIndex) {
+                failedChild = &child;
+                continue;
+            }
+
+            const auto& writes = child.batch->getWrites();
+            const auto numPrecedingWrites =
+                std::count_if(writes.begin(), writes.end(), [&](const auto& write) {
+                    return write->writeOpRef.first < *firstFailedWriteIndex;
+                });
+            if (numPrecedingWrites == 0) {
+                continue;
+            }
+
+            BatchedCommandResponse precedingWritesResponse;
+            precedingWritesResponse.setStatus(Status::OK());
+            precedingWritesResponse.setN(numPrecedingWrites);
+            child.response = std::move(precedingWritesResponse);
+        }
+
+        if (processResponseFromRemote(
+                opCtx, targeter, child.shardInfo, child.response, batchOp, child.batch, stats)) {
+            return true;
+        }
+        if (child.shardHostAndPort) {
+            noteSuccessfulWriteAt(*child.shardHostAndPort, child.response, stats);
+        }
+    }
+
+    if (!failedChild) {
+        return false;
+    }
+
+    if (failedChild->status.isOK()) {
+        return processResponseFromRemote(opCtx,
+                                         targeter,
+                                         failedChild->shardInfo,
+                                         failedChild->response,
+                                         batchOp,
+                                         failedChild->batch,
+                                         stats);
+    }
+    return processErrorResponseFromLocal(opCtx,
+                                         batchOp,
+                                         failedChild->batch,
+                                         failedChild->status,
+                                         failedChild->shardInfo,
+                                         failedChild->shardHostAndPort);
+}
+
 // Iterates through all of the child batches and sends and processes each batch.
 void executeChildBatches(OperationContext* opCtx,
                          NSTargeter& targeter,
@@ -319,6 +456,12 @@ void executeChildBatches(OperationContext* opCtx,
             isRetryableWrite ? Shard::RetryPolicy::kIdempotent : Shard::RetryPolicy::kNoRetry);
         numSent += pendingBatches.size();
 
+        if (batchOp.pipelinesOrderedWrites()) {
+            abortBatch = processPipelinedOrderedResponses(
+                opCtx, targeter, ars, pendingBatches, batchOp, stats);
+            continue;
+        }
+
         // Receive all of the responses.
         while (!ars.done()) {
             // Block until a response is available.
@@ -354,16 +497,8 @@ void executeChildBatches(OperationContext* opCtx,
                 }
 
                 if (response.shardHostAndPort) {
-                    // Remember that we successfully wrote to this shard
-                    // NOTE: This will record lastOps for shards where we actually didn't update
-                    // or delete any documents, which preserves old behavior but is conservative
-                    stats->noteWriteAt(*response.shardHostAndPort,
-                                       batchedCommandResponse.isLastOpSet()
-                                           ? batchedCommandResponse.getLastOp()
-                                           : repl::OpTime(),
-                                       batchedCommandResponse.isElectionIdSet()
-                                           ? batchedCommandResponse.getElectionId()
-                                           : OID());
+                    noteSuccessfulWriteAt(
+                        *response.shardHostAndPort, batchedCommandResponse, stats);
                 }
             } else {
                 // The ARS failed to retrieve the response due to some sort of local failure.
@@ -687,6 +822,12 @@ void BatchWriteExec::executeBatch(OperationContext* opCtx,
         }
     }
 
+    batchWritesExecutedCount.increment();
+    batchWriteRoundsCount.increment(rounds);
+    if (rounds > 1) {
+        batchWritesWithMultipleRoundsCount.increment();
+    }
+
     auto nShardsOwningChunks = batchOp.getNShardsOwningChunks();
     if (nShardsOwningChunks)
         stats->noteNumShardsOwningChunks(*nShardsOwningChunks);
@@ -33,6 +33,7 @@
 #include "mongo/db/commands.h"
 #include "mongo/db/session/logical_session_id.h"
 #include "mongo/db/vector_clock.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/catalog/type_shard.h"
 #include "mongo/s/client/shard_registry.h"
 #include "mongo/s/mock_ns_targeter.h"
@@ -2401,6 +2402,99 @@ TEST_F(BatchWriteExecTransactionMultiShardTest, TargetedSucceededAndErrorRespons
     operationContext()->getBaton()->run(getServiceContext()->getPreciseClockSource());
 }
 
+// When ordered inserts are pipelined, both the child batch with the first document and the one
+// with a later document can fail. The response is the same as if the inserts had been sent one
+// shard at a time: only the first failed insert is reported, after the inserts which precede it.
+TEST_F(BatchWriteExecTransactionMultiShardTest, PipelinedOrderedInsertsReportFirstFailedInsert) {
+    RAIIServerParameterControllerForTest pipelineController(
+        "enablePipelinedOrderedWritesInTransactions", true);
+
+    BatchedCommandRequest request([&] {
+        write_ops::InsertCommandRequest insertOp(nss);
+        insertOp.setWriteCommandRequestBase([] {
+            write_ops::WriteCommandRequestBase writeCommandBase;
+            writeCommandBase.setOrdered(true);
+            return writeCommandBase;
+        }());
+        // The documents alternate between the two shards.
+        insertOp.setDocuments({BSON("x" << -1), BSON("x" << 1), BSON("x" << -2), BSON("x" << 2)});
+        return insertOp;
+    }());
+    request.setWriteConcern(BSONObj());
+
+    const static auto epoch = OID::gen();
+    const static Timestamp timestamp(2);
+
+    MockNSTargeter splitRangeNSTargeter(
+        nss,
+        {MockRange(ShardEndpoint(
+                       kShardName1,
+                       ShardVersionFactory::make(ChunkVersion({epoch, timestamp}, {100, 200}),
+                                                 boost::optional<CollectionIndexes>(boost::none)),
+                       boost::none),
+                   BSON("x" << MINKEY),
+                   BSON("x" << 0)),
+         MockRange(ShardEndpoint(
+                       kShardName2,
+                       ShardVersionFactory::make(ChunkVersion({epoch, timestamp}, {101, 200}),
+                                                 boost::optional<CollectionIndexes>(boost::none)),
+                       boost::none),
+                   BSON("x" << 0),
+                   BSON("x" << MAXKEY))});
+
+    auto future = launchAsync([&] {
+        BatchedCommandResponse response;
+        BatchWriteExecStats stats;
+        BatchWriteExec::executeBatch(
+            operationContext(), splitRangeNSTargeter, request, &response, &stats);
+
+        // Executed one shard at a time, the batch would have stopped at the second document.
+        ASSERT_EQ(1, response.getN());
+        ASSERT_EQ(1U, response.sizeErrDetails());
+        ASSERT_EQ(1, response.getErrDetailsAt(0).getIndex());
+        ASSERT_EQ(ErrorCodes::UnknownError, response.getErrDetailsAt(0).getStatus().code());
+    });
+
+    auto expectInsertsReturnWriteError = [&](const HostAndPort& target,
+                                             const std::vector<BSONObj>& expected,
+                                             int n,
+                                             int errorIndex) {
+        onCommandForPoolExecutor([&](const RemoteCommandRequest& request) {
+            ASSERT_EQ(target, request.target);
+
+            const auto opMsgRequest(OpMsgRequest::fromDBAndBody(request.dbname, request.cmdObj));
+            const auto actualBatchedInsert(BatchedCommandRequest::parseInsert(opMsgRequest));
+            const auto& inserted = actualBatchedInsert.getInsertRequest().getDocuments();
+            ASSERT_EQ(expected.size(), inserted.size());
+            for (size_t i = 0; i < expected.size(); ++i) {
+                ASSERT_BSONOBJ_EQ(expected[i], inserted[i]);
+            }
+
+            BSONObjBuilder bob;
+            bob.append("ok", 1);
+            bob.append("n", n);
+            bob.append("writeErrors",
+                       BSON_ARRAY(BSON("index" << errorIndex << "code" << ErrorCodes::UnknownError
+                                               << "errmsg"
+                                               << "dummy error")));
+
+            // Because this is the transaction-specific fixture, return transaction metadata in
+            // the response.
+            TxnResponseMetadata txnResponseMetadata(false /* readOnly */);
+            txnResponseMetadata.serialize(&bob);
+
+            return bob.obj();
+        });
+    };
+
+    // The first shard inserts the first document and fails the third one, the second shard fails
+    // the second document, so the fourth one is never inserted.
+    expectInsertsReturnWriteError(kTestShardHost1, {BSON("x" << -1), BSON("x" << -2)}, 1, 1);
+    expectInsertsReturnWriteError(kTestShardHost2, {BSON("x" << 1), BSON("x" << 2)}, 0, 0);
+
+    future.default_timed_get();
+}
+
 /**
  * General transaction tests.
  */
@@ -41,6 +41,7 @@
 #include "mongo/db/stats/counters.h"
 #include "mongo/s/client/num_hosts_targeted_metrics.h"
 #include "mongo/s/collection_uuid_mismatch.h"
+#include "mongo/s/mongos_server_parameters_gen.h"
 #include "mongo/s/transaction_router.h"
 #include "mongo/s/write_ops/write_without_shard_key_util.h"
 #include "mongo/util/transitional_tools_do_not_use/vector_spooling.h"
@@ -220,7 +221,8 @@ StatusWith<bool> targetWriteOps(OperationContext* opCtx,
                                 bool recordTargetErrors,
                                 GetTargeterFn getTargeterFn,
                                 GetWriteSizeFn getWriteSizeFn,
-                                TargetedBatchMap& batchMap) {
+                                TargetedBatchMap& batchMap,
+                                bool pipelineOrderedWrites) {
     //
     // Targeting of unordered batches is fairly simple - each remaining write op is targeted,
     // and each of those targeted writes are grouped into a batch for a particular shard
@@ -253,6 +255,13 @@ StatusWith<bool> targetWriteOps(OperationContext* opCtx,
     //  [{ skey : [c,x] }],
     //  [{ skey : y }, { skey : z }]
     //
+    // When ordered writes are pipelined, the single-shard writes are instead grouped per shard as
+    // for unordered batches, and only a multi-shard write ends the batch:
+    //
+    // Ordered insert batch of: [{ skey : a }, { skey : x }, { skey : b }, { skey : y }]
+    // broken into:
+    //  [{ skey : a }, { skey : b }] and [{ skey : x }, { skey : y }], sent together
+    //
 
     bool isWriteWithoutShardKeyOrId = false;
 
@@ -331,7 +340,7 @@ StatusWith<bool> targetWriteOps(OperationContext* opCtx,
 
         // If writes are ordered and we have a targeted endpoint, make sure we don't need to send
         // these targeted writes to any other endpoints.
-        if (ordered && !batchMap.empty()) {
+        if (ordered && !pipelineOrderedWrites && !batchMap.empty()) {
             dassert(batchMap.size() == 1u);
             if (isNewBatchRequiredOrdered(writes, batchMap)) {
                 writeOp.cancelWrites(nullptr);
@@ -339,6 +348,14 @@ StatusWith<bool> targetWriteOps(OperationContext* opCtx,
             }
         }
 
+        // Even when ordered writes are pipelined, a multi-shard write can only be sent once all the
+        // writes before it have completed.
+        const bool isMultiShardWrite = writes.size() > 1u;
+        if (ordered && pipelineOrderedWrites && !batchMap.empty() && isMultiShardWrite) {
+            writeOp.cancelWrites(nullptr);
+            break;
+        }
+
         const auto estWriteSizeBytes = getWriteSizeFn(writeOp);
 
         if (wouldMakeBatchesTooBig(writes, estWriteSizeBytes, batchMap)) {
@@ -349,7 +366,7 @@ StatusWith<bool> targetWriteOps(OperationContext* opCtx,
 
         // If writes are unordered and we already have targeted endpoints, make sure we don't target
         // the same shard with a different shardVersion.
-        if (!ordered &&
+        if ((!ordered || pipelineOrderedWrites) &&
             isNewBatchRequiredUnordered(targeter.getNS(), writes, nsShardIdMap, nsEndpointMap)) {
             writeOp.cancelWrites(nullptr);
             break;
@@ -424,8 +441,9 @@ StatusWith<bool> targetWriteOps(OperationContext* opCtx,
         writes.clear();
 
         // Break if we're ordered and we have more than one endpoint - later writes cannot be
-        // enforced as ordered across multiple shard endpoints.
-        if (ordered && batchMap.size() > 1u)
+        // enforced as ordered across multiple shard endpoints. Pipelined ordered writes only need
+        // to break after a multi-shard write.
+        if (ordered && (pipelineOrderedWrites ? isMultiShardWrite : batchMap.size() > 1u))
             break;
     }
 
@@ -437,7 +455,12 @@ BatchWriteOp::BatchWriteOp(OperationContext* opCtx, const BatchedCommandRequest&
       _clientRequest(clientRequest),
       _batchTxnNum(_opCtx->getTxnNumber()),
       _inTransaction(bool(TransactionRouter::get(opCtx))),
-      _isRetryableWrite(opCtx->isRetryableWrite()) {
+      _isRetryableWrite(opCtx->isRetryableWrite()),
+      _pipelineOrderedWrites(_inTransaction &&
+                             _clientRequest.getWriteCommandRequestBase().getOrdered() &&
+                             _clientRequest.getBatchType() ==
+                                 BatchedCommandRequest::BatchType_Insert &&
+                             gEnablePipelinedOrderedWritesInTransactions.load()) {
     _writeOps.reserve(_clientRequest.sizeWriteOps());
 
     for (size_t i = 0; i < _clientRequest.sizeWriteOps(); ++i) {
@@ -482,7 +505,8 @@ StatusWith<bool> BatchWriteOp::targetBatch(const NSTargeter& targeter,
                 ordered ? 0 : write_ops::kWriteCommandBSONArrayPerElementOverheadBytes + 272;
             return std::max(writeSizeBytes, errorResponsePotentialSizeBytes);
         },
-        *targetedBatches);
+        *targetedBatches,
+        _pipelineOrderedWrites);
 
     if (!targetStatus.isOK()) {
         return targetStatus;
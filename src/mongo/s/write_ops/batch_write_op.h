@@ -198,6 +198,15 @@ public:
 
     boost::optional<int> getNShardsOwningChunks();
 
+    /**
+     * Returns true if the single-shard writes of this ordered batch are sent to all the shards they
+     * target at once, see enablePipelinedOrderedWritesInTransactions. The responses to such child
+     * batches must be noted as if the writes had been executed one shard at a time.
+     */
+    bool pipelinesOrderedWrites() const {
+        return _pipelineOrderedWrites;
+    }
+
 private:
     /**
      * Maintains the batch execution statistics when a response is received.
@@ -245,6 +254,13 @@ private:
     const bool _inTransaction{false};
     const bool _isRetryableWrite{false};
 
+    // Set to true if this is an ordered insert batch in a transaction whose single-shard writes are
+    // pipelined. Within a transaction any write error aborts the batch (and the transaction), so
+    // the writes which follow it can be sent ahead of time, as long as the client is only told
+    // about the writes which precede the first error. Each successful insert accounts for exactly
+    // one document in the response of its shard, which lets the count of those writes be derived.
+    const bool _pipelineOrderedWrites{false};
+
     boost::optional<int> _nShardsOwningChunks;
 };
 
@@ -272,12 +288,18 @@ typedef std::function<const NSTargeter&(const WriteOp& writeOp)> GetTargeterFn;
 typedef std::function<int(const WriteOp& writeOp)> GetWriteSizeFn;
 
 // Helper function to target ready writeOps. See BatchWriteOp::targetBatch for details.
+//
+// If 'pipelineOrderedWrites' is true, ordered writes which each target a single shard are batched
+// for all the shards they target at once, as if they were unordered. This is only correct when the
+// caller aborts the whole batch on the first error, as happens within a transaction, and only
+// reports the writes which precede that error.
 StatusWith<bool> targetWriteOps(OperationContext* opCtx,
                                 std::vector<WriteOp>& writeOps,
                                 bool ordered,
                                 bool recordTargetErrors,
                                 GetTargeterFn getTargeterFn,
                                 GetWriteSizeFn getWriteSizeFn,
-                                TargetedBatchMap& batchMap);
+                                TargetedBatchMap& batchMap,
+                                bool pipelineOrderedWrites = false);
 
 }  // namespace mongo
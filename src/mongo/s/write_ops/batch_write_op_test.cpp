@@ -1871,6 +1871,108 @@ TEST_F(BatchWriteOpTransactionTest, ThrowTargetingErrorsInTransaction_Update) {
     ASSERT_EQ(ErrorCodes::UnknownError, response.getErrDetailsAt(0).getStatus().code());
 }
 
+// Ordered single-shard writes in a transaction are all sent at once when pipelining is enabled.
+TEST_F(BatchWriteOpTransactionTest, PipelinedOrderedWritesTargetAllShardsAtOnce) {
+    RAIIServerParameterControllerForTest pipelineController(
+        "enablePipelinedOrderedWritesInTransactions", true);
+
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("foo.bar");
+    ShardEndpoint endpointA(ShardId("shardA"),
+                            ShardVersionFactory::make(ChunkVersion::IGNORED(), boost::none),
+                            boost::none);
+    ShardEndpoint endpointB(ShardId("shardB"),
+                            ShardVersionFactory::make(ChunkVersion::IGNORED(), boost::none),
+                            boost::none);
+
+    auto targeter = initTargeterSplitRange(nss, endpointA, endpointB);
+
+    // The documents alternate between the two shards.
+    BatchedCommandRequest request([&] {
+        write_ops::InsertCommandRequest insertOp(nss);
+        insertOp.setDocuments({BSON("x" << -1), BSON("x" << 1), BSON("x" << -2), BSON("x" << 2)});
+        return insertOp;
+    }());
+    ASSERT(request.getWriteCommandRequestBase().getOrdered());
+
+    BatchWriteOp batchOp(operationContext(), request);
+    ASSERT(batchOp.pipelinesOrderedWrites());
+
+    std::map<ShardId, std::unique_ptr<TargetedWriteBatch>> targeted;
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    verifyTargetedBatches({{endpointA.shardName, 2u}, {endpointB.shardName, 2u}}, targeted);
+
+    BatchedCommandResponse response;
+    buildResponse(2, &response);
+    for (auto&& [_, batch] : targeted) {
+        batchOp.noteBatchResponse(*batch, response, nullptr);
+    }
+    ASSERT(batchOp.isFinished());
+
+    BatchedCommandResponse clientResponse;
+    batchOp.buildClientResponse(&clientResponse);
+    ASSERT(clientResponse.getOk());
+    ASSERT_EQUALS(clientResponse.getN(), 4);
+}
+
+// Only inserts are pipelined, since the number of documents an update or a delete affects cannot
+// be attributed to the writes of a child batch which precede a failed write on another shard.
+TEST_F(BatchWriteOpTransactionTest, PipelinedOrderedWritesOnlyApplyToInserts) {
+    RAIIServerParameterControllerForTest pipelineController(
+        "enablePipelinedOrderedWritesInTransactions", true);
+
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("foo.bar");
+    ShardEndpoint endpointA(ShardId("shardA"),
+                            ShardVersionFactory::make(ChunkVersion::IGNORED(), boost::none),
+                            boost::none);
+    ShardEndpoint endpointB(ShardId("shardB"),
+                            ShardVersionFactory::make(ChunkVersion::IGNORED(), boost::none),
+                            boost::none);
+
+    auto targeter = initTargeterSplitRange(nss, endpointA, endpointB);
+
+    BatchedCommandRequest request([&] {
+        write_ops::DeleteCommandRequest deleteOp(nss);
+        deleteOp.setDeletes({
+            buildDelete(BSON("x" << -1), false),
+            buildDelete(BSON("x" << 1), false),
+            buildDelete(BSON("x" << -2), false),
+        });
+        return deleteOp;
+    }());
+
+    BatchWriteOp batchOp(operationContext(), request);
+    ASSERT_FALSE(batchOp.pipelinesOrderedWrites());
+
+    std::map<ShardId, std::unique_ptr<TargetedWriteBatch>> targeted;
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    verifyTargetedBatches({{endpointA.shardName, 1u}}, targeted);
+}
+
+// Without pipelining, ordered writes in a transaction are still sent one shard at a time.
+TEST_F(BatchWriteOpTransactionTest, OrderedWritesAreNotPipelinedByDefault) {
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("foo.bar");
+    ShardEndpoint endpointA(ShardId("shardA"),
+                            ShardVersionFactory::make(ChunkVersion::IGNORED(), boost::none),
+                            boost::none);
+    ShardEndpoint endpointB(ShardId("shardB"),
+                            ShardVersionFactory::make(ChunkVersion::IGNORED(), boost::none),
+                            boost::none);
+
+    auto targeter = initTargeterSplitRange(nss, endpointA, endpointB);
+
+    BatchedCommandRequest request([&] {
+        write_ops::InsertCommandRequest insertOp(nss);
+        insertOp.setDocuments({BSON("x" << -1), BSON("x" << 1), BSON("x" << -2)});
+        return insertOp;
+    }());
+
+    BatchWriteOp batchOp(operationContext(), request);
+
+    std::map<ShardId, std::unique_ptr<TargetedWriteBatch>> targeted;
+    ASSERT_OK(batchOp.targetBatch(targeter, false, &targeted));
+    verifyTargetedBatches({{endpointA.shardName, 1u}}, targeted);
+}
+
 const NamespaceString kNss = NamespaceString::createNamespaceString_forTest("TestDB", "TestColl");
 const int splitPoint = 50;
 
@@ -38,7 +38,7 @@
 
 #include "mongo/logv2/log.h"
 #include "mongo/platform/atomic_word.h"
-#include "mongo/platform/mutex.h"
+#include "mongo/platform/pause.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/errno_util.h"
 
@@ -109,6 +109,14 @@ static void atomic_notify_one(AtomicWord<uint32_t>& atomic) noexcept {
                     "error"_attr = errorMessage(posixError(errno)));
     }
 }
+
+// Number of tickets a thread hands off before passing the remaining hand-offs to the last waiter
+// it woke.
+constexpr int kMaxHandOffsPerThread = 8;
+
+// Number of times a thread handing off tickets polls for an owed waiter that is still queueing
+// before leaving the hand-offs to the next acquirer that finishes queueing.
+constexpr int kMaxOwedWaiterPopAttempts = 1000;
 }  // namespace
 
 template <class Queue>
@@ -123,24 +131,31 @@ bool TicketPool<Queue>::tryAcquire() {
 
 template <class Queue>
 bool TicketPool<Queue>::acquire(AdmissionContext* admCtx, Date_t deadline) {
-    auto waiter = std::make_shared<TicketWaiter>();
+    if (_available.fetchAndSubtract(1) > 0) {
+        return true;
+    }
+
+    // We took the count below zero, so the next released ticket is owed to us. A releaser may
+    // already be waiting for us to queue.
+    auto waiter = make_intrusive<TicketWaiter>();
     waiter->context = admCtx;
+    _waiters.push(waiter);
+    _queued.addAndFetch(1);
 
-    {
-        stdx::unique_lock<Mutex> lk(_mutex);
-        // It is important to check for a ticket one more time before queueing, as a ticket may have
-        // just become available.
-        if (tryAcquire()) {
-            return true;
+    // A releaser that gave up waiting for an owed waiter to finish queueing left the hand-offs to
+    // whichever acquirer finishes queueing next. We may end up handing our own ticket to ourselves.
+    if (_handOffsParked.load()) {
+        bool parked = true;
+        if (_handOffsParked.compareAndSwap(&parked, false)) {
+            _handOffTickets();
         }
-        _waiters.push(waiter);
     }
-    _queued.addAndFetch(1);
 
     auto res = atomic_wait(waiter->futexWord, TicketWaiter::State::Waiting, deadline);
     if (res == stdx::cv_status::timeout) {
         // If we timed out, we need to invalidate ourselves, but ensure that we take a ticket if
-        // it was given.
+        // it was given. If we invalidate ourselves, the ticket we are owed will be returned to the
+        // pool by the releaser that pops us.
         auto state = static_cast<uint32_t>(TicketWaiter::State::Waiting);
         if (waiter->futexWord.compareAndSwap(&state, TicketWaiter::State::TimedOut)) {
             // Successfully set outselves to timed out so nobody tries to give us a ticket.
@@ -148,44 +163,108 @@ bool TicketPool<Queue>::acquire(AdmissionContext* admCtx, Date_t deadline) {
         } else {
             // We were given a ticket anyways. We must take it.
             invariant(state == TicketWaiter::State::Acquired);
+            if (waiter->inheritsHandOffs) {
+                _finishInheritedHandOff();
+            }
             return true;
         }
     }
     invariant(waiter->futexWord.load() == TicketWaiter::State::Acquired);
+    if (waiter->inheritsHandOffs) {
+        _finishInheritedHandOff();
+    }
     return true;
 }
 
 template <class Queue>
-std::shared_ptr<TicketWaiter> TicketPool<Queue>::_popWaiterOrAddTicketToPool() {
-    stdx::unique_lock<Mutex> lock(_mutex);
-    auto waiter = _waiters.pop();
-    if (!waiter) {
-        // We need to ensure we add the ticket back to the pool while holding the mutex. This
-        // prevents a soon-to-be waiter from missing an available ticket. Otherwise, we could
-        // leave a waiter in the queue without ever waking it.
-        _available.addAndFetch(1);
+boost::intrusive_ptr<TicketWaiter> TicketPool<Queue>::_popOwedWaiter() {
+    // The waiter we owe a ticket to has reserved it but may not have finished queueing yet, which
+    // only takes a few instructions unless it gets descheduled in between.
+    for (int attempt = 0; attempt < kMaxOwedWaiterPopAttempts; ++attempt) {
+        if (auto waiter = _waiters.pop()) {
+            return waiter;
+        }
+        MONGO_YIELD_CORE_FOR_SMT();
+    }
+
+    // Rather than keep spinning, park the hand-offs for the next acquirer that finishes queueing.
+    // Every acquirer increments '_queued' after its push and checks '_handOffsParked' after that.
+    // So if no push completed since before our last pop attempt, any waiter still queueing
+    // will find the hand-offs parked. Otherwise that waiter may have checked too early, and we try
+    // to pop it ourselves. Each retry is caused by another acquirer finishing its push.
+    while (true) {
+        auto queued = _queued.load();
+        if (auto waiter = _waiters.pop()) {
+            return waiter;
+        }
+        _handOffsParked.store(true);
+        if (_queued.load() == queued) {
+            return nullptr;
+        }
+        bool parked = true;
+        if (!_handOffsParked.compareAndSwap(&parked, false)) {
+            // An acquirer has taken over the hand-offs.
+            return nullptr;
+        }
     }
-    return waiter;
 }
 
 template <class Queue>
-void TicketPool<Queue>::_release() {
-    while (auto waiter = _popWaiterOrAddTicketToPool()) {
+void TicketPool<Queue>::_handOffTickets() {
+    int handedOff = 0;
+    while (true) {
+        auto waiter = _popOwedWaiter();
+        if (!waiter) {
+            return;
+        }
         _queued.subtractAndFetch(1);
+
+        // Bound the hand-offs a single thread performs, so that a releaser does not serve every
+        // waiter of a saturated pool. The last waiter we serve takes over the remaining ones.
+        bool passHandOffs = handedOff + 1 == kMaxHandOffsPerThread;
+        waiter->inheritsHandOffs = passHandOffs;
         auto state = static_cast<uint32_t>(TicketWaiter::State::Waiting);
         if (waiter->futexWord.compareAndSwap(&state, TicketWaiter::State::Acquired)) {
             atomic_notify_one(waiter->futexWord);
-            return;
+            if (passHandOffs) {
+                return;
+            }
+            ++handedOff;
         } else {
-            // We raced with the waiter timing out, so we didn't transfer the ticket. Try again.
+            // We raced with the waiter timing out, so we didn't transfer the ticket. Return it to
+            // the pool, unless yet another waiter is owed it.
             invariant(state == TicketWaiter::State::TimedOut);
+            if (_available.fetchAndAdd(1) < 0) {
+                continue;
+            }
+        }
+
+        if (_pendingHandoffs.subtractAndFetch(1) == 0) {
+            return;
         }
     }
 }
 
+template <class Queue>
+void TicketPool<Queue>::_finishInheritedHandOff() {
+    // The releaser that handed us our ticket left it counted as pending.
+    if (_pendingHandoffs.subtractAndFetch(1) != 0) {
+        _handOffTickets();
+    }
+}
+
 template <class Queue>
 void TicketPool<Queue>::release() {
-    _release();
+    if (_available.fetchAndAdd(1) >= 0) {
+        // Nobody is owed a ticket, so it goes back to the pool.
+        return;
+    }
+
+    // A waiter is owed this ticket. Hand it off ourselves, unless another thread is already
+    // handing off tickets, in which case it will hand off ours as well.
+    if (_pendingHandoffs.fetchAndAdd(1) == 0) {
+        _handOffTickets();
+    }
 }
 
 template class TicketPool<FifoTicketQueue>;
@@ -29,18 +29,21 @@
 
 #pragma once
 
-#include <queue>
+#include <algorithm>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/intrusive_counter.h"
 #include "mongo/util/time_support.h"
 
 namespace mongo {
 
 /**
- * A ticket waiter represents an operation that queues when no tickets are available.
+ * A ticket waiter represents an operation that queues when no tickets are available. Waiters are
+ * reference counted because a waiter that times out only leaves its queue once a releaser pops it.
  */
-struct TicketWaiter {
+struct TicketWaiter : public RefCountable {
     enum State : uint32_t {
         // This is the initial state. May transition to only Acquired or TimedOut.
         Waiting = 0,
@@ -53,19 +56,111 @@ struct TicketWaiter {
     };
     AtomicWord<uint32_t> futexWord{Waiting};
 
-    // Only valid to dereference when in the Waiting state and while holding the queue lock.
+    // Only valid to dereference when in the Waiting state, by the thread pushing the waiter.
     AdmissionContext* context{nullptr};
+
+    // Set by the releaser before it moves the waiter to the Acquired state, when the waiter must
+    // take over the remaining ticket hand-offs.
+    bool inheritsHandOffs{false};
+
+    // Link to the next waiter of the TicketWaiterList the waiter is queued in.
+    AtomicWord<TicketWaiter*> next{nullptr};
+};
+
+/**
+ * An unbounded FIFO list of TicketWaiters which any number of threads may push to concurrently
+ * without locking, while a single thread at a time pops from it.
+ *
+ * This is Dmitry Vyukov's intrusive multi-producer single-consumer queue: a push is one atomic
+ * exchange of the head followed by linking the previous head to the new waiter, and the list holds
+ * a reference to every queued waiter. Between those two steps of a push, the waiters queued after
+ * it are not reachable yet, so pop() may transiently return nullptr while the list is not empty.
+ */
+class TicketWaiterList {
+public:
+    TicketWaiterList() : _head(&_stub), _tail(&_stub) {}
+
+    TicketWaiterList(const TicketWaiterList&) = delete;
+    TicketWaiterList& operator=(const TicketWaiterList&) = delete;
+
+    ~TicketWaiterList() {
+        while (pop()) {
+        }
+    }
+
+    void push(boost::intrusive_ptr<TicketWaiter> waiter) {
+        _push(waiter.detach());
+    }
+
+    /**
+     * Returns the oldest waiter, or nullptr if there is none or its push has not completed yet.
+     * Must not be called concurrently with itself or empty().
+     */
+    boost::intrusive_ptr<TicketWaiter> pop() {
+        TicketWaiter* tail = _tail;
+        TicketWaiter* next = tail->next.load();
+        if (tail == &_stub) {
+            if (!next) {
+                return nullptr;
+            }
+            _tail = next;
+            tail = next;
+            next = next->next.load();
+        }
+
+        if (!next) {
+            if (tail != _head.load()) {
+                // A push is in progress after 'tail'.
+                return nullptr;
+            }
+            // 'tail' is the last waiter. Queue the stub behind it, so that it can be unlinked.
+            _push(&_stub);
+            next = tail->next.load();
+            if (!next) {
+                return nullptr;
+            }
+        }
+
+        _tail = next;
+        return boost::intrusive_ptr<TicketWaiter>(tail, /*add ref*/ false);
+    }
+
+    /**
+     * Returns true if pop() would find no waiter. Must not be called concurrently with pop().
+     */
+    bool empty() const {
+        return _tail == &_stub && !_stub.next.load();
+    }
+
+private:
+    void _push(TicketWaiter* waiter) {
+        waiter->next.store(nullptr);
+        TicketWaiter* prev = _head.swap(waiter);
+        prev->next.store(waiter);
+    }
+
+    // Placeholder that keeps the list non-empty, so that pushes and pops never touch the same end.
+    TicketWaiter _stub;
+
+    // Most recently pushed waiter, updated by producers.
+    AtomicWord<TicketWaiter*> _head;
+
+    // Oldest waiter, only accessed by the consumer.
+    TicketWaiter* _tail;
 };
 
 /**
  * A TicketQueue is an interface that represents a queue of waiters whose ordering is
  * implementation-defined.
+ *
+ * Any number of threads may push concurrently. Only one thread at a time may pop, concurrently with
+ * pushes, and pop may transiently return nullptr while a push is completing.
  */
 class TicketQueue {
 public:
     virtual ~TicketQueue(){};
-    virtual void push(std::shared_ptr<TicketWaiter>) = 0;
-    virtual std::shared_ptr<TicketWaiter> pop() = 0;
+    virtual void push(boost::intrusive_ptr<TicketWaiter>) = 0;
+    virtual boost::intrusive_ptr<TicketWaiter> pop() = 0;
 };
 
 /**
@@ -74,21 +169,16 @@ public:
  */
 class FifoTicketQueue : public TicketQueue {
 public:
-    void push(std::shared_ptr<TicketWaiter> val) {
+    void push(boost::intrusive_ptr<TicketWaiter> val) {
         _queue.push(std::move(val));
     }
 
-    std::shared_ptr<TicketWaiter> pop() {
-        if (_queue.empty()) {
-            return nullptr;
-        }
-        auto front = std::move(_queue.front());
-        _queue.pop();
-        return front;
+    boost::intrusive_ptr<TicketWaiter> pop() {
+        return _queue.pop();
     }
 
 private:
-    std::queue<std::shared_ptr<TicketWaiter>> _queue;
+    TicketWaiterList _queue;
 };
 
 /**
@@ -103,7 +193,7 @@ public:
     SimplePriorityTicketQueue(int lowPriorityBypassThreshold)
         : _lowPriorityBypassThreshold(lowPriorityBypassThreshold) {}
 
-    void push(std::shared_ptr<TicketWaiter> val) final {
+    void push(boost::intrusive_ptr<TicketWaiter> val) final {
         if (val->context->getPriority() == AdmissionContext::Priority::kLow) {
             _low.push(std::move(val));
             return;
@@ -112,7 +202,7 @@ public:
         _normal.push(std::move(val));
     }
 
-    std::shared_ptr<TicketWaiter> pop() final {
+    boost::intrusive_ptr<TicketWaiter> pop() final {
         auto normalQueued = !_normal.empty();
         auto lowQueued = !_low.empty();
         if (!normalQueued && !lowQueued) {
@@ -120,19 +210,17 @@ public:
         }
         if (normalQueued && lowQueued && _lowPriorityBypassThreshold.load() > 0 &&
             _lowPriorityBypassCount.fetchAndAdd(1) % _lowPriorityBypassThreshold.load() == 0) {
-            auto front = std::move(_low.front());
-            _low.pop();
-            _expeditedLowPriorityAdmissions.addAndFetch(1);
-            return front;
+            if (auto front = _low.pop()) {
+                _expeditedLowPriorityAdmissions.addAndFetch(1);
+                return front;
+            }
         }
         if (normalQueued) {
-            auto front = std::move(_normal.front());
-            _normal.pop();
-            return front;
+            if (auto front = _normal.pop()) {
+                return front;
+            }
         }
-        auto front = std::move(_low.front());
-        _low.pop();
-        return front;
+        return _low.pop();
     }
 
     /**
@@ -173,8 +261,8 @@ private:
      */
     AtomicWord<std::uint64_t> _lowPriorityBypassCount{0};
 
-    std::queue<std::shared_ptr<TicketWaiter>> _normal;
-    std::queue<std::shared_ptr<TicketWaiter>> _low;
+    TicketWaiterList _normal;
+    TicketWaiterList _low;
 };
 
 
@@ -182,6 +270,15 @@ private:
  * A TicketPool holds tickets and queues waiters in the provided TicketQueue. The TicketPool
  * attempts to emulate a semaphore with a custom queueing policy.
  *
+ * No mutex is involved. Acquiring and releasing are a single atomic add on the ticket count when
+ * tickets are available, or when nobody is waiting for one. Otherwise the count goes negative, and
+ * every acquirer that takes it below zero queues itself and is owed the next released ticket, which
+ * the releaser hands off to it directly. Releasers that owe tickets elect one of them at a time to
+ * pop waiters, so the queue only ever has a single consumer and the other releasers return at once.
+ * The elected thread hands off a bounded number of tickets, then passes that role to the last
+ * waiter it woke. It also passes the role to the next acquirer that finishes queueing when an owed
+ * waiter takes too long to become visible in the queue.
+ *
  * All public functions are thread-safe except where explicitly stated otherwise.
  */
 template <class Queue>
@@ -210,7 +307,7 @@ public:
      * Returns the number of tickets available.
      */
     int32_t available() const {
-        return _available.load();
+        return std::max(_available.load(), 0);
     }
 
     /**
@@ -222,7 +319,7 @@ public:
 
     /*
      * Provides direct access to the underlying queue. Callers must ensure they only use thread-safe
-     * functions.
+     * functions, which excludes popping.
      */
     const Queue& getQueue() const {
         return _waiters;
@@ -234,25 +331,42 @@ public:
 
 private:
     /**
-     * Attempt to give the ticket to a waiter, and otherwise the pool.
+     * Hands off tickets to queued waiters until no release owes one anymore, or until the role is
+     * passed to another thread. Only called by the thread holding that role: the releaser that
+     * raised '_pendingHandoffs' from zero, a waiter that inherited it, or the acquirer that
+     * unparked it.
      */
-    void _release();
+    void _handOffTickets();
 
     /**
-     * Removes the next waiter from the queue. If there are no waiters, adds the ticket to the pool.
-     * Ensures that no new waiters queue while this is happening.
+     * Accounts for the ticket handed to a waiter that inherited the hand-offs, and carries on with
+     * the remaining ones.
      */
-    std::shared_ptr<TicketWaiter> _popWaiterOrAddTicketToPool();
+    void _finishInheritedHandOff();
 
+    /**
+     * Pops the next waiter, polling for a bounded time for it to finish queueing if necessary.
+     * Returns nullptr once the hand-offs have been parked for the next acquirer to finish queueing.
+     * Only valid when a waiter is owed a ticket.
+     */
+    boost::intrusive_ptr<TicketWaiter> _popOwedWaiter();
+
+    // Number of tickets in the pool, minus the number of queued waiters that are still owed a
+    // ticket. This includes waiters that timed out, which count as owed until they are popped.
     AtomicWord<int32_t> _available;
 
-    // This counter is redundant with the _waiters queue length, but provides the releaseIfWaiters()
-    // a fast-path that avoids taking the queue mutex.
+    // This counter is redundant with the _waiters queue length, but can be read from any thread.
     AtomicWord<int32_t> _queued;
 
-    // This mutex protects the _waiters queue by preventing items from being added and removed, but
-    // does not protect the elements of the queue.
-    Mutex _mutex = MONGO_MAKE_LATCH("TicketPool::_mutex");
+    // Number of releases that owe their ticket to a queued waiter but have not handed it off yet.
+    // The releaser that raises it from zero becomes the only consumer of _waiters until it drops
+    // back to zero.
+    AtomicWord<int32_t> _pendingHandoffs{0};
+
+    // Set when the thread handing off tickets gave up waiting for an owed waiter to finish
+    // queueing. The acquirer that clears it takes over the hand-offs.
+    AtomicWord<bool> _handOffsParked{false};
+
     Queue _waiters;
 };
 }  // namespace mongo
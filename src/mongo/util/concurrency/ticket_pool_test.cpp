@@ -142,4 +142,77 @@ TEST(TicketPoolTest, HandOverWorks) {
         }
     }
 }
+
+TEST(TicketPoolTest, ConcurrentReleasesServeMoreWaitersThanOneThreadHandsOff) {
+    // Enough waiters that the thread handing off tickets passes that role on several times.
+    static constexpr auto kWaiters = 64;
+    TicketPool<FifoTicketQueue> pool(0);
+    AtomicWord<int32_t> acquired{0};
+
+    std::vector<stdx::thread> waiters;
+    for (int i = 0; i < kWaiters; i++) {
+        waiters.emplace_back([&] {
+            AdmissionContext ctx;
+            ASSERT_TRUE(pool.acquire(&ctx, Date_t::now() + kWaitTimeout));
+            acquired.addAndFetch(1);
+        });
+    }
+
+    assertSoon([&] {
+        ASSERT_SOON_EXP(pool.queued() == kWaiters);
+        return true;
+    });
+
+    unittest::Barrier barrier(kWaiters);
+    std::vector<stdx::thread> releasers;
+    for (int i = 0; i < kWaiters; i++) {
+        releasers.emplace_back([&] {
+            barrier.countDownAndWait();
+            pool.release();
+        });
+    }
+    for (auto& thread : releasers) {
+        thread.join();
+    }
+    for (auto& thread : waiters) {
+        thread.join();
+    }
+
+    ASSERT_EQ(acquired.load(), kWaiters);
+    ASSERT_EQ(pool.available(), 0);
+    ASSERT_EQ(pool.queued(), 0);
+}
+
+TEST(TicketPoolTest, ConcurrentAcquireAndReleaseWithTimeouts) {
+    static constexpr auto kTickets = 4;
+    static constexpr auto kThreads = 32;
+    static constexpr auto kIterations = 2000;
+    TicketPool<SimplePriorityTicketQueue> pool(kTickets, 5 /* lowPriorityBypassThreshold */);
+    AtomicWord<int32_t> inUse{0};
+
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kThreads; i++) {
+        threads.emplace_back([&, i] {
+            AdmissionContext ctx;
+            ctx.setPriority(i % 3 == 0 ? AdmissionContext::Priority::kLow
+                                       : AdmissionContext::Priority::kNormal);
+            for (int j = 0; j < kIterations; j++) {
+                // Let some of the acquisitions time out, leaving timed out waiters in the queue.
+                auto deadline = j % 7 == 0 ? Date_t::now() : Date_t::now() + kWaitTimeout;
+                if (!pool.tryAcquire() && !pool.acquire(&ctx, deadline)) {
+                    continue;
+                }
+                ASSERT_LTE(inUse.addAndFetch(1), kTickets);
+                inUse.subtractAndFetch(1);
+                pool.release();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(pool.available(), kTickets);
+    ASSERT_EQ(pool.queued(), 0);
+}
 }  // namespace
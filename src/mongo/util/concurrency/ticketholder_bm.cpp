@@ -50,6 +50,10 @@ static int kThreadMin = 16;
 static int kThreadMax = 1024;
 static int kLowPriorityAdmissionBypassThreshold = 100;
 
+// Number of tickets for the saturated benchmarks, where nearly every acquisition queues and nearly
+// every release hands its ticket off to a waiter.
+static int kSaturatedTickets = 4;
+
 // For a given benchmark, specifies the AdmissionContext::Priority of ticket admissions
 enum class AdmissionsPriority {
     // All admissions must be AdmissionContext::Priority::kNormal.
@@ -66,12 +70,12 @@ class TicketHolderFixture {
 public:
     std::unique_ptr<TicketHolder> ticketHolder;
 
-    TicketHolderFixture(int threads, ServiceContext* serviceContext) {
+    TicketHolderFixture(int threads, ServiceContext* serviceContext, int tickets = kTickets) {
         if constexpr (std::is_same_v<PriorityTicketHolder, TicketHolderImpl>) {
             ticketHolder = std::make_unique<TicketHolderImpl>(
-                kTickets, kLowPriorityAdmissionBypassThreshold, serviceContext);
+                tickets, kLowPriorityAdmissionBypassThreshold, serviceContext);
         } else {
-            ticketHolder = std::make_unique<TicketHolderImpl>(kTickets, serviceContext);
+            ticketHolder = std::make_unique<TicketHolderImpl>(tickets, serviceContext);
         }
     }
 };
@@ -81,6 +85,32 @@ static Mutex isReadyMutex;
 static stdx::condition_variable isReadyCv;
 static bool isReady = false;
 
+AdmissionContext::Priority getPriority(AdmissionsPriority admissionsPriority, int threadIndex) {
+    switch (admissionsPriority) {
+        case AdmissionsPriority::kNormal:
+            return AdmissionContext::Priority::kNormal;
+        case AdmissionsPriority::kLow:
+            return AdmissionContext::Priority::kLow;
+        case AdmissionsPriority::kNormalAndLow: {
+            return (threadIndex % 2) == 0 ? AdmissionContext::Priority::kNormal
+                                          : AdmissionContext::Priority::kLow;
+        }
+        default:
+            MONGO_UNREACHABLE;
+    }
+}
+
+void reportPercentiles(benchmark::State& state,
+                       const std::string& prefix,
+                       const LatencyPercentileDistribution& distribution) {
+    state.counters[prefix + "50"] = benchmark::Counter(distribution.getPercentile(0.5f).count());
+    state.counters[prefix + "95"] = benchmark::Counter(distribution.getPercentile(0.95f).count());
+    state.counters[prefix + "99"] = benchmark::Counter(distribution.getPercentile(0.99f).count());
+    state.counters[prefix + "99.9"] =
+        benchmark::Counter(distribution.getPercentile(0.999f).count());
+    state.counters[prefix + "Max"] = benchmark::Counter(distribution.getMax().count());
+}
+
 template <class TicketHolderImpl, AdmissionsPriority admissionsPriority>
 void BM_acquireAndRelease(benchmark::State& state) {
     static std::unique_ptr<TicketHolderFixture<TicketHolderImpl>> ticketHolder;
@@ -106,20 +136,7 @@ void BM_acquireAndRelease(benchmark::State& state) {
     }
     double acquired = 0;
 
-    AdmissionContext::Priority priority = [&] {
-        switch (admissionsPriority) {
-            case AdmissionsPriority::kNormal:
-                return AdmissionContext::Priority::kNormal;
-            case AdmissionsPriority::kLow:
-                return AdmissionContext::Priority::kLow;
-            case AdmissionsPriority::kNormalAndLow: {
-                return (state.thread_index % 2) == 0 ? AdmissionContext::Priority::kNormal
-                                                     : AdmissionContext::Priority::kLow;
-            }
-            default:
-                MONGO_UNREACHABLE;
-        }
-    }();
+    AdmissionContext::Priority priority = getPriority(admissionsPriority, state.thread_index);
 
     TicketHolderFixture<TicketHolderImpl>* fixture = ticketHolder.get();
     // We build the latency distribution locally in order to avoid synchronizing with other threads.
@@ -164,15 +181,81 @@ void BM_acquireAndRelease(benchmark::State& state) {
         ticketHolder.reset();
         serviceContext.reset();
         isReady = false;
-        state.counters["AcqRel50"] =
-            benchmark::Counter(resultingDistribution.getPercentile(0.5f).count());
-        state.counters["AcqRel95"] =
-            benchmark::Counter(resultingDistribution.getPercentile(0.95f).count());
-        state.counters["AcqRel99"] =
-            benchmark::Counter(resultingDistribution.getPercentile(0.99f).count());
-        state.counters["AcqRel99.9"] =
-            benchmark::Counter(resultingDistribution.getPercentile(0.999f).count());
-        state.counters["AcqRelMax"] = benchmark::Counter(resultingDistribution.getMax().count());
+        reportPercentiles(state, "AcqRel", resultingDistribution);
+    }
+}
+
+/**
+ * Like BM_acquireAndRelease, but with far fewer tickets than threads and without holding tickets
+ * for any artificial amount of time, so that the ticket holder is constantly saturated: almost
+ * every acquisition has to queue, and almost every release has to hand its ticket off to a waiter.
+ * Acquire and release latencies are reported as separate distributions, since under saturation
+ * the handoff in release is the contention point.
+ */
+template <class TicketHolderImpl, AdmissionsPriority admissionsPriority>
+void BM_saturatedAcquireAndRelease(benchmark::State& state) {
+    static std::unique_ptr<TicketHolderFixture<TicketHolderImpl>> ticketHolder;
+    static ServiceContext::UniqueServiceContext serviceContext;
+    static constexpr auto resolution = Microseconds{1};
+    static LatencyPercentileDistribution acquireDistribution(resolution);
+    static LatencyPercentileDistribution releaseDistribution(resolution);
+    static int numRemainingToMerge;
+    {
+        stdx::unique_lock lk(isReadyMutex);
+        if (state.thread_index == 0) {
+            acquireDistribution = LatencyPercentileDistribution{resolution};
+            releaseDistribution = LatencyPercentileDistribution{resolution};
+            numRemainingToMerge = state.threads;
+            serviceContext = ServiceContext::make();
+            serviceContext->setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+            serviceContext->registerClientObserver(std::make_unique<LockerNoopClientObserver>());
+            ticketHolder = std::make_unique<TicketHolderFixture<TicketHolderImpl>>(
+                state.threads, serviceContext.get(), kSaturatedTickets);
+            isReady = true;
+            isReadyCv.notify_all();
+        } else {
+            isReadyCv.wait(lk, [&] { return isReady; });
+        }
+    }
+    double acquired = 0;
+
+    AdmissionContext::Priority priority = getPriority(admissionsPriority, state.thread_index);
+    TicketHolderFixture<TicketHolderImpl>* fixture = ticketHolder.get();
+    LatencyPercentileDistribution localAcquireDistribution{resolution};
+    LatencyPercentileDistribution localReleaseDistribution{resolution};
+
+    for (auto _ : state) {
+        AdmissionContext admCtx;
+        admCtx.setPriority(priority);
+        Timer timer;
+        auto ticket = fixture->ticketHolder->waitForTicketUntil(nullptr, &admCtx, Date_t::max());
+        localAcquireDistribution.addEntry(timer.elapsed());
+        acquired++;
+
+        timer.reset();
+        ticket.reset();
+        localReleaseDistribution.addEntry(timer.elapsed());
+    }
+    state.counters["Acquired"] = benchmark::Counter(acquired, benchmark::Counter::kIsRate);
+    state.counters["AcquiredPerThread"] =
+        benchmark::Counter(acquired, benchmark::Counter::kAvgThreadsRate);
+    {
+        stdx::unique_lock lk(isReadyMutex);
+        acquireDistribution = acquireDistribution.mergeWith(localAcquireDistribution);
+        releaseDistribution = releaseDistribution.mergeWith(localReleaseDistribution);
+        numRemainingToMerge--;
+        if (numRemainingToMerge > 0) {
+            isReadyCv.wait(lk, [&] { return numRemainingToMerge == 0; });
+        } else {
+            isReadyCv.notify_all();
+        }
+    }
+    if (state.thread_index == 0) {
+        ticketHolder.reset();
+        serviceContext.reset();
+        isReady = false;
+        reportPercentiles(state, "Acq", acquireDistribution);
+        reportPercentiles(state, "Rel", releaseDistribution);
     }
 }
 
@@ -186,9 +269,30 @@ BENCHMARK_TEMPLATE(BM_acquireAndRelease, SemaphoreTicketHolder, AdmissionsPriori
     ->Threads(128)
     ->Threads(kThreadMax);
 
+BENCHMARK_TEMPLATE(BM_saturatedAcquireAndRelease,
+                   SemaphoreTicketHolder,
+                   AdmissionsPriority::kNormal)
+    ->Threads(kThreadMin)
+    ->Threads(128)
+    ->Threads(kThreadMax);
+
 // TODO SERVER-72616: Remove ifdefs once PriorityTicketHolder is available cross-platform.
 #ifdef __linux__
 
+BENCHMARK_TEMPLATE(BM_saturatedAcquireAndRelease,
+                   PriorityTicketHolder,
+                   AdmissionsPriority::kNormal)
+    ->Threads(kThreadMin)
+    ->Threads(128)
+    ->Threads(kThreadMax);
+
+BENCHMARK_TEMPLATE(BM_saturatedAcquireAndRelease,
+                   PriorityTicketHolder,
+                   AdmissionsPriority::kNormalAndLow)
+    ->Threads(kThreadMin)
+    ->Threads(128)
+    ->Threads(kThreadMax);
+
 BENCHMARK_TEMPLATE(BM_acquireAndRelease, PriorityTicketHolder, AdmissionsPriority::kNormal)
     ->Threads(kThreadMin)
     ->Threads(kTickets)
@@ -0,0 +1,197 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/util/hdr_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/bits.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+HdrHistogram::~HdrHistogram() {
+    for (auto& group : _groups) {
+        delete group.loadRelaxed();
+    }
+}
+
+size_t HdrHistogram::bucketIndex(uint64_t value) {
+    if (value < kSubBucketCount) {
+        return value;
+    }
+
+    const int log2 = 63 - countLeadingZeros64(value);
+    if (log2 >= kMaxValueBits) {
+        return kNumBuckets - 1;
+    }
+
+    // The group of the power-of-two range [2^log2, 2^(log2 + 1)), and the sub-bucket given by the
+    // kSubBucketBits bits below the leading one.
+    const size_t group = log2 - kSubBucketBits + 1;
+    const size_t subBucket = (value >> (log2 - kSubBucketBits)) & (kSubBucketCount - 1);
+    return group * kSubBucketCount + subBucket;
+}
+
+uint64_t HdrHistogram::bucketLowerBound(size_t index) {
+    const size_t group = index / kSubBucketCount;
+    const uint64_t subBucket = index % kSubBucketCount;
+    if (group == 0) {
+        return subBucket;
+    }
+    return (kSubBucketCount + subBucket) << (group - 1);
+}
+
+uint64_t HdrHistogram::bucketUpperBound(size_t index) {
+    // Also holds for the last bucket, whose upper bound is the lower bound of the group that would
+    // follow it, 2^kMaxValueBits.
+    return bucketLowerBound(index + 1);
+}
+
+HdrHistogram::Group& HdrHistogram::_group(size_t groupIndex) {
+    auto& slot = _groups[groupIndex];
+    if (auto group = slot.load()) {
+        return *group;
+    }
+
+    auto group = new Group();
+    Group* expected = nullptr;
+    if (!slot.compareAndSwap(&expected, group)) {
+        // Another thread installed the group first.
+        delete group;
+        return *expected;
+    }
+    return *group;
+}
+
+void HdrHistogram::record(uint64_t value) {
+    const size_t index = bucketIndex(value);
+    _group(index / kSubBucketCount)[index % kSubBucketCount].fetchAndAddRelaxed(1);
+    _sum.fetchAndAddRelaxed(value);
+
+    auto max = _max.loadRelaxed();
+    while (value > max && !_max.compareAndSwap(&max, value)) {
+    }
+}
+
+void HdrHistogram::merge(const HdrHistogram& other) {
+    for (size_t groupIndex = 0; groupIndex < kNumGroups; ++groupIndex) {
+        auto otherGroup = other._groups[groupIndex].load();
+        if (!otherGroup) {
+            continue;
+        }
+        auto& group = _group(groupIndex);
+        for (size_t i = 0; i < kSubBucketCount; ++i) {
+            if (auto count = (*otherGroup)[i].loadRelaxed()) {
+                group[i].fetchAndAddRelaxed(count);
+            }
+        }
+    }
+    _sum.fetchAndAddRelaxed(other._sum.loadRelaxed());
+
+    const auto otherMax = other._max.loadRelaxed();
+    auto max = _max.loadRelaxed();
+    while (otherMax > max && !_max.compareAndSwap(&max, otherMax)) {
+    }
+}
+
+uint64_t HdrHistogram::bucketCount(size_t index) const {
+    invariant(index < kNumBuckets);
+    auto group = _groups[index / kSubBucketCount].load();
+    return group ? (*group)[index % kSubBucketCount].loadRelaxed() : 0;
+}
+
+uint64_t HdrHistogram::count() const {
+    uint64_t total = 0;
+    for (const auto& slot : _groups) {
+        if (auto group = slot.load()) {
+            for (const auto& bucket : *group) {
+                total += bucket.loadRelaxed();
+            }
+        }
+    }
+    return total;
+}
+
+uint64_t HdrHistogram::valueAtPercentile(double percentile) const {
+    const uint64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+
+    const auto rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(std::ceil(std::clamp(percentile, 0.0, 100.0) / 100 * total)));
+    const uint64_t max = _max.loadRelaxed();
+
+    uint64_t seen = 0;
+    for (size_t index = 0; index < kNumBuckets; ++index) {
+        seen += bucketCount(index);
+        if (seen >= rank) {
+            const uint64_t lower = bucketLowerBound(index);
+            return std::min(lower + (bucketUpperBound(index) - lower) / 2, max);
+        }
+    }
+
+    // Values recorded while counting may have been missed in the buckets.
+    return max;
+}
+
+void HdrHistogram::append(bool includeBuckets, BSONObjBuilder* builder) const {
+    {
+        BSONObjBuilder percentilesBuilder(builder->subobjStart("percentiles"));
+        percentilesBuilder.append("p50", static_cast<long long>(valueAtPercentile(50)));
+        percentilesBuilder.append("p90", static_cast<long long>(valueAtPercentile(90)));
+        percentilesBuilder.append("p99", static_cast<long long>(valueAtPercentile(99)));
+        percentilesBuilder.append("p999", static_cast<long long>(valueAtPercentile(99.9)));
+        percentilesBuilder.append("max", static_cast<long long>(max()));
+    }
+
+    if (!includeBuckets) {
+        return;
+    }
+
+    BSONArrayBuilder arrayBuilder(builder->subarrayStart("hdrHistogram"));
+    for (size_t index = 0; index < kNumBuckets; ++index) {
+        const uint64_t count = bucketCount(index);
+        if (count == 0) {
+            continue;
+        }
+
+        BSONObjBuilder entryBuilder(arrayBuilder.subobjStart());
+        entryBuilder.append("micros", static_cast<long long>(bucketLowerBound(index)));
+        entryBuilder.append("count", static_cast<long long>(count));
+    }
+}
+
+}  // namespace mongo
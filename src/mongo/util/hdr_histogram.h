@@ -0,0 +1,137 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "mongo/platform/atomic_word.h"
+
+namespace mongo {
+
+class BSONObjBuilder;
+
+/**
+ * A high-dynamic-range histogram of non-negative integer values, such as latencies in
+ * microseconds, with log-linear buckets: values below kSubBucketCount each have their own bucket,
+ * and every power-of-two range above is split into kSubBucketCount equal buckets. A bucket is
+ * therefore never wider than 1/kSubBucketCount of its lower bound, and values estimated at the
+ * middle of their bucket are within 1/(2 * kSubBucketCount), i.e. 6.25%, of the recorded value
+ * across the whole range, from 1 to 2^kMaxValueBits (a little over an hour in microseconds).
+ * Larger values are counted in the last bucket.
+ *
+ * Recording is lock-free and only updates relaxed atomics: the counter of the value's bucket, the
+ * sum and, when it grows, the maximum. Concurrent readers may observe a value in some of those but
+ * not yet in others. The buckets of each power-of-two range are allocated when the first value in
+ * that range is recorded, so a histogram only uses memory for the orders of magnitude it has
+ * seen. Histograms recorded separately, e.g. per stripe, can be combined with merge().
+ */
+class HdrHistogram {
+public:
+    static constexpr int kSubBucketBits = 3;
+    static constexpr size_t kSubBucketCount = size_t{1} << kSubBucketBits;
+    static constexpr int kMaxValueBits = 32;
+    // One group of kSubBucketCount buckets for the values below kSubBucketCount, and one for each
+    // power-of-two range above.
+    static constexpr size_t kNumGroups = kMaxValueBits - kSubBucketBits + 1;
+    static constexpr size_t kNumBuckets = kNumGroups * kSubBucketCount;
+
+    HdrHistogram() = default;
+    ~HdrHistogram();
+
+    HdrHistogram(const HdrHistogram&) = delete;
+    HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+    /**
+     * Returns the index of the bucket counting 'value'.
+     */
+    static size_t bucketIndex(uint64_t value);
+
+    /**
+     * Returns the inclusive lower bound of the bucket at 'index'.
+     */
+    static uint64_t bucketLowerBound(size_t index);
+
+    /**
+     * Returns the exclusive upper bound of the bucket at 'index'.
+     */
+    static uint64_t bucketUpperBound(size_t index);
+
+    void record(uint64_t value);
+
+    /**
+     * Adds the counts, sum and maximum of 'other' to this histogram.
+     */
+    void merge(const HdrHistogram& other);
+
+    uint64_t count() const;
+
+    uint64_t sum() const {
+        return _sum.loadRelaxed();
+    }
+
+    uint64_t max() const {
+        return _max.loadRelaxed();
+    }
+
+    uint64_t bucketCount(size_t index) const;
+
+    /**
+     * Returns an estimate of the value below which 'percentile' percent of the recorded values
+     * fall: the middle of the bucket holding that value, capped at the maximum. Returns 0 if
+     * nothing was recorded.
+     */
+    uint64_t valueAtPercentile(double percentile) const;
+
+    /**
+     * Appends a "percentiles" document with the estimated 50th, 90th, 99th and 99.9th percentiles
+     * and the maximum and, with 'includeBuckets', a "hdrHistogram" array of the non-empty buckets
+     * as {micros: <lower bound>, count: <count>} documents.
+     */
+    void append(bool includeBuckets, BSONObjBuilder* builder) const;
+
+private:
+    using Group = std::array<AtomicWord<uint64_t>, kSubBucketCount>;
+
+    /**
+     * Returns the buckets of group 'groupIndex', allocating them if necessary.
+     */
+    Group& _group(size_t groupIndex);
+
+    std::array<AtomicWord<Group*>, kNumGroups> _groups{};
+    AtomicWord<uint64_t> _sum;
+    AtomicWord<uint64_t> _max;
+};
+
+}  // namespace mongo
@@ -0,0 +1,94 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "mongo/platform/random.h"
+#include "mongo/util/hdr_histogram.h"
+
+namespace mongo {
+namespace {
+
+// Log-uniformly distributed latencies between 1 microsecond and about 1 minute.
+std::vector<uint64_t> makeLatencies() {
+    PseudoRandom random(12345);
+    std::vector<uint64_t> latencies(4096);
+    for (auto& latency : latencies) {
+        latency = uint64_t{1} << random.nextInt32(26);
+        latency += random.nextInt64(latency);
+    }
+    return latencies;
+}
+
+void BM_HdrHistogramRecord(benchmark::State& state) {
+    static HdrHistogram hist;
+    const auto latencies = makeLatencies();
+    size_t i = 0;
+    for (auto _ : state) {
+        hist.record(latencies[i++ % latencies.size()]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+// Every thread records into the same histogram, as operations of one command do.
+BENCHMARK(BM_HdrHistogramRecord)->ThreadRange(1, 16);
+
+void BM_HdrHistogramValueAtPercentile(benchmark::State& state) {
+    HdrHistogram hist;
+    for (auto latency : makeLatencies()) {
+        hist.record(latency);
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(hist.valueAtPercentile(99.9));
+    }
+}
+
+BENCHMARK(BM_HdrHistogramValueAtPercentile);
+
+void BM_HdrHistogramMerge(benchmark::State& state) {
+    HdrHistogram from;
+    for (auto latency : makeLatencies()) {
+        from.record(latency);
+    }
+    for (auto _ : state) {
+        HdrHistogram into;
+        into.merge(from);
+        benchmark::DoNotOptimize(into.count());
+    }
+}
+
+BENCHMARK(BM_HdrHistogramMerge);
+
+}  // namespace
+}  // namespace mongo
@@ -0,0 +1,189 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/util/hdr_histogram.h"
+
+#include <cmath>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/unittest.h"
+
+namespace mongo {
+namespace {
+
+constexpr size_t kNumBuckets = HdrHistogram::kNumBuckets;
+
+// Values estimated at the middle of their bucket are at most half a bucket width away.
+constexpr double kMaxRelativeError = 1.0 / (2 * HdrHistogram::kSubBucketCount);
+
+TEST(HdrHistogramTest, BucketsAreContiguous) {
+    ASSERT_EQ(HdrHistogram::bucketLowerBound(0), 0);
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        const auto lower = HdrHistogram::bucketLowerBound(i);
+        const auto upper = HdrHistogram::bucketUpperBound(i);
+        ASSERT_LT(lower, upper);
+        ASSERT_EQ(HdrHistogram::bucketIndex(lower), i);
+        ASSERT_EQ(HdrHistogram::bucketIndex(upper - 1), i);
+        if (i + 1 < kNumBuckets) {
+            ASSERT_EQ(upper, HdrHistogram::bucketLowerBound(i + 1));
+        }
+    }
+    ASSERT_EQ(HdrHistogram::bucketUpperBound(kNumBuckets - 1),
+              uint64_t{1} << HdrHistogram::kMaxValueBits);
+}
+
+TEST(HdrHistogramTest, SmallValuesAreExact) {
+    for (uint64_t value = 0; value < 2 * HdrHistogram::kSubBucketCount; ++value) {
+        HdrHistogram hist;
+        hist.record(value);
+        ASSERT_EQ(hist.valueAtPercentile(50), value);
+    }
+}
+
+TEST(HdrHistogramTest, RelativeErrorIsBounded) {
+    for (double value = 1; value < double(uint64_t{1} << HdrHistogram::kMaxValueBits);
+         value *= 1.07) {
+        HdrHistogram hist;
+        const auto recorded = static_cast<uint64_t>(value);
+        hist.record(recorded);
+        // A second, larger value keeps the maximum from capping the estimate.
+        hist.record(recorded * 4);
+
+        const auto estimate = static_cast<double>(hist.valueAtPercentile(50));
+        ASSERT_LTE(std::abs(estimate - recorded), kMaxRelativeError * recorded) << recorded;
+    }
+}
+
+TEST(HdrHistogramTest, LargeValuesAreCountedInLastBucket) {
+    HdrHistogram hist;
+    const uint64_t large = uint64_t{1} << (HdrHistogram::kMaxValueBits + 4);
+    hist.record(large);
+    ASSERT_EQ(HdrHistogram::bucketIndex(large), kNumBuckets - 1);
+    ASSERT_EQ(hist.bucketCount(kNumBuckets - 1), 1);
+    ASSERT_EQ(hist.max(), large);
+    ASSERT_EQ(hist.sum(), large);
+}
+
+TEST(HdrHistogramTest, EmptyHistogram) {
+    HdrHistogram hist;
+    ASSERT_EQ(hist.count(), 0);
+    ASSERT_EQ(hist.sum(), 0);
+    ASSERT_EQ(hist.max(), 0);
+    ASSERT_EQ(hist.valueAtPercentile(99), 0);
+}
+
+TEST(HdrHistogramTest, Percentiles) {
+    HdrHistogram hist;
+    for (uint64_t value = 1; value <= 10000; ++value) {
+        hist.record(value);
+    }
+    ASSERT_EQ(hist.count(), 10000);
+    ASSERT_EQ(hist.sum(), 10000 * 10001 / 2);
+    ASSERT_EQ(hist.max(), 10000);
+
+    for (double percentile : {1.0, 50.0, 90.0, 99.0, 99.9}) {
+        const double expected = percentile * 100;
+        const auto estimate = static_cast<double>(hist.valueAtPercentile(percentile));
+        ASSERT_LTE(std::abs(estimate - expected), kMaxRelativeError * expected) << percentile;
+    }
+}
+
+TEST(HdrHistogramTest, Merge) {
+    HdrHistogram first;
+    HdrHistogram second;
+    first.record(5);
+    first.record(1000);
+    second.record(1000);
+    second.record(1'000'000);
+
+    first.merge(second);
+    ASSERT_EQ(first.count(), 4);
+    ASSERT_EQ(first.sum(), 1'002'005);
+    ASSERT_EQ(first.max(), 1'000'000);
+    ASSERT_EQ(first.bucketCount(HdrHistogram::bucketIndex(5)), 1);
+    ASSERT_EQ(first.bucketCount(HdrHistogram::bucketIndex(1000)), 2);
+    ASSERT_EQ(first.bucketCount(HdrHistogram::bucketIndex(1'000'000)), 1);
+
+    // Merging does not modify the source.
+    ASSERT_EQ(second.count(), 2);
+}
+
+TEST(HdrHistogramTest, AppendPercentilesAndBuckets) {
+    HdrHistogram hist;
+    hist.record(3);
+    hist.record(3);
+    hist.record(20);
+
+    BSONObjBuilder withoutBuckets;
+    hist.append(false, &withoutBuckets);
+    auto out = withoutBuckets.obj();
+    ASSERT_EQ(out["percentiles"]["p50"].Long(), 3);
+    ASSERT_EQ(out["percentiles"]["p999"].Long(), 20);
+    ASSERT_EQ(out["percentiles"]["max"].Long(), 20);
+    ASSERT(out["hdrHistogram"].eoo());
+
+    BSONObjBuilder withBuckets;
+    hist.append(true, &withBuckets);
+    auto buckets = withBuckets.obj()["hdrHistogram"].Array();
+    ASSERT_EQ(buckets.size(), 2);
+    ASSERT_EQ(buckets[0]["micros"].Long(), 3);
+    ASSERT_EQ(buckets[0]["count"].Long(), 2);
+    ASSERT_EQ(buckets[1]["micros"].Long(), 20);
+    ASSERT_EQ(buckets[1]["count"].Long(), 1);
+}
+
+TEST(HdrHistogramTest, ConcurrentRecording) {
+    constexpr int kThreads = 8;
+    constexpr uint64_t kValuesPerThread = 100000;
+
+    HdrHistogram hist;
+    std::vector<stdx::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&] {
+            for (uint64_t value = 0; value < kValuesPerThread; ++value) {
+                hist.record(value);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    ASSERT_EQ(hist.count(), kThreads * kValuesPerThread);
+    ASSERT_EQ(hist.sum(), kThreads * kValuesPerThread * (kValuesPerThread - 1) / 2);
+    ASSERT_EQ(hist.max(), kValuesPerThread - 1);
+}
+
+}  // namespace
+}  // namespace mongo
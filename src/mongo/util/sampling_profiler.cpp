@@ -0,0 +1,509 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include "mongo/util/sampling_profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fmt/format.h>
+
+#ifndef _WIN32
+#include <cxxabi.h>
+#endif
+
+#if defined(MONGO_SAMPLING_PROFILER_SUPPORTED)
+#include <csignal>
+#include <sys/syscall.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
+#include "mongo/base/error_codes.h"
+#include "mongo/logv2/log.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/aligned.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/errno_util.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/time_support.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kControl
+
+namespace mongo {
+
+using namespace fmt::literals;
+
+namespace sampling_profiler_detail {
+
+/**
+ * Fixed set of single-writer ring buffers filled by the SIGPROF handler and drained under the
+ * profiler's mutex. A thread writes to the buffer picked by its thread id; a signal taken while
+ * another thread sharing the buffer is writing to it drops its sample.
+ *
+ * Every slot carries a sequence number, odd while the slot is being written, so that the drain can
+ * detect slots overwritten after the writer lapped it. All fields are atomics because they are
+ * written from the signal handler while being read by the drain.
+ */
+class SampleBuffers {
+public:
+    static constexpr size_t kNumBuffers = 16;
+    static constexpr size_t kMaxFrames = SamplingProfiler::kMaxFrames;
+
+    explicit SampleBuffers(size_t samplesPerBuffer) {
+        for (auto& buffer : _buffers) {
+            buffer->slots = std::make_unique<Slot[]>(samplesPerBuffer);
+            buffer->capacity = samplesPerBuffer;
+        }
+    }
+
+    /**
+     * Async-signal-safe.
+     */
+    void record(long tid,
+                const ScopedSampleAttribution::Label& label,
+                void* const* frames,
+                size_t numFrames) {
+        auto& buffer = *_buffers[static_cast<size_t>(tid) % kNumBuffers];
+        if (buffer.writing.swap(true)) {
+            buffer.dropped.fetchAndAdd(1);
+            return;
+        }
+
+        const uint64_t n = buffer.head.load();
+        auto& slot = buffer.slots[n % buffer.capacity];
+        slot.sequence.store(2 * n + 1);
+        slot.command.store(reinterpret_cast<uintptr_t>(label.command));
+        slot.queryShapeHash.store(label.queryShapeHash);
+        slot.numFrames.store(numFrames);
+        for (size_t i = 0; i < numFrames; ++i) {
+            slot.frames[i].store(reinterpret_cast<uintptr_t>(frames[i]));
+        }
+        slot.sequence.store(2 * n + 2);
+        buffer.head.store(n + 1);
+
+        buffer.writing.store(false);
+    }
+
+    /**
+     * Calls 'onSample(frames, command, queryShapeHash)' for every sample recorded since the last
+     * call and returns the number of samples that were lost. Must not be called concurrently with
+     * itself.
+     */
+    template <typename OnSample>
+    uint64_t drain(OnSample&& onSample) {
+        uint64_t dropped = 0;
+        std::vector<uintptr_t> frames;
+        for (auto& buffer : _buffers) {
+            dropped += buffer->dropped.swap(0);
+
+            const uint64_t head = buffer->head.load();
+            if (head - buffer->tail > buffer->capacity) {
+                dropped += head - buffer->tail - buffer->capacity;
+                buffer->tail = head - buffer->capacity;
+            }
+
+            for (; buffer->tail < head; ++buffer->tail) {
+                const uint64_t n = buffer->tail;
+                const auto& slot = buffer->slots[n % buffer->capacity];
+                if (slot.sequence.load() != 2 * n + 2) {
+                    ++dropped;
+                    continue;
+                }
+
+                const auto command = reinterpret_cast<const std::string*>(slot.command.load());
+                const size_t queryShapeHash = slot.queryShapeHash.load();
+                frames.resize(std::min<size_t>(slot.numFrames.load(), kMaxFrames));
+                for (size_t i = 0; i < frames.size(); ++i) {
+                    frames[i] = slot.frames[i].load();
+                }
+
+                // The writer lapped us while we were copying the slot.
+                if (slot.sequence.load() != 2 * n + 2) {
+                    ++dropped;
+                    continue;
+                }
+
+                onSample(frames, command, queryShapeHash);
+            }
+        }
+        return dropped;
+    }
+
+private:
+    struct Slot {
+        AtomicWord<uint64_t> sequence;
+        AtomicWord<uintptr_t> command;
+        AtomicWord<size_t> queryShapeHash;
+        AtomicWord<size_t> numFrames;
+        std::array<AtomicWord<uintptr_t>, kMaxFrames> frames;
+    };
+
+    struct Buffer {
+        AtomicWord<bool> writing;
+        AtomicWord<uint64_t> head;
+        AtomicWord<uint64_t> dropped;
+        // Only accessed by the drain.
+        uint64_t tail = 0;
+        size_t capacity = 0;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    std::array<CacheExclusive<Buffer>, kNumBuffers> _buffers;
+};
+
+}  // namespace sampling_profiler_detail
+
+namespace {
+
+using sampling_profiler_detail::SampleBuffers;
+
+#if defined(MONGO_SAMPLING_PROFILER_SUPPORTED)
+
+// The buffers the SIGPROF handler records into, or null while the profiler is not running.
+AtomicWord<SampleBuffers*> activeBuffers{nullptr};
+
+// Number of SIGPROF handlers currently running, so that the buffers are only released once no
+// handler can still be using them.
+AtomicWord<int> handlersInFlight{0};
+
+/**
+ * Stops the SIGPROF handler from recording into the active buffers, and waits for the handlers
+ * that may still be using them.
+ */
+void deactivateBuffers() {
+    activeBuffers.store(nullptr);
+    while (handlersInFlight.load() > 0) {
+        sleepFor(Microseconds(100));
+    }
+}
+
+// The frames of the signal handler and of the signal trampoline.
+constexpr size_t kSignalFrames = 2;
+
+extern "C" void samplingProfilerAction(int, siginfo_t*, void*) {
+    const int savedErrno = errno;
+    handlersInFlight.fetchAndAdd(1);
+    if (auto buffers = activeBuffers.load()) {
+        std::array<void*, SamplingProfiler::kMaxFrames + kSignalFrames> frames;
+        size_t numFrames = rawBacktrace(frames.data(), frames.size());
+        if (numFrames > kSignalFrames) {
+            buffers->record(syscall(SYS_gettid),
+                            ScopedSampleAttribution::current,
+                            frames.data() + kSignalFrames,
+                            numFrames - kSignalFrames);
+        }
+    }
+    handlersInFlight.fetchAndSubtract(1);
+    errno = savedErrno;
+}
+
+void installSignalAction() {
+    static const bool installed = [] {
+        struct sigaction sa;
+        memset(&sa, 0, sizeof(sa));
+        sigemptyset(&sa.sa_mask);
+        sa.sa_sigaction = samplingProfilerAction;
+        sa.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_RESTART;
+        if (sigaction(SIGPROF, &sa, nullptr) != 0) {
+            auto ec = lastSystemError();
+            uasserted(ErrorCodes::InternalError,
+                      "Failed to install the SIGPROF action: {}"_format(errorMessage(ec)));
+        }
+        return true;
+    }();
+    (void)installed;
+}
+
+void setTimer(int samplesPerSecond) {
+    struct itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    if (samplesPerSecond > 0) {
+        timer.it_interval.tv_usec = 1000 * 1000 / samplesPerSecond;
+        timer.it_value = timer.it_interval;
+    }
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        auto ec = lastSystemError();
+        uasserted(ErrorCodes::InternalError,
+                  "Failed to set the profiling timer: {}"_format(errorMessage(ec)));
+    }
+}
+
+#endif  // defined(MONGO_SAMPLING_PROFILER_SUPPORTED)
+
+#ifndef _WIN32
+// Wrapper for the demangler that reuses its buffer across calls.
+class Demangler {
+public:
+    Demangler() = default;
+
+    Demangler(const Demangler&) = delete;
+
+    ~Demangler() {
+        free(_buf);
+    }
+
+    char* operator()(const char* sym) {
+        char* dm = abi::__cxa_demangle(sym, _buf, &_bufSize, &_status);
+        if (dm)
+            _buf = dm;
+        return dm;
+    }
+
+private:
+    size_t _bufSize = 0;
+    char* _buf = nullptr;
+    int _status = 0;
+};
+#endif  // _WIN32
+
+/**
+ * Resolves frame addresses to the names used in folded stacks, caching them for the duration of
+ * a report.
+ */
+class FrameNamer {
+public:
+    const std::string& operator()(uintptr_t address) {
+        auto [it, inserted] = _names.try_emplace(address);
+        if (inserted) {
+            it->second = _name(address);
+        }
+        return it->second;
+    }
+
+private:
+    std::string _name(uintptr_t address) {
+#ifndef _WIN32
+        const auto& meta = _metaGen.load(reinterpret_cast<void*>(address));
+        if (meta.symbol()) {
+            std::string name{meta.symbol().name()};
+            if (char* demangled = _demangler(name.c_str())) {
+                name = demangled;
+            }
+            // Semicolons separate frames in the folded format.
+            std::replace(name.begin(), name.end(), ';', ':');
+            return name;
+        }
+        if (meta.file()) {
+            StringData file = meta.file().name();
+            if (auto slash = file.rfind('/'); slash != std::string::npos) {
+                file = file.substr(slash + 1);
+            }
+            return "{}+0x{:x}"_format(file, address - meta.file().base());
+        }
+#endif
+        return "0x{:x}"_format(address);
+    }
+
+#ifndef _WIN32
+    StackTraceAddressMetadataGenerator _metaGen;
+    Demangler _demangler;
+#endif
+    std::map<uintptr_t, std::string> _names;
+};
+
+}  // namespace
+
+SamplingProfiler::SamplingProfiler() = default;
+
+SamplingProfiler::~SamplingProfiler() = default;
+
+SamplingProfiler& SamplingProfiler::get() {
+    static auto& profiler = *new SamplingProfiler();
+    return profiler;
+}
+
+bool SamplingProfiler::isSupported() {
+#if defined(MONGO_SAMPLING_PROFILER_SUPPORTED)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void SamplingProfiler::start(const Options& options) {
+    uassert(ErrorCodes::IllegalOperation,
+            "The sampling profiler is not supported on this platform",
+            isSupported());
+    uassert(ErrorCodes::BadValue,
+            "samplesPerSecond must be between 1 and 1000",
+            options.samplesPerSecond >= 1 && options.samplesPerSecond <= 1000);
+    uassert(ErrorCodes::BadValue,
+            "samplesPerBuffer and maxStacks must be positive",
+            options.samplesPerBuffer > 0 && options.maxStacks > 0);
+
+#if defined(MONGO_SAMPLING_PROFILER_SUPPORTED)
+    stdx::lock_guard<Latch> lk(_mutex);
+    uassert(ErrorCodes::ConflictingOperationInProgress,
+            "The sampling profiler is already running",
+            !_running && !_stopping);
+
+    installSignalAction();
+
+    _options = options;
+    _buffers = std::make_unique<SampleBuffers>(options.samplesPerBuffer);
+    activeBuffers.store(_buffers.get());
+    ScopeGuard releaseBuffersGuard([&] {
+        deactivateBuffers();
+        _buffers.reset();
+    });
+    setTimer(options.samplesPerSecond);
+    releaseBuffersGuard.dismiss();
+
+    _drainer = stdx::thread([this] { _drainThread(); });
+    _running = true;
+
+    LOGV2(9394500,
+          "Started the sampling profiler",
+          "samplesPerSecond"_attr = options.samplesPerSecond);
+#endif
+}
+
+void SamplingProfiler::stop() {
+#if defined(MONGO_SAMPLING_PROFILER_SUPPORTED)
+    stdx::unique_lock<Latch> lk(_mutex);
+    uassert(ErrorCodes::ConflictingOperationInProgress,
+            "The sampling profiler is not running",
+            _running && !_stopping);
+
+    setTimer(0);
+    deactivateBuffers();
+
+    _stopping = true;
+    _stopCV.notify_all();
+    lk.unlock();
+    _drainer.join();
+    lk.lock();
+
+    _drain(lk);
+    _buffers.reset();
+    _running = false;
+    _stopping = false;
+
+    LOGV2(9394501,
+          "Stopped the sampling profiler",
+          "samples"_attr = _samples,
+          "droppedSamples"_attr = _droppedSamples);
+#endif
+}
+
+bool SamplingProfiler::isRunning() const {
+    stdx::lock_guard<Latch> lk(_mutex);
+    return _running;
+}
+
+SamplingProfiler::Report SamplingProfiler::report(size_t limit, bool reset) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    if (_buffers) {
+        _drain(lk);
+    }
+
+    Report report;
+    report.running = _running;
+    report.samplesPerSecond = _running ? _options.samplesPerSecond : 0;
+    report.samples = _samples;
+    report.droppedSamples = _droppedSamples;
+
+    // Stacks which only differ by addresses within the same functions fold into one line.
+    FrameNamer frameName;
+    std::map<std::string, uint64_t> folded;
+    for (const auto& [stack, count] : _stacks) {
+        std::string line;
+        if (!stack.command.empty()) {
+            line.append("command:{};"_format(stack.command));
+        }
+        if (stack.queryShapeHash) {
+            line.append("queryShape:{:x};"_format(stack.queryShapeHash));
+        }
+        for (auto it = stack.frames.rbegin(); it != stack.frames.rend(); ++it) {
+            line.append(frameName(*it));
+            line.push_back(';');
+        }
+        if (!line.empty()) {
+            line.pop_back();
+        }
+        folded[std::move(line)] += count;
+    }
+
+    std::vector<std::pair<const std::string*, uint64_t>> sorted;
+    sorted.reserve(folded.size());
+    for (const auto& [line, count] : folded) {
+        sorted.emplace_back(&line, count);
+    }
+    limit = std::min(limit, sorted.size());
+    std::partial_sort(sorted.begin(),
+                      sorted.begin() + limit,
+                      sorted.end(),
+                      [](const auto& lhs, const auto& rhs) { return lhs.second > rhs.second; });
+
+    report.stacks.reserve(limit);
+    for (size_t i = 0; i < limit; ++i) {
+        report.stacks.push_back("{} {}"_format(*sorted[i].first, sorted[i].second));
+    }
+
+    if (reset) {
+        _stacks.clear();
+        _samples = 0;
+        _droppedSamples = 0;
+    }
+    return report;
+}
+
+void SamplingProfiler::_drain(WithLock) {
+    _droppedSamples += _buffers->drain(
+        [&](const std::vector<uintptr_t>& frames, const std::string* command, size_t shapeHash) {
+            Stack stack{frames, shapeHash, command ? StringData(*command) : StringData()};
+            auto it = _stacks.find(stack);
+            if (it == _stacks.end()) {
+                if (_stacks.size() >= _options.maxStacks) {
+                    ++_droppedSamples;
+                    return;
+                }
+                it = _stacks.emplace(std::move(stack), 0).first;
+            }
+            ++it->second;
+            ++_samples;
+        });
+}
+
+void SamplingProfiler::_drainThread() {
+    setThreadName("SamplingProfiler");
+    stdx::unique_lock<Latch> lk(_mutex);
+    while (!_stopping) {
+        _drain(lk);
+        _stopCV.wait_for(lk, Milliseconds(100).toSystemDuration(), [&] { return _stopping; });
+    }
+}
+
+}  // namespace mongo
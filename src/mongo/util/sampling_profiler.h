@@ -0,0 +1,205 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/stacktrace.h"
+
+/**
+ * The sampling profiler captures stacks from a SIGPROF handler, which is only async-signal-safe
+ * with the libunwind backtrace implementation.
+ */
+#if defined(MONGO_STACKTRACE_CAN_DUMP_ALL_THREADS)
+#define MONGO_SAMPLING_PROFILER_SUPPORTED
+#endif
+
+namespace mongo {
+
+namespace sampling_profiler_detail {
+class SampleBuffers;
+}  // namespace sampling_profiler_detail
+
+/**
+ * Labels the CPU samples taken on the current thread while it is in scope with the command being
+ * run and, once known, the $queryStats key hash of its query shape. Scopes may nest; the previous
+ * label is restored on destruction.
+ *
+ * The label is read from the sampling profiler's signal handler, so it only holds words which
+ * can not be observed half-written, and the command name must live as long as the process, as
+ * the names of registered commands do.
+ */
+class ScopedSampleAttribution {
+public:
+    struct Label {
+        const std::string* command = nullptr;
+        size_t queryShapeHash = 0;
+    };
+
+    static thread_local Label current;
+
+    explicit ScopedSampleAttribution(const std::string& command) : _previous(current) {
+        current = Label{&command, 0};
+    }
+
+    ~ScopedSampleAttribution() {
+        current = _previous;
+    }
+
+    ScopedSampleAttribution(const ScopedSampleAttribution&) = delete;
+    ScopedSampleAttribution& operator=(const ScopedSampleAttribution&) = delete;
+
+    /**
+     * Attributes the rest of the current scope's samples to the query shape with this
+     * $queryStats key hash.
+     */
+    static void setQueryShapeHash(size_t queryShapeHash) {
+        current.queryShapeHash = queryShapeHash;
+    }
+
+private:
+    Label _previous;
+};
+
+inline thread_local ScopedSampleAttribution::Label ScopedSampleAttribution::current;
+
+/**
+ * Process-wide sampling CPU profiler.
+ *
+ * While running, an ITIMER_PROF interval timer delivers SIGPROF to the threads consuming CPU at
+ * the configured rate, so the overhead is bounded by the number of samples per second rather than
+ * by the load. The handler captures the raw stack and the thread's ScopedSampleAttribution label
+ * into one of a fixed set of pre-allocated ring buffers, picked by thread id, without locking or
+ * allocating. A background thread drains the rings and aggregates identical stacks; samples which
+ * can not be buffered are counted as dropped rather than blocking the sampled thread.
+ *
+ * Stacks are symbolized when a report is requested, and reported in the folded format understood
+ * by flame graph tools: one "frame;frame;...;frame count" line per distinct stack, outermost frame
+ * first, rooted at "command:<name>" and "queryShape:<hash>" frames when the samples are
+ * attributed.
+ */
+class SamplingProfiler {
+public:
+    static constexpr size_t kMaxFrames = 48;
+
+    struct Options {
+        // Samples taken per second of CPU time consumed by the process.
+        int samplesPerSecond = 100;
+        // Number of samples each ring buffer holds between two drains.
+        size_t samplesPerBuffer = 512;
+        // Number of distinct stacks to aggregate before dropping samples of new stacks.
+        size_t maxStacks = 100 * 1000;
+    };
+
+    struct Report {
+        bool running = false;
+        int samplesPerSecond = 0;
+        uint64_t samples = 0;
+        uint64_t droppedSamples = 0;
+        // Folded stacks, most sampled first.
+        std::vector<std::string> stacks;
+    };
+
+    static SamplingProfiler& get();
+
+    static bool isSupported();
+
+    /**
+     * Starts sampling. Throws if the profiler is already running or is not supported on this
+     * platform.
+     */
+    void start(const Options& options);
+
+    /**
+     * Stops sampling, keeping the aggregated samples for subsequent reports. Throws if the
+     * profiler is not running.
+     */
+    void stop();
+
+    bool isRunning() const;
+
+    /**
+     * Returns up to 'limit' of the most sampled stacks. With 'reset', discards the aggregated
+     * samples afterwards.
+     */
+    Report report(size_t limit, bool reset);
+
+private:
+    struct Stack {
+        bool operator<(const Stack& other) const {
+            return std::tie(frames, queryShapeHash, command) <
+                std::tie(other.frames, other.queryShapeHash, other.command);
+        }
+
+        // Innermost frame first.
+        std::vector<uintptr_t> frames;
+        size_t queryShapeHash = 0;
+        StringData command;
+    };
+
+    SamplingProfiler();
+    ~SamplingProfiler();
+
+    /**
+     * Moves the samples buffered since the last call into '_stacks'.
+     */
+    void _drain(WithLock);
+
+    void _drainThread();
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("SamplingProfiler::_mutex");
+    stdx::condition_variable _stopCV;
+
+    bool _running = false;
+    bool _stopping = false;
+    Options _options;
+    std::unique_ptr<sampling_profiler_detail::SampleBuffers> _buffers;
+    stdx::thread _drainer;
+
+    std::map<Stack, uint64_t> _stacks;
+    uint64_t _samples = 0;
+    uint64_t _droppedSamples = 0;
+};
+
+}  // namespace mongo
@@ -0,0 +1,125 @@
+/*======
+This file is part of Percona Server for MongoDB.
+
+Copyright (C) 2023-present Percona and/or its affiliates. All rights reserved.
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the Server Side Public License, version 1,
+    as published by MongoDB, Inc.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    Server Side Public License for more details.
+
+    You should have received a copy of the Server Side Public License
+    along with this program. If not, see
+    <http://www.mongodb.com/licensing/server-side-public-license>.
+
+    As a special exception, the copyright holders give permission to link the
+    code of portions of this program with the OpenSSL library under certain
+    conditions as described in each individual source file and distribute
+    linked combinations including the program with the OpenSSL library. You
+    must comply with the Server Side Public License in all respects for
+    all of the code used other than as permitted herein. If you modify file(s)
+    with this exception, you may extend this exception to your version of the
+    file(s), but you are not obligated to do so. If you do not wish to do so,
+    delete this exception statement from your version. If you delete this
+    exception statement from all source files in the program, then also delete
+    it in the license file.
+======= */
+
+
+#include <string>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/sampling_profiler.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+const std::string kFind = "find";
+const std::string kAggregate = "aggregate";
+
+TEST(ScopedSampleAttributionTest, NestedScopesRestorePreviousLabel) {
+    ASSERT(!ScopedSampleAttribution::current.command);
+    {
+        ScopedSampleAttribution outer(kAggregate);
+        ScopedSampleAttribution::setQueryShapeHash(42);
+        ASSERT_EQ(ScopedSampleAttribution::current.command, &kAggregate);
+        {
+            ScopedSampleAttribution inner(kFind);
+            ASSERT_EQ(ScopedSampleAttribution::current.command, &kFind);
+            ASSERT_EQ(ScopedSampleAttribution::current.queryShapeHash, 0);
+        }
+        ASSERT_EQ(ScopedSampleAttribution::current.command, &kAggregate);
+        ASSERT_EQ(ScopedSampleAttribution::current.queryShapeHash, 42);
+    }
+    ASSERT(!ScopedSampleAttribution::current.command);
+    ASSERT_EQ(ScopedSampleAttribution::current.queryShapeHash, 0);
+}
+
+#if defined(MONGO_SAMPLING_PROFILER_SUPPORTED)
+
+TEST(SamplingProfilerTest, ReportsAttributedFoldedStacks) {
+    auto& profiler = SamplingProfiler::get();
+    profiler.start({.samplesPerSecond = 1000});
+    ASSERT(profiler.isRunning());
+
+    {
+        ScopedSampleAttribution attribution(kFind);
+        ScopedSampleAttribution::setQueryShapeHash(0xabc);
+        const auto deadline = Date_t::now() + Seconds(1);
+        volatile uint64_t sink = 0;
+        while (Date_t::now() < deadline) {
+            for (int i = 0; i < 100000; ++i) {
+                sink = sink + i;
+            }
+        }
+    }
+
+    profiler.stop();
+    ASSERT(!profiler.isRunning());
+
+    auto report = profiler.report(1000, true);
+    ASSERT(!report.running);
+    ASSERT_GT(report.samples, 0);
+    ASSERT(!report.stacks.empty());
+
+    bool foundAttributed = false;
+    for (auto&& stack : report.stacks) {
+        foundAttributed |= StringData(stack).startsWith("command:find;queryShape:abc;");
+    }
+    ASSERT(foundAttributed);
+
+    auto empty = profiler.report(1000, false);
+    ASSERT_EQ(empty.samples, 0);
+    ASSERT(empty.stacks.empty());
+}
+
+TEST(SamplingProfilerTest, RejectsConflictingAndInvalidRequests) {
+    auto& profiler = SamplingProfiler::get();
+    ASSERT_THROWS_CODE(
+        profiler.stop(), DBException, ErrorCodes::ConflictingOperationInProgress);
+    ASSERT_THROWS_CODE(profiler.start({.samplesPerSecond = 0}), DBException, ErrorCodes::BadValue);
+
+    profiler.start({});
+    ASSERT_THROWS_CODE(profiler.start({}), DBException, ErrorCodes::ConflictingOperationInProgress);
+    profiler.stop();
+}
+
+#else
+
+TEST(SamplingProfilerTest, StartFailsWhenUnsupported) {
+    ASSERT(!SamplingProfiler::isSupported());
+    ASSERT_THROWS_CODE(
+        SamplingProfiler::get().start({}), DBException, ErrorCodes::IllegalOperation);
+}
+
+#endif
+
+}  // namespace
+}  // namespace mongo